@@ -0,0 +1,74 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLOCK_H
+#define BLOCK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "cpu.h"
+#include "instruction.h"
+
+// Upper bounds on a decoded block. The byte bound is what invalidation scans
+// back over, so keep it small.
+#define BLOCK_MAX_INSTRUCTIONS 32
+#define BLOCK_MAX_BYTES (BLOCK_MAX_INSTRUCTIONS * 4)
+#define BLOCK_PAGE_SHIFT 8
+#define BLOCK_PAGE_COUNT (0x10000 >> BLOCK_PAGE_SHIFT)
+
+typedef struct {
+  instruction_handler_t handler;
+  instruction_operands_t ops;
+  uint8_t tstates;       // Copied from the table entry
+  uint8_t tstates_taken;
+} block_instruction_t;
+
+// Native translation of a block: returns the exit reason in the high 32 bits
+// and the instructions retired in the low 32 bits.
+typedef uint64_t (*block_native_t)(cpu_t *cpu);
+
+struct block {
+  uint16_t start;
+  uint16_t length; // Bytes covered by the block
+  uint8_t count;
+  bool native_failed; // Translation was attempted and refused
+  bool pure;          // Writes no memory or ports, see block_is_pure
+  uint32_t entries;   // Visits, counted while the JIT is enabled
+  block_native_t native;
+  block_instruction_t instructions[];
+};
+
+struct block_cache {
+  block_t **lookup;                      // Per-PC block, NULL until decoded
+  uint8_t code_pages[BLOCK_PAGE_COUNT];  // Non-zero if a block covers the page
+  uint8_t page_writes[BLOCK_PAGE_COUNT]; // Invalidations per page, saturating
+  uint32_t generation;                   // Bumped on every invalidation
+  uint64_t built;
+  uint64_t invalidated;
+};
+
+int block_cache_init(cpu_t *cpu);
+void block_cache_destroy(cpu_t *cpu);
+void block_cache_flush(cpu_t *cpu);
+void block_cache_invalidate(cpu_t *cpu, uint16_t address);
+
+cpu_exit_t block_run(cpu_t *cpu, uint64_t max_instructions);
+
+#endif
@@ -20,20 +20,64 @@
 #ifndef CLOCK_H
 #define CLOCK_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
 #include "cpu_fwd.h"
 
+// Real-time pacing runs slices of about CLOCK_SLICE_NS of emulated time at
+// full speed, then sleeps until the host catches up. A slice that ends more
+// than CLOCK_RESYNC_NS late restarts the timeline instead of racing to catch
+// up.
+#define CLOCK_SLICE_NS 1000000ull
+#define CLOCK_RESYNC_NS 50000000ull
+
+typedef struct {
+    uint64_t slices;       // Slices paced
+    uint64_t sleeps;       // Slices that were early and slept
+    uint64_t late;         // Slices that ended after their deadline
+    uint64_t resyncs;      // Timeline restarts after falling too far behind
+    uint64_t drift_ns;     // Sum of how far past the deadline slices ended
+    uint64_t drift_max_ns; // Worst single overrun
+    uint64_t slept_ns;     // Host time spent sleeping
+} clock_drift_t;
+
+// Emulated speed over an interval of host time.
+typedef struct {
+    uint64_t ns;                     // Host time covered
+    double mhz;                      // Emulated T-states per microsecond
+    double instructions_per_second;
+} clock_speed_t;
+
 typedef struct {
-    uint32_t delay; // Artificial delay
-    uint32_t t; // Number of remaining t-states
+    uint64_t cycles; // T-states elapsed since clock_init
+    uint32_t frequency; // Target T-states per second, 0 runs unpaced
+    double speed; // Multiplier on frequency, 1.0 for real time
+    bool turbo; // Skip pacing without forgetting the frequency
+    uint64_t rate; // T-states per host second: frequency * speed
+    uint64_t pace_ns; // Host time at the start of the paced timeline
+    uint64_t pace_cycles; // cycles at the start of the paced timeline
+    clock_drift_t drift;
+    uint64_t meter_ns; // Start of the current meter interval
+    uint64_t meter_cycles;
+    uint64_t meter_instructions;
 } z80_clock_t;
 
-int clock_init(cpu_t *cpu, uint32_t delay);
+int clock_init(cpu_t *cpu);
 int clock_destroy(cpu_t *cpu);
 int clock_available(cpu_t *cpu);
-int clock_delay(cpu_t *cpu);
-int clock_has_t_state(cpu_t *cpu);
+uint64_t clock_cycles(cpu_t *cpu);
+int clock_set_frequency(cpu_t *cpu, uint32_t frequency);
+int clock_set_speed(cpu_t *cpu, double speed);
+void clock_set_turbo(cpu_t *cpu, bool turbo);
+bool clock_paced(cpu_t *cpu);
+void clock_pace_reset(cpu_t *cpu);
+int clock_pace(cpu_t *cpu);
+uint64_t clock_slice_tstates(cpu_t *cpu);
+void clock_meter_reset(cpu_t *cpu);
+clock_speed_t clock_meter(cpu_t *cpu);
+clock_speed_t clock_speed(uint64_t cycles, uint64_t instructions, uint64_t ns);
+uint64_t clock_host_ns(void);
 #endif
@@ -24,25 +24,157 @@
 #include <stdint.h>
 
 #include "clock.h"
+#include "flags.h"
+#include "interrupt.h"
 #include "memory.h"
 #include "register.h"
+#include "scheduler.h"
+
+typedef uint8_t (*cpu_io_read_t)(void *context, uint16_t port);
+typedef void (*cpu_io_write_t)(void *context, uint16_t port, uint8_t value);
+
+typedef struct {
+  cpu_io_read_t read;
+  cpu_io_write_t write;
+  void *context;
+  uint16_t trap_port; // Port of the last IN/OUT that trapped
+  bool trap_write;
+} cpu_io_t;
+
+// Address and raw bytes of the last instruction executed. The mnemonic is
+// only produced when something asks for it, see disasm.h.
+typedef struct {
+  uint16_t address;
+  uint8_t length; // 0 until an instruction has run
+  uint8_t bytes[4];
+} cpu_last_instruction_t;
 
 struct cpu {
   z80_clock_t clock;
+  z80_scheduler_t scheduler;
   z80_memory_t memory;
-  z80_register_t registers[REG_COUNT];
-  z80_register_t alt_registers[REG_COUNT];
-  char last_instruction[64];
+  z80_register_file_t registers;
+  z80_register_file_t alt_registers;
+  flags_pending_t flags; // Deferred F update, see flags.h
+  bool lazy_flags;
+  cpu_last_instruction_t last_instruction;
   uint16_t last_mem_read;
   uint16_t last_mem_write;
   bool last_mem_read_valid;
   bool last_mem_write_valid;
-  bool interrupts_enabled;
-  bool halted;
-  uint8_t interrupt_mode;
+  z80_interrupt_t interrupt;
+  bool halted; // HALT ran; the PC waits on it until an interrupt
+  uint64_t instructions; // Instructions retired since cpu_init
+  uint64_t instruction_limit; // Value of instructions the current run stops at
+  uint64_t cycle_limit; // Value of clock.cycles the current run stops at
+  bool idle_detect;      // Fast-forward pure polling loops, see block.c
+  uint64_t idle_tstates; // T-states skipped by HALT and idle-loop fast-forward
+  uint32_t breakpoint_count;
+  uint8_t breakpoints[0x10000 / 8];
+  cpu_io_t io;
+  block_cache_t *blocks; // Decoded block cache, NULL when disabled
+  jit_t *jit;            // Native translator, NULL unless enabled
 };
 
-int cpu_init(cpu_t *cpu, uint32_t delay, uint16_t memory_size);
+typedef enum {
+  CPU_EXIT_NONE,       // Instruction executed, keep going
+  CPU_EXIT_HALT,       // HALT executed
+  CPU_EXIT_BUDGET,     // Instruction or T-state budget used up
+  CPU_EXIT_BREAKPOINT, // PC reached a breakpoint
+  CPU_EXIT_WATCHPOINT, // Watched memory accessed, see memory.watch_hit
+  CPU_EXIT_UNDEFINED,  // Undefined opcode, PC left on it
+  CPU_EXIT_IO,         // IN/OUT with no handler, PC left on it
+  CPU_EXIT_ERROR
+} cpu_exit_t;
+
+#define CPU_RUN_FOREVER UINT64_MAX
+
+int cpu_init(cpu_t *cpu, uint32_t memory_size);
 void cpu_destroy(cpu_t *cpu);
 
+cpu_exit_t cpu_step(cpu_t *cpu);
+cpu_exit_t cpu_run(cpu_t *cpu, uint64_t max_instructions);
+cpu_exit_t cpu_run_tstates(cpu_t *cpu, uint64_t max_instructions,
+                           uint64_t max_tstates);
+const char *cpu_exit_name(cpu_exit_t reason);
+
+int cpu_breakpoint_set(cpu_t *cpu, uint16_t address);
+int cpu_breakpoint_clear(cpu_t *cpu, uint16_t address);
+bool cpu_breakpoint_get(cpu_t *cpu, uint16_t address);
+
+void cpu_service(cpu_t *cpu);
+
+void cpu_io_attach(cpu_t *cpu, cpu_io_read_t read, cpu_io_write_t write,
+                   void *context);
+
+// Guest memory accesses. A page with a pointer is plain RAM or ROM and costs
+// one load or store; anything that needs checking (devices, watchpoints,
+// cached code, the debugger's access tracking) has a NULL pointer instead.
+static inline uint8_t memory_get(cpu_t *cpu, uint16_t address) {
+  const uint8_t *page = cpu->memory.read[address >> MEMORY_PAGE_SHIFT];
+
+  if (page)
+    return page[address & MEMORY_PAGE_MASK];
+  return memory_get_slow(cpu, address);
+}
+
+static inline int memory_set(cpu_t *cpu, uint16_t address, uint8_t value) {
+  uint8_t *page = cpu->memory.write[address >> MEMORY_PAGE_SHIFT];
+
+  if (page)
+    page[address & MEMORY_PAGE_MASK] = value;
+  else
+    memory_set_slow(cpu, address, value);
+  return 0;
+}
+
+// Each run loop sets the limit from its budget and stops once instructions
+// reaches it. Paths that retire many instructions at once (repeating block
+// instructions, HALT and idle fast-forward) stay within what is left.
+static inline void cpu_budget_set(cpu_t *cpu, uint64_t max_instructions) {
+  cpu->instruction_limit =
+      max_instructions > CPU_RUN_FOREVER - cpu->instructions
+          ? CPU_RUN_FOREVER
+          : cpu->instructions + max_instructions;
+}
+
+static inline uint64_t cpu_budget_left(const cpu_t *cpu) {
+  return cpu->instructions < cpu->instruction_limit
+             ? cpu->instruction_limit - cpu->instructions
+             : 0;
+}
+
+// Called by every run loop before an instruction's handler runs, so the bytes
+// are the ones executed even if the instruction overwrites itself.
+static inline void cpu_record_instruction(cpu_t *cpu, uint16_t address,
+                                          uint8_t length) {
+  cpu_last_instruction_t *last = &cpu->last_instruction;
+
+  if (length > sizeof(last->bytes))
+    length = sizeof(last->bytes);
+  last->address = address;
+  last->length = length;
+  for (uint8_t i = 0; i < length; i++) {
+    last->bytes[i] = memory_peek(cpu, (uint16_t)(address + i));
+  }
+}
+
+// Run any scheduled events that are due and accept a pending interrupt.
+// This single compare is all the run loops pay for either.
+static inline void cpu_events(cpu_t *cpu) {
+  if (cpu->clock.cycles >= cpu->scheduler.next_event)
+    cpu_service(cpu);
+}
+
+// Charge an instruction's T-states once its handler has run. A conditional
+// instruction that left the PC anywhere but the next instruction took its
+// branch; a branch to the next instruction is charged as not taken. Events
+// that fell due during the instruction run before the next one.
+static inline void cpu_charge(cpu_t *cpu, uint16_t next, uint8_t tstates,
+                              uint8_t tstates_taken) {
+  cpu->clock.cycles +=
+      cpu->registers.pc == next ? tstates : tstates_taken;
+  cpu_events(cpu);
+}
+
 #endif
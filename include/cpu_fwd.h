@@ -21,5 +21,8 @@
 #define CPU_FWD_H
 
 typedef struct cpu cpu_t;
+typedef struct block block_t;
+typedef struct block_cache block_cache_t;
+typedef struct jit jit_t;
 
 #endif
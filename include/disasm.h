@@ -0,0 +1,37 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef DISASM_H
+#define DISASM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cpu_fwd.h"
+
+// Format one encoded instruction using the opcode_table labels, with the
+// operand bytes substituted. Returns the snprintf length of the text, or -1
+// when the bytes are too short or match no label.
+int disasm_format(const uint8_t *bytes, uint8_t length, char *text,
+                  size_t size);
+
+// Format cpu->last_instruction; -1 before anything has run.
+int disasm_last(cpu_t *cpu, char *text, size_t size);
+
+#endif
@@ -0,0 +1,39 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef FLAG_TABLES_H
+#define FLAG_TABLES_H
+
+#include <stdint.h>
+
+// Flag lookup tables generated at build time by tools/gen_flag_tables.c.
+// Entries hold S, Z, H, PV, N and C; bits 3 and 5 are always clear.
+
+// S, Z and PV (even parity) of an 8-bit result.
+extern const uint8_t flags_szp[0x100];
+
+// ADD/ADC and SUB/SBC/CP flags, indexed by FLAG_TABLE_INDEX.
+extern const uint8_t flags_add[0x20000];
+extern const uint8_t flags_sub[0x20000];
+
+#define FLAG_TABLE_INDEX(a, value, carry)                                      \
+  ((unsigned)(carry) << 16 | (unsigned)(uint8_t)(a) << 8 |                     \
+   (unsigned)(uint8_t)(value))
+
+#endif
@@ -0,0 +1,58 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef FLAGS_H
+#define FLAGS_H
+
+#include <stdint.h>
+
+#include "cpu_fwd.h"
+
+// ALU operations whose flag results can be deferred. The partial kinds
+// (ADD16_HL, INC, DEC, BIT) keep some of the previous flags.
+#define FLAGS_NONE 0
+#define FLAGS_ADD 1
+#define FLAGS_SUB 2
+#define FLAGS_ADD16 3
+#define FLAGS_SUB16 4
+#define FLAGS_ADD16_HL 5
+#define FLAGS_LOGIC 6
+#define FLAGS_ROTATE 7
+#define FLAGS_INC 8
+#define FLAGS_DEC 9
+#define FLAGS_BIT 10 // result is the tested bit masked out of the value
+
+typedef struct {
+  uint8_t kind;    // FLAGS_NONE when F is up to date
+  uint8_t carry;   // Carry in; H for LOGIC, carry out for ROTATE
+  uint16_t a;      // First operand
+  uint16_t value;  // Second operand (INC/DEC: the value before the op)
+  uint16_t result;
+  int32_t wide;    // Untruncated sum or difference
+} flags_pending_t;
+
+// Record an operation's flag inputs. In lazy mode F is only computed when
+// something reads it; otherwise it is written straight away.
+void flags_record(cpu_t *cpu, uint8_t kind, uint16_t a, uint16_t value,
+                  uint8_t carry, uint16_t result, int32_t wide);
+
+// Write any pending flags into F.
+void flags_materialize(cpu_t *cpu);
+
+#endif
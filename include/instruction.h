@@ -17,103 +17,49 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#ifndef INSTRUCTION_H
+#define INSTRUCTION_H
+
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-#include "cpu_fwd.h"
+#include "cpu.h"
+
+// Operand bytes fetched by instruction_decode, described per table entry.
+#define OPERAND_NONE 0x00
+#define OPERAND_D 0x01  // Index displacement
+#define OPERAND_N 0x02  // Immediate byte (follows D when both are present)
+#define OPERAND_NN 0x04 // Immediate little-endian word
+#define OPERAND_UNINDEXED 0x08 // DD/FD prefix ignored: run the plain opcode
+
+typedef struct {
+  uint16_t op_code;  // Prefix in the high byte (ED/DD/FD), 0 otherwise
+  uint8_t index_reg; // REG_IX/REG_IY after DD/FD, REG_HL otherwise
+  uint8_t d;
+  uint8_t n;
+  uint16_t nn;
+  uint8_t length; // Encoded length in bytes, including prefixes
+} instruction_operands_t;
 
-typedef enum {
-    I_NOP,
-    I_LOAD_R_R,
-    I_LOAD_R_N,
-    I_LOAD_R_HL,
-    I_LOAD_R_IDX,
-    I_LOAD_HL_R,
-    I_LOAD_HL_N,
-    I_LOAD_IDX_R,
-    I_LOAD_IDX_N,
-    I_LOAD_A_MEM,
-    I_LOAD_A_RR,
-    I_LOAD_MEM_A,
-    I_LOAD_RR_A,
-    I_LOAD_A_I,
-    I_LOAD_A_R_REG,
-    I_LOAD_I_A,
-    I_LOAD_R_REG_A,
-    I_LOAD_RR_NN,
-    I_LOAD_RR_MEM,
-    I_LOAD_MEM_RR,
-    I_LOAD_SP_RR,
-    I_LOAD_SP_MEM,
-    I_LOAD_MEM_SP,
-    I_PUSH,
-    I_POP,
-    I_ADD_A_R,
-    I_ADD_A_N,
-    I_ADD_A_IDX,
-    I_ADC_A_R,
-    I_ADC_A_N,
-    I_ADC_A_IDX,
-    I_SUB_R,
-    I_SUB_N,
-    I_SUB_IDX,
-    I_SBC_A_R,
-    I_SBC_A_N,
-    I_SBC_A_IDX,
-    I_INC_R,
-    I_INC_HL,
-    I_INC_IDX,
-    I_DEC_R,
-    I_DEC_HL,
-    I_DEC_IDX,
-    I_AND_R,
-    I_AND_N,
-    I_AND_IDX,
-    I_OR_R,
-    I_OR_N,
-    I_OR_IDX,
-    I_XOR_R,
-    I_XOR_N,
-    I_XOR_IDX,
-    I_CP_R,
-    I_CP_N,
-    I_CP_IDX,
-    I_JR,
-    I_JP,
-    I_CALL,
-    I_RET,
-    I_RST,
-    I_ADD_HL_RR,
-    I_ADD_IX_IY_RR,
-    I_ADC_HL_RR,
-    I_SBC_HL_RR,
-    I_INC_RR,
-    I_DEC_RR,
-    I_DAA,
-    I_CPL,
-    I_NEG,
-    I_CCF,
-    I_SCF,
-    I_HALT,
-    I_DI,
-    I_EI,
-    I_IM,
-    I_BLKT,
-    I_BLKS,
-    I_EX,
-    I_U // Undefined or unused
-} instruction_group_t;
+typedef cpu_exit_t (*instruction_handler_t)(cpu_t *cpu,
+                                            const instruction_operands_t *ops);
 
 typedef struct {
-uint16_t op_code;
-instruction_group_t group;
-const char *label;
-} instruction_map_t;
+  instruction_handler_t handler;
+  uint8_t operands;      // OPERAND_* bits
+  uint8_t tstates;       // T-states; branch not taken or last iteration
+  uint8_t tstates_taken; // T-states for a taken branch or a repeat
+} instruction_entry_t;
 
-instruction_group_t instruction_group_get(uint16_t);
-void instruction_map_init(void);
+const instruction_entry_t *instruction_decode(cpu_t *cpu, uint16_t address,
+                                              instruction_operands_t *ops);
+
+#ifdef RAVELOXZEMU_THREADED
+// Computed-goto run loop used by cpu_run when no breakpoints are set.
+cpu_exit_t instruction_run_threaded(cpu_t *cpu, uint64_t max_instructions);
+#endif
 
 void _load_r_r(cpu_t *cpu, uint8_t, uint8_t);
 void _load_r_from_mem(cpu_t *cpu, uint8_t reg, uint16_t address);
@@ -173,6 +119,7 @@ void inst_cp_r(cpu_t *cpu, uint8_t op_code);
 void inst_cp_n(cpu_t *cpu, uint8_t value);
 void inst_cp_idx(cpu_t *cpu, uint8_t index_reg, uint8_t d);
 void inst_jr(cpu_t *cpu, uint8_t op_code, uint8_t displacement);
+void inst_djnz(cpu_t *cpu, uint8_t displacement);
 void inst_jp(cpu_t *cpu, uint16_t op_code, uint16_t address);
 void inst_call(cpu_t *cpu, uint16_t op_code, uint16_t address);
 void inst_ret(cpu_t *cpu, uint16_t op_code);
@@ -188,12 +135,26 @@ void inst_cpl(cpu_t *cpu);
 void inst_neg(cpu_t *cpu);
 void inst_ccf(cpu_t *cpu);
 void inst_scf(cpu_t *cpu);
+void inst_rot_a(cpu_t *cpu, uint8_t op_code);
 void inst_halt(cpu_t *cpu);
 void inst_di(cpu_t *cpu);
 void inst_ei(cpu_t *cpu);
 void inst_im(cpu_t *cpu, uint8_t mode);
+void inst_retn(cpu_t *cpu);
+void inst_load_a_ir(cpu_t *cpu, uint8_t source);
 void inst_cb(cpu_t *cpu, uint8_t op_code, uint8_t use_index, uint8_t index_reg,
              uint8_t d);
 
-void inst_blkt(cpu_t *cpu, uint16_t);
-void inst_blks(cpu_t *cpu, uint16_t);
+void inst_in(cpu_t *cpu, uint16_t op_code, uint16_t port);
+void inst_out(cpu_t *cpu, uint16_t op_code, uint16_t port);
+
+// Block transfer and search run up to limit iterations and return how many
+// ran. None of them repeat by themselves; the op_* handlers wind the PC
+// back so each iteration ends at an instruction boundary.
+uint32_t inst_blkt(cpu_t *cpu, uint16_t op_code, uint32_t limit);
+uint32_t inst_blks(cpu_t *cpu, uint16_t op_code, uint32_t limit);
+void inst_blkio(cpu_t *cpu, uint16_t op_code);
+void inst_rld(cpu_t *cpu);
+void inst_rrd(cpu_t *cpu);
+
+#endif
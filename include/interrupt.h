@@ -0,0 +1,56 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef INTERRUPT_H
+#define INTERRUPT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "cpu_fwd.h"
+
+// T-states taken to accept each kind of interrupt, on top of the
+// instruction that ran before it.
+#define INTERRUPT_NMI_TSTATES 11
+#define INTERRUPT_IM0_TSTATES 13
+#define INTERRUPT_IM1_TSTATES 13
+#define INTERRUPT_IM2_TSTATES 19
+
+typedef struct {
+    bool iff1;      // Maskable interrupts accepted
+    bool iff2;      // Copy of iff1 kept across an NMI, restored by RETN
+    uint8_t mode;   // IM 0, 1 or 2
+    bool ei_delay;  // EI ran last; INT waits one more instruction
+    bool line;      // INT held active by a device
+    uint8_t data;   // Byte on the data bus during the INT acknowledge
+    bool nmi;       // NMI edge latched, not yet accepted
+    uint64_t accepted; // Maskable interrupts accepted
+    uint64_t nmis;     // NMIs accepted
+} z80_interrupt_t;
+
+int interrupt_init(cpu_t *cpu);
+void interrupt_poll(cpu_t *cpu);
+void interrupt_raise(cpu_t *cpu, uint8_t data);
+void interrupt_clear(cpu_t *cpu);
+void interrupt_nmi(cpu_t *cpu);
+bool interrupt_pending(cpu_t *cpu);
+bool interrupt_can_wake(cpu_t *cpu);
+void interrupt_accept(cpu_t *cpu);
+
+#endif
@@ -0,0 +1,47 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef JIT_H
+#define JIT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cpu_fwd.h"
+
+// Block visits before a translation is attempted.
+#define JIT_HOT_ENTRIES 16
+// Invalidations after which a page is treated as self-modifying and its
+// blocks are left to the interpreter.
+#define JIT_VOLATILE_WRITES 4
+#define JIT_BUFFER_SIZE (4u << 20)
+
+struct jit {
+  uint8_t *buffer; // mmap'd code buffer, finished pages read/execute only
+  size_t used;
+  size_t page_size;
+  uint64_t translated;
+  uint64_t refused;
+};
+
+int jit_init(cpu_t *cpu);
+void jit_destroy(cpu_t *cpu);
+int jit_translate(cpu_t *cpu, block_t *block);
+
+#endif
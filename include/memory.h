@@ -20,6 +20,7 @@
 #ifndef MEMORY_H
 #define MEMORY_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -27,21 +28,168 @@
 
 #include "cpu_fwd.h"
 
+// The 64 KiB address space is built from MEMORY_PAGE_SIZE pages. Each page
+// has its backing bytes (data), the pointer plain reads use (read) and the
+// pointer plain writes use (write). RAM points both at data. ROM and
+// unmapped pages point write at a shared sink page, so a write to them is
+// the same single store as a write to RAM and is simply lost. A NULL
+// pointer sends that kind of access through the checking path in memory.c.
+//
+// Pages are 4 KiB, so switching a 16 KiB bank rewrites four pages.
+#define MEMORY_PAGE_SHIFT 12
+#define MEMORY_PAGE_SIZE (1u << MEMORY_PAGE_SHIFT)
+#define MEMORY_PAGE_MASK (MEMORY_PAGE_SIZE - 1)
+#define MEMORY_PAGES (0x10000u >> MEMORY_PAGE_SHIFT)
+
+// Page flags. A page with neither RAM nor ROM is unmapped: it reads as
+// 0xFF and drops writes.
+#define MEMORY_RAM 0x01
+#define MEMORY_ROM 0x02
+#define MEMORY_MMIO 0x04  // Accesses go to device callbacks
+#define MEMORY_WATCH 0x08 // Accesses are checked against watchpoints
+#define MEMORY_READONLY 0x10 // Backed by a read-only file mapping
+#define MEMORY_CODE 0x20 // Holds cached blocks; RAM writes check the cache
+
+// File images mapped with memory_image_open.
+#define MEMORY_IMAGES 8
+
 typedef struct {
-  uint16_t size;
-  char *memory;
+  uint8_t *base;
+  uint32_t size; // File length rounded up to whole pages
+  uint8_t type;  // MEMORY_RAM or MEMORY_ROM
+} memory_image_t;
+
+// Memory-mapped devices registered with memory_mmio_add.
+#define MEMORY_MMIO_REGIONS 16
+
+typedef uint8_t (*memory_mmio_read_t)(void *context, uint16_t address);
+typedef void (*memory_mmio_write_t)(void *context, uint16_t address,
+                                    uint8_t value);
+
+typedef struct {
+  bool used;
+  uint16_t start;
+  uint32_t length;
+  memory_mmio_read_t read;   // NULL: reads come from the page's bytes
+  memory_mmio_write_t write; // NULL: writes go to the page's bytes
+  void *context;
+} memory_mmio_t;
+
+// Watchpoint kinds, per byte.
+#define MEMORY_WATCH_READ 0x01   // Any read, instruction fetches included
+#define MEMORY_WATCH_WRITE 0x02  // Any write
+#define MEMORY_WATCH_CHANGE 0x04 // A write that changes the byte
+
+// The first watchpoint hit since it was last cleared. Reads report the
+// value read as both old and new.
+typedef struct {
+  bool hit;
+  uint8_t kind;
+  uint16_t address;
+  uint8_t old_value;
+  uint8_t new_value;
+} memory_watch_hit_t;
+
+typedef struct {
+  uint8_t *read[MEMORY_PAGES];
+  uint8_t *write[MEMORY_PAGES];
+  uint8_t *data[MEMORY_PAGES];
+  uint8_t flags[MEMORY_PAGES];
+  uint32_t size; // Bytes in the physical pool
+  uint8_t *pool; // Physical memory that RAM and ROM pages map into
+  uint8_t *sink;     // Write target for ROM and unmapped pages
+  uint8_t *open_bus; // Backing for unmapped pages, all 0xFF
+  memory_image_t images[MEMORY_IMAGES];
+  uint8_t image_count;
+  memory_mmio_t mmio[MEMORY_MMIO_REGIONS];
+  uint64_t slow_accesses; // Accesses that took the checking path
+  bool observe;           // Record last_mem_read/write, see memory_observe
+  uint8_t *watch;         // Watchpoint kinds per byte, allocated on first use
+  uint32_t watch_count;   // Bytes with a watchpoint
+  uint16_t watch_pages[MEMORY_PAGES]; // The same, per page
+  memory_watch_hit_t watch_hit;
+  uint32_t dirty; // Bit per page written since memory_dirty_clear
 } z80_memory_t;
 
-int memory_init(cpu_t *cpu, uint16_t);
+// Allocates a physical pool of memory_size bytes, which may exceed 64 KiB,
+// and maps as much of it as fits from address 0 as RAM.
+int memory_init(cpu_t *cpu, uint32_t memory_size);
 int memory_destroy(cpu_t *cpu);
 
-uint16_t memory_get_size(cpu_t *cpu);
+// Map length bytes of the pool from physical offset onto address, as
+// MEMORY_RAM or MEMORY_ROM. Address, length and offset must be whole pages.
+// Only page pointers change, so a bank switch copies nothing.
+int memory_map(cpu_t *cpu, uint16_t address, uint32_t length,
+               uint32_t offset, uint8_t type);
+int memory_unmap(cpu_t *cpu, uint16_t address, uint32_t length);
+
+// Map a file into the host address space without reading it, and return
+// its image number. A MEMORY_ROM image is mapped read-only and shared, so
+// every instance using the same ROM shares its pages. A MEMORY_RAM image is
+// mapped private: guest writes copy the touched host page and never reach
+// the file. Images stay mapped until memory_destroy.
+int memory_image_open(cpu_t *cpu, const char *path, uint8_t type);
+uint32_t memory_image_size(cpu_t *cpu, int image);
+// memory_map for a window of an image instead of the pool.
+int memory_map_image(cpu_t *cpu, int image, uint16_t address,
+                     uint32_t length, uint32_t offset);
+
+uint32_t memory_get_size(cpu_t *cpu);
 
 int memory_load(cpu_t *cpu, const uint8_t *buffer, size_t length);
 int memory_load_at(cpu_t *cpu, const uint8_t *buffer, size_t length,
                    uint16_t offset);
 
-int memory_set(cpu_t *cpu, uint16_t, uint8_t);
-uint8_t memory_get(cpu_t *cpu, uint16_t);
+// memory_get and memory_set are inline in cpu.h: one load or store through
+// the page pointer, falling back to these for pages whose pointer is NULL.
+uint8_t memory_get_slow(cpu_t *cpu, uint16_t address);
+void memory_set_slow(cpu_t *cpu, uint16_t address, uint8_t value);
+
+// Record the address of every access in last_mem_read/last_mem_write for
+// the register display. This sends every page through the checking path,
+// so only the debugger turns it on.
+void memory_observe(cpu_t *cpu, bool observe);
+
+// Recompute MEMORY_CODE for the page holding address after the block cache
+// adds or drops blocks there.
+void memory_code_update(cpu_t *cpu, uint16_t address);
+
+// Read or write a page's backing bytes with no side effects: no device
+// callbacks, watchpoints or access tracking, and ROM is writable. For
+// loaders, dumps and the debugger.
+uint8_t memory_peek(cpu_t *cpu, uint16_t address);
+int memory_poke(cpu_t *cpu, uint16_t address, uint8_t value);
+
+int memory_set_rom(cpu_t *cpu, uint16_t address, uint32_t length, bool rom);
+uint8_t memory_page_flags(cpu_t *cpu, uint16_t address);
+
+// Send accesses to [address, address + length) to device callbacks and
+// return the region number. Only the pages the range touches are flagged
+// MEMORY_MMIO and leave the fast path; other bytes on those pages still
+// read and write memory. The mapping follows the address, not the bank.
+int memory_mmio_add(cpu_t *cpu, uint16_t address, uint32_t length,
+                    memory_mmio_read_t read, memory_mmio_write_t write,
+                    void *context);
+int memory_mmio_remove(cpu_t *cpu, int region);
+
+// Add or remove watchpoint kinds on [address, address + length). Pages with
+// a watched byte are flagged MEMORY_WATCH and take the checking path, which
+// records the first hit in memory.watch_hit; cpu_step and cpu_run then stop
+// with CPU_EXIT_WATCHPOINT after the instruction.
+int memory_watch_set(cpu_t *cpu, uint16_t address, uint32_t length,
+                     uint8_t kinds);
+int memory_watch_clear(cpu_t *cpu, uint16_t address, uint32_t length,
+                       uint8_t kinds);
+uint8_t memory_watch_get(cpu_t *cpu, uint16_t address);
+
+// Pages whose contents changed, one bit per page (bit n covers addresses
+// n << MEMORY_PAGE_SHIFT onwards). Every page starts dirty. Clearing a RAM
+// page points its write pointer at the checking path, whose first write
+// marks it dirty again and restores the plain pointer, so tracking costs
+// one slow write per page per clear. Loads, pokes and remaps mark pages
+// dirty too.
+uint32_t memory_dirty_pages(cpu_t *cpu);
+bool memory_page_dirty(cpu_t *cpu, uint16_t address);
+void memory_dirty_clear(cpu_t *cpu, uint32_t pages);
 
 #endif
@@ -27,9 +27,12 @@ typedef struct {
   uint8_t bytes[4];
   uint8_t length;
   uint8_t has_displacement;
+  uint8_t tstates;       // Branch not taken or last iteration
+  uint8_t tstates_taken; // Branch taken or repeating
   const char *label;
 } opcode_info_t;
 
+// Generated from src/op_codes.txt by tools/gen_opcode_tables.c.
 extern const opcode_info_t opcode_table[];
 extern const size_t opcode_table_size;
 
@@ -59,6 +59,37 @@ typedef union {
 #define REG_COUNT 9
 #define REG_MASK 0x0F
 
+// Pair views overlay the bytes the same way z80_register_t does, so the
+// tagged API, the debugger and the JIT can keep indexing pairs[] by REG_*.
+// The f field is only current after flags_materialize().
+#define REGISTER_PAIR(hi, lo, pair)                                            \
+  union {                                                                      \
+    uint16_t pair;                                                             \
+    struct {                                                                   \
+      uint8_t lo;                                                              \
+      uint8_t hi;                                                              \
+    };                                                                         \
+  }
+
+typedef union {
+  z80_register_t pairs[REG_COUNT];
+  struct {
+    REGISTER_PAIR(a, f, af);
+    REGISTER_PAIR(b, c, bc);
+    REGISTER_PAIR(d, e, de);
+    REGISTER_PAIR(h, l, hl);
+    REGISTER_PAIR(i, r, ir);
+    uint16_t ix;
+    uint16_t iy;
+    uint16_t sp;
+    uint16_t pc;
+  };
+} z80_register_file_t;
+
+_Static_assert(sizeof(z80_register_file_t) ==
+                   REG_COUNT * sizeof(z80_register_t),
+               "named register fields must overlay pairs[]");
+
 #define FLAG_S 7
 #define FLAG_Z 6
 #define FLAG_H 4
@@ -97,6 +128,32 @@ uint8_t register_bit_get(cpu_t *cpu, uint8_t, uint8_t);
 
 uint8_t register_map(uint8_t index);
 
+// Unchecked hot-path accessors. The index must be a valid REG_* value and
+// must not name F or AF: those go through register_value_get/set so the
+// lazy flags stay coherent.
+static inline uint16_t register_file_get(const z80_register_file_t *regs,
+                                         uint8_t index) {
+  const z80_register_t *reg = &regs->pairs[index & REG_MASK];
+
+  if (index & HIGH_BYTE)
+    return reg->bytes.high;
+  if (index & LOW_BYTE)
+    return reg->bytes.low;
+  return reg->word;
+}
+
+static inline void register_file_set(z80_register_file_t *regs, uint8_t index,
+                                     uint16_t value) {
+  z80_register_t *reg = &regs->pairs[index & REG_MASK];
+
+  if (index & HIGH_BYTE)
+    reg->bytes.high = (uint8_t)value;
+  else if (index & LOW_BYTE)
+    reg->bytes.low = (uint8_t)value;
+  else
+    reg->word = value;
+}
+
 void register_swap_single(cpu_t *cpu, uint8_t);
 void register_exx(cpu_t *cpu);
 void register_ex_de_hl(cpu_t *cpu);
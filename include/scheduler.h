@@ -0,0 +1,67 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+
+#include "cpu_fwd.h"
+
+// Events fire once clock.cycles reaches their T-state. The run loops only
+// compare the cycle count against next_event after each instruction (or
+// native block), so the cost per instruction does not grow with the number
+// of devices. next_event may be earlier than the first event (interrupt.c
+// sets it to 0 to be polled); cpu_service recomputes it. A callback may
+// schedule or cancel events; a periodic device schedules its next event at
+// when + period.
+typedef void (*scheduler_callback_t)(cpu_t *cpu, void *context,
+                                     uint64_t when);
+
+typedef struct {
+    uint64_t when;  // T-state the event is due
+    uint64_t seq;   // Insertion order, breaks ties on when
+    int id;
+    scheduler_callback_t callback;
+    void *context;
+} scheduler_event_t;
+
+typedef struct {
+    scheduler_event_t *events; // Binary min-heap on (when, seq)
+    uint32_t count;
+    uint32_t capacity;
+    uint64_t next_event; // Deadline the run loops compare against
+    uint64_t seq;
+    int next_id;
+    uint64_t dispatched; // Callbacks run since scheduler_init
+} z80_scheduler_t;
+
+#define SCHEDULER_NONE UINT64_MAX
+
+int scheduler_init(cpu_t *cpu);
+void scheduler_destroy(cpu_t *cpu);
+int scheduler_at(cpu_t *cpu, uint64_t when, scheduler_callback_t callback,
+                 void *context);
+int scheduler_after(cpu_t *cpu, uint64_t tstates,
+                    scheduler_callback_t callback, void *context);
+int scheduler_cancel(cpu_t *cpu, int id);
+void scheduler_dispatch(cpu_t *cpu);
+uint64_t scheduler_next(cpu_t *cpu);
+
+#endif
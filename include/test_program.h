@@ -26,4 +26,7 @@
 extern const uint8_t test_program[];
 extern const size_t test_program_size;
 
+extern const uint8_t bench_program[];
+extern const size_t bench_program_size;
+
 #endif
@@ -0,0 +1,67 @@
+#!/bin/sh
+#
+# This file is part of raveloxzemu.
+#
+# Copyright (C) 2026 Dave Kelly
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+# Build the table and threaded cores in Release mode and compare their
+# headless instruction rates (block cache off, block cache on, and with the
+# JIT) on the built-in test program and the built-in dispatch benchmark loop.
+# Every core must retire the same instructions and T-states.
+#
+# Usage: scripts/bench.sh [build_root]
+
+set -e
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+BUILD=${1:-"$ROOT/build-bench"}
+
+cmake -S "$ROOT" -B "$BUILD/table" -DCMAKE_BUILD_TYPE=Release \
+  -DRAVELOXZEMU_THREADED=OFF >/dev/null
+cmake --build "$BUILD/table" >/dev/null
+cmake -S "$ROOT" -B "$BUILD/threaded" -DCMAKE_BUILD_TYPE=Release \
+  -DRAVELOXZEMU_THREADED=ON >/dev/null
+cmake --build "$BUILD/threaded" >/dev/null
+
+rate() {
+  # The test program is not expected to HALT, so ignore the exit status.
+  "$@" | awk '/^Instructions:/ { n = $2 } /^T-states:/ { t = $2 }
+              /^Rate:/ { r = $2 }
+              END { printf "%12s %12s %14s", n, t, r }' || true
+}
+
+printf "%-10s %-10s %12s %12s %14s\n" core program instructions T-states \
+  "instr/s"
+for core in table threaded blocks jit; do
+  dir=$core
+  flags=--no-block-cache
+  case $core in
+  blocks)
+    dir=table
+    flags=
+    ;;
+  jit)
+    dir=table
+    flags=--jit
+    ;;
+  esac
+  printf "%-10s %-10s " "$core" test
+  rate "$BUILD/$dir/raveloxzemu" --headless $flags
+  echo
+  printf "%-10s %-10s " "$core" loop
+  rate "$BUILD/$dir/raveloxzemu" --bench $flags
+  echo
+done
@@ -0,0 +1,399 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "block.h"
+#include "instruction.h"
+#include "jit.h"
+
+int block_cache_init(cpu_t *cpu) {
+  block_cache_t *cache = NULL;
+
+  if (!cpu)
+    return -1;
+  if (cpu->blocks)
+    return 0;
+
+  cache = (block_cache_t *)calloc(1, sizeof(block_cache_t));
+  if (!cache) {
+    fprintf(stderr, "Cannot allocate block cache\n");
+    return -1;
+  }
+
+  cache->lookup = (block_t **)calloc(0x10000, sizeof(block_t *));
+  if (!cache->lookup) {
+    fprintf(stderr, "Cannot allocate block lookup table\n");
+    free(cache);
+    return -1;
+  }
+
+  cpu->blocks = cache;
+  return 0;
+}
+
+void block_cache_destroy(cpu_t *cpu) {
+  if (!cpu || !cpu->blocks)
+    return;
+
+  block_cache_flush(cpu);
+  free(cpu->blocks->lookup);
+  free(cpu->blocks);
+  cpu->blocks = NULL;
+}
+
+void block_cache_flush(cpu_t *cpu) {
+  block_cache_t *cache = NULL;
+
+  if (!cpu || !cpu->blocks)
+    return;
+
+  cache = cpu->blocks;
+  for (uint32_t address = 0; address < 0x10000; address++) {
+    if (cache->lookup[address]) {
+      free(cache->lookup[address]);
+      cache->lookup[address] = NULL;
+      cache->invalidated++;
+    }
+  }
+  memset(cache->code_pages, 0, sizeof(cache->code_pages));
+  memset(cache->page_writes, 0, sizeof(cache->page_writes));
+  cache->generation++;
+  for (uint32_t address = 0; address < 0x10000; address += MEMORY_PAGE_SIZE)
+    memory_code_update(cpu, (uint16_t)address);
+}
+
+// Drop every block overlapping the page holding address. Blocks never exceed
+// BLOCK_MAX_BYTES, so only starts from that far below the page can reach it.
+// Addresses wrap at 64K, as the PC does.
+void block_cache_invalidate(cpu_t *cpu, uint16_t address) {
+  block_cache_t *cache = NULL;
+  uint16_t page_start = (uint16_t)(address & ~((1u << BLOCK_PAGE_SHIFT) - 1));
+  uint16_t start = (uint16_t)(page_start - BLOCK_MAX_BYTES);
+
+  if (!cpu || !cpu->blocks)
+    return;
+
+  cache = cpu->blocks;
+  for (uint32_t i = 0; i < BLOCK_MAX_BYTES + (1u << BLOCK_PAGE_SHIFT);
+       i++, start++) {
+    block_t *block = cache->lookup[start];
+
+    if (!block || (i < BLOCK_MAX_BYTES &&
+                   (uint16_t)(page_start - start) >= block->length))
+      continue;
+    free(block);
+    cache->lookup[start] = NULL;
+    cache->invalidated++;
+  }
+
+  cache->code_pages[page_start >> BLOCK_PAGE_SHIFT] = 0;
+  memory_code_update(cpu, page_start);
+  if (cache->page_writes[page_start >> BLOCK_PAGE_SHIFT] < UINT8_MAX)
+    cache->page_writes[page_start >> BLOCK_PAGE_SHIFT]++;
+  cache->generation++;
+}
+
+// True for instructions that may leave PC anywhere other than the next
+// instruction, plus DI/EI, which change what may happen between instructions.
+// Looks at bytes instruction_decode has already fetched, so it peeks rather
+// than fetching them again.
+static bool block_ends_at(cpu_t *cpu, uint16_t address) {
+  uint8_t op = memory_peek(cpu, address);
+  uint8_t next = memory_peek(cpu, (uint16_t)(address + 1));
+
+  switch (op) {
+  case 0xDD:
+  case 0xFD:
+    // JP (IX)/(IY), or a branch that runs with the prefix ignored.
+    return next != 0xDD && next != 0xFD &&
+           block_ends_at(cpu, (uint16_t)(address + 1));
+  case 0xED:
+    return (next & 0xC7) == 0x45 || // RETN/RETI
+           (next & 0xF4) == 0xB0;   // LDIR/CPIR/INIR/OTIR and decrementing
+  case 0x10: // DJNZ
+  case 0x18: // JR
+  case 0x76: // HALT
+  case 0xC3: // JP
+  case 0xC9: // RET
+  case 0xCD: // CALL
+  case 0xE9: // JP (HL)
+  case 0xF3: // DI
+  case 0xFB: // EI
+    return true;
+  default:
+    break;
+  }
+
+  return (op & 0xE7) == 0x20 || // JR cc
+         (op & 0xC7) == 0xC0 || // RET cc
+         (op & 0xC7) == 0xC2 || // JP cc
+         (op & 0xC7) == 0xC4 || // CALL cc
+         (op & 0xC7) == 0xC7;   // RST
+}
+
+// True for instructions that write nothing but registers and flags: loads
+// into registers, register and immediate ALU ops, BIT and jumps. A block made
+// of these that loops back to itself unchanged is waiting on something else.
+static bool block_is_pure(cpu_t *cpu, uint16_t address) {
+  uint8_t op = memory_peek(cpu, address);
+
+  if (op == 0xCB)
+    return (memory_peek(cpu, (uint16_t)(address + 1)) & 0xC0) == 0x40; // BIT
+  if (op >= 0x40 && op <= 0x7F)
+    return op < 0x70 || op > 0x77; // LD r,r' but not LD (HL),r or HALT
+  if (op >= 0x80 && op <= 0xBF)
+    return true; // ALU A,r
+  switch (op) {
+  case 0x00: // NOP
+  case 0x0A: // LD A,(BC)
+  case 0x1A: // LD A,(DE)
+  case 0x2A: // LD HL,(nn)
+  case 0x3A: // LD A,(nn)
+  case 0x18: // JR
+  case 0xC3: // JP
+    return true;
+  default:
+    break;
+  }
+
+  if (op == 0x34 || op == 0x35 || op == 0x36) // INC/DEC/LD (HL)
+    return false;
+  return (op & 0xCF) == 0x01 || // LD rr,nn
+         (op & 0xC7) == 0x03 || // INC/DEC rr
+         (op & 0xC6) == 0x04 || // INC/DEC r
+         (op & 0xC7) == 0x06 || // LD r,n
+         (op & 0xE7) == 0x20 || // JR cc
+         (op & 0xC7) == 0xC2 || // JP cc
+         (op & 0xC7) == 0xC6;   // ALU A,n
+}
+
+static block_t *block_build(cpu_t *cpu, uint16_t start) {
+  block_cache_t *cache = cpu->blocks;
+  block_instruction_t decoded[BLOCK_MAX_INSTRUCTIONS];
+  uint32_t address = start;
+  uint8_t count = 0;
+  bool pure = true;
+  block_t *block = NULL;
+
+  while (count < BLOCK_MAX_INSTRUCTIONS) {
+    bool ends = false;
+    const instruction_entry_t *entry =
+        instruction_decode(cpu, (uint16_t)address, &decoded[count].ops);
+
+    // Stop short of undefined opcodes; they are reported by the next lookup.
+    if (!entry)
+      break;
+
+    decoded[count].handler = entry->handler;
+    decoded[count].tstates = entry->tstates;
+    decoded[count].tstates_taken = entry->tstates_taken;
+    ends = block_ends_at(cpu, (uint16_t)address);
+    pure = pure && block_is_pure(cpu, (uint16_t)address);
+    address += decoded[count].ops.length;
+    count++;
+    if (ends)
+      break;
+  }
+
+  if (count == 0)
+    return NULL;
+
+  block = (block_t *)malloc(sizeof(block_t) +
+                            count * sizeof(block_instruction_t));
+  if (!block) {
+    fprintf(stderr, "Cannot allocate block at %04X\n", start);
+    return NULL;
+  }
+
+  block->start = start;
+  block->length = (uint16_t)(address - start);
+  block->count = count;
+  block->native_failed = false;
+  block->pure = pure;
+  block->entries = 0;
+  block->native = NULL;
+  memcpy(block->instructions, decoded, count * sizeof(block_instruction_t));
+
+  // Writes to RAM on these pages now take the checking path, which
+  // invalidates the block.
+  for (uint32_t offset = 0; offset < block->length;
+       offset += 1u << BLOCK_PAGE_SHIFT) {
+    cache->code_pages[(uint16_t)(start + offset) >> BLOCK_PAGE_SHIFT] = 1;
+    memory_code_update(cpu, (uint16_t)(start + offset));
+  }
+  cache->code_pages[(uint16_t)(address - 1) >> BLOCK_PAGE_SHIFT] = 1;
+  memory_code_update(cpu, (uint16_t)(address - 1));
+
+  cache->lookup[start] = block;
+  cache->built++;
+  return block;
+}
+
+// State at the start of a pure block, for spotting an idle loop.
+typedef struct {
+  bool armed;
+  z80_register_file_t registers;
+  uint64_t cycles;
+  uint64_t instructions;
+  uint64_t dispatched;
+  uint64_t slow_accesses;
+} block_idle_t;
+
+static void block_idle_arm(cpu_t *cpu, const block_t *block,
+                           block_idle_t *idle) {
+  idle->armed = cpu->idle_detect && block->pure &&
+                cpu->clock.cycles < cpu->scheduler.next_event &&
+                cpu->scheduler.next_event != SCHEDULER_NONE;
+  if (!idle->armed)
+    return;
+
+  flags_materialize(cpu);
+  idle->registers = cpu->registers;
+  idle->cycles = cpu->clock.cycles;
+  idle->instructions = cpu->instructions;
+  idle->dispatched = cpu->scheduler.dispatched;
+  idle->slow_accesses = cpu->memory.slow_accesses;
+}
+
+// A pure block that ran back to its own start with no event or device
+// access in between and every register as it was will do exactly the same
+// until the next event, so skip whole iterations up to the scheduler
+// deadline (within the instruction budget) and let the event run.
+static void block_idle_skip(cpu_t *cpu, uint16_t start,
+                            const block_idle_t *idle) {
+  uint64_t period = cpu->clock.cycles - idle->cycles;
+  uint64_t retired = cpu->instructions - idle->instructions;
+  uint64_t deadline = cpu->scheduler.next_event;
+  uint64_t loops = 0;
+
+  if (!idle->armed || cpu->registers.pc != start || period == 0 ||
+      retired == 0 || cpu->scheduler.dispatched != idle->dispatched ||
+      cpu->memory.slow_accesses != idle->slow_accesses ||
+      cpu->clock.cycles >= deadline)
+    return;
+
+  flags_materialize(cpu);
+  if (memcmp(&idle->registers, &cpu->registers, sizeof(cpu->registers)) != 0)
+    return;
+
+  loops = (deadline - cpu->clock.cycles + period - 1) / period;
+  if (loops > cpu_budget_left(cpu) / retired)
+    loops = cpu_budget_left(cpu) / retired;
+  if (loops == 0)
+    return;
+
+  cpu->clock.cycles += loops * period;
+  cpu->instructions += loops * retired;
+  cpu->idle_tstates += loops * period;
+  cpu_events(cpu);
+}
+
+cpu_exit_t block_run(cpu_t *cpu, uint64_t max_instructions) {
+  block_cache_t *cache = cpu->blocks;
+
+  cpu_budget_set(cpu, max_instructions);
+  while (cpu->instructions < cpu->instruction_limit) {
+    uint16_t pc = cpu->registers.pc;
+    block_t *block = cache->lookup[pc];
+    uint32_t generation = cache->generation;
+    uint16_t start = pc;
+    block_idle_t idle;
+
+    if (!block) {
+      block = block_build(cpu, pc);
+      if (!block)
+        return CPU_EXIT_UNDEFINED;
+      generation = cache->generation;
+    }
+
+    if (cpu->jit && !block->native && !block->native_failed &&
+        ++block->entries >= JIT_HOT_ENTRIES) {
+      jit_translate(cpu, block);
+      generation = cache->generation;
+      block = cache->lookup[pc];
+      if (!block)
+        continue;
+    }
+
+    block_idle_arm(cpu, block, &idle);
+
+    // Native blocks retire all their instructions or stop early on a branch,
+    // a write to cached code or an exit reason, so only enter them when the
+    // whole block fits in the budget.
+    if (block->native && cpu_budget_left(cpu) >= block->count) {
+      uint64_t result = block->native(cpu);
+      uint32_t retired = (uint32_t)result;
+      cpu_exit_t reason = (cpu_exit_t)(result >> 32);
+
+      cpu->instructions += retired;
+      // Native code does not record each instruction; recover the last one
+      // retired unless a code write may have freed the block.
+      if (retired > 0 && cache->generation == generation) {
+        uint16_t at = block->start;
+
+        for (uint32_t i = 0; i + 1 < retired; i++)
+          at = (uint16_t)(at + block->instructions[i].ops.length);
+        cpu_record_instruction(cpu, at,
+                               block->instructions[retired - 1].ops.length);
+      }
+      // Events that fell due inside the block run at its exit.
+      cpu_events(cpu);
+      if (reason != CPU_EXIT_NONE)
+        return reason;
+      block_idle_skip(cpu, start, &idle);
+      continue;
+    }
+
+    // The block may be freed by a handler that writes to its page, so
+    // nothing in it is touched once the generation moves.
+    for (uint8_t i = 0;
+         i < block->count && cpu->instructions < cpu->instruction_limit; i++) {
+      const block_instruction_t *insn = &block->instructions[i];
+      uint16_t next = (uint16_t)(pc + insn->ops.length);
+      uint8_t tstates = insn->tstates;
+      uint8_t tstates_taken = insn->tstates_taken;
+      cpu_exit_t reason;
+
+      cpu_record_instruction(cpu, pc, insn->ops.length);
+      cpu->registers.pc = next;
+      reason = insn->handler(cpu, &insn->ops);
+      if (reason == CPU_EXIT_IO) {
+        cpu->registers.pc = pc;
+        return reason;
+      }
+
+      cpu_charge(cpu, next, tstates, tstates_taken);
+      cpu->instructions++;
+      if (reason != CPU_EXIT_NONE)
+        return reason;
+      if (cache->generation != generation)
+        break;
+
+      pc = cpu->registers.pc;
+      if (pc != next)
+        break;
+    }
+    block_idle_skip(cpu, start, &idle);
+  }
+
+  return CPU_EXIT_BUDGET;
+}
@@ -17,51 +17,218 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "cpu.h"
 #include "clock.h"
 
-int clock_init(cpu_t *cpu, uint32_t delay) {
+int clock_init(cpu_t *cpu) {
   if (!cpu) {
     fprintf(stderr, "Cannot initialize clock\n");
     return -1;
   }
 
-  cpu->clock.delay = delay;
-  cpu->clock.t = 0;
+  cpu->clock.cycles = 0;
+  cpu->clock.frequency = 0;
+  cpu->clock.speed = 1.0;
+  cpu->clock.turbo = false;
+  cpu->clock.rate = 0;
+  cpu->clock.pace_ns = 0;
+  cpu->clock.pace_cycles = 0;
+  memset(&cpu->clock.drift, 0, sizeof(cpu->clock.drift));
+  clock_meter_reset(cpu);
   return 0;
 }
 
 int clock_destroy(cpu_t *cpu) {
   if (!cpu)
     return 0;
-  cpu->clock.delay = 0;
-  cpu->clock.t = 0;
+  cpu->clock.cycles = 0;
+  cpu->clock.frequency = 0;
+  cpu->clock.rate = 0;
   return 0;
 }
 
 int clock_available(cpu_t *cpu) { return (cpu != NULL); }
 
-// Fake delay function
-int clock_delay(cpu_t *cpu) {
+uint64_t clock_cycles(cpu_t *cpu) {
   if (!cpu)
-    return -1;
+    return 0;
+  return cpu->clock.cycles;
+}
 
-  if (cpu->clock.delay == 0)
+uint64_t clock_host_ns(void) {
+  struct timespec now;
+
+  if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)
     return 0;
+  return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+static void clock_update_rate(cpu_t *cpu) {
+  cpu->clock.rate = (uint64_t)(cpu->clock.frequency * cpu->clock.speed + 0.5);
+  memset(&cpu->clock.drift, 0, sizeof(cpu->clock.drift));
+  clock_pace_reset(cpu);
+}
+
+int clock_set_frequency(cpu_t *cpu, uint32_t frequency) {
+  if (!cpu)
+    return -1;
+
+  cpu->clock.frequency = frequency;
+  clock_update_rate(cpu);
+  return 0;
+}
+
+// Run at speed times the target frequency, e.g. 2.0 or 10.0.
+int clock_set_speed(cpu_t *cpu, double speed) {
+  if (!cpu || !(speed > 0))
+    return -1;
+
+  cpu->clock.speed = speed;
+  clock_update_rate(cpu);
+  return 0;
+}
+
+void clock_set_turbo(cpu_t *cpu, bool turbo) {
+  if (!cpu)
+    return;
+
+  cpu->clock.turbo = turbo;
+  clock_pace_reset(cpu);
+}
+
+bool clock_paced(cpu_t *cpu) {
+  return cpu && !cpu->clock.turbo && cpu->clock.rate > 0;
+}
+
+// Start a new paced timeline from now, for example after sitting at the
+// debugger prompt, so the idle time is not made up at full speed.
+void clock_pace_reset(cpu_t *cpu) {
+  if (!cpu)
+    return;
+
+  cpu->clock.pace_ns = clock_host_ns();
+  cpu->clock.pace_cycles = cpu->clock.cycles;
+}
+
+// Sleep until the host time matching the T-states run so far. macOS has no
+// clock_nanosleep, so it sleeps for the remaining interval instead.
+static void clock_sleep_until(uint64_t deadline, uint64_t now) {
+#if defined(TIMER_ABSTIME) && !defined(__APPLE__)
+  struct timespec until = {(time_t)(deadline / 1000000000ull),
+                           (long)(deadline % 1000000000ull)};
 
-  for (uint32_t i = 0; i < cpu->clock.delay; i++) {
+  (void)now;
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &until, NULL) ==
+         EINTR)
     continue;
+#else
+  uint64_t wait = deadline - now;
+  struct timespec interval = {(time_t)(wait / 1000000000ull),
+                              (long)(wait % 1000000000ull)};
+
+  while (nanosleep(&interval, &interval) != 0 && errno == EINTR)
+    continue;
+#endif
+}
+
+int clock_pace(cpu_t *cpu) {
+  z80_clock_t *clock = NULL;
+  uint64_t elapsed = 0;
+  uint64_t deadline = 0;
+  uint64_t now = 0;
+
+  if (!cpu)
+    return -1;
+
+  clock = &cpu->clock;
+  if (!clock_paced(cpu))
+    return 0;
+
+  elapsed = clock->cycles - clock->pace_cycles;
+  deadline = clock->pace_ns + (elapsed / clock->rate) * 1000000000ull +
+             (elapsed % clock->rate) * 1000000000ull / clock->rate;
+  now = clock_host_ns();
+  clock->drift.slices++;
+
+  if (now < deadline) {
+    clock_sleep_until(deadline, now);
+    clock->drift.sleeps++;
+    clock->drift.slept_ns += deadline - now;
+    now = clock_host_ns();
+  } else {
+    clock->drift.late++;
   }
 
+  if (now > deadline) {
+    uint64_t overrun = now - deadline;
+
+    clock->drift.drift_ns += overrun;
+    if (overrun > clock->drift.drift_max_ns)
+      clock->drift.drift_max_ns = overrun;
+    if (overrun > CLOCK_RESYNC_NS) {
+      clock->drift.resyncs++;
+      clock_pace_reset(cpu);
+    }
+  }
   return 0;
 }
 
-int clock_has_t_state(cpu_t *cpu) {
-  if (!cpu)
+// T-state budget for one paced slice: CLOCK_SLICE_NS of emulated time at
+// the current rate, 0 when unpaced. Run it with cpu_run_tstates, which stops
+// within one instruction of it; clock_pace then sleeps for what actually ran.
+uint64_t clock_slice_tstates(cpu_t *cpu) {
+  uint64_t budget = 0;
+
+  if (!clock_paced(cpu))
     return 0;
-  return (cpu->clock.t > 0);
+
+  budget = cpu->clock.rate * CLOCK_SLICE_NS / 1000000000ull;
+  return budget ? budget : 1;
+}
+
+clock_speed_t clock_speed(uint64_t cycles, uint64_t instructions,
+                          uint64_t ns) {
+  clock_speed_t speed = {ns, 0, 0};
+
+  if (ns > 0) {
+    speed.mhz = (double)cycles * 1e3 / (double)ns;
+    speed.instructions_per_second = (double)instructions * 1e9 / (double)ns;
+  }
+  return speed;
+}
+
+void clock_meter_reset(cpu_t *cpu) {
+  if (!cpu)
+    return;
+
+  cpu->clock.meter_ns = clock_host_ns();
+  cpu->clock.meter_cycles = cpu->clock.cycles;
+  cpu->clock.meter_instructions = cpu->instructions;
+}
+
+// Emulated speed since the last reading (or clock_meter_reset), then start
+// a new interval.
+clock_speed_t clock_meter(cpu_t *cpu) {
+  clock_speed_t speed = {0, 0, 0};
+  uint64_t now = 0;
+
+  if (!cpu)
+    return speed;
+
+  now = clock_host_ns();
+  speed = clock_speed(cpu->clock.cycles - cpu->clock.meter_cycles,
+                      cpu->instructions - cpu->clock.meter_instructions,
+                      now - cpu->clock.meter_ns);
+  cpu->clock.meter_ns = now;
+  cpu->clock.meter_cycles = cpu->clock.cycles;
+  cpu->clock.meter_instructions = cpu->instructions;
+  return speed;
 }
@@ -17,27 +17,48 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
+
+#include "block.h"
 #include "cpu.h"
+#include "instruction.h"
+#include "jit.h"
 
-int cpu_init(cpu_t *cpu, uint32_t delay, uint16_t memory_size) {
+int cpu_init(cpu_t *cpu, uint32_t memory_size) {
   if (!cpu)
     return -1;
 
-  cpu->last_instruction[0] = '\0';
+  memset(&cpu->last_instruction, 0, sizeof(cpu->last_instruction));
+  cpu->flags.kind = FLAGS_NONE;
+  cpu->lazy_flags = true;
   cpu->last_mem_read = 0;
   cpu->last_mem_write = 0;
   cpu->last_mem_read_valid = false;
   cpu->last_mem_write_valid = false;
-  cpu->interrupts_enabled = false;
   cpu->halted = false;
-  cpu->interrupt_mode = 0;
+  cpu->instructions = 0;
+  cpu->instruction_limit = CPU_RUN_FOREVER;
+  cpu->cycle_limit = CPU_RUN_FOREVER;
+  cpu->idle_detect = false;
+  cpu->idle_tstates = 0;
+  cpu->breakpoint_count = 0;
+  memset(cpu->breakpoints, 0, sizeof(cpu->breakpoints));
+  memset(&cpu->io, 0, sizeof(cpu->io));
+  cpu->blocks = NULL;
+  cpu->jit = NULL;
 
   if (register_init(cpu) != 0)
     return -1;
-  if (clock_init(cpu, delay) != 0)
+  if (clock_init(cpu) != 0)
+    return -1;
+  if (scheduler_init(cpu) != 0)
+    return -1;
+  if (interrupt_init(cpu) != 0)
     return -1;
   if (memory_init(cpu, memory_size) != 0)
     return -1;
+  if (block_cache_init(cpu) != 0)
+    return -1;
 
   return 0;
 }
@@ -46,7 +67,201 @@ void cpu_destroy(cpu_t *cpu) {
   if (!cpu)
     return;
 
+  jit_destroy(cpu);
+  block_cache_destroy(cpu);
   memory_destroy(cpu);
+  scheduler_destroy(cpu);
   clock_destroy(cpu);
   register_destroy(cpu);
 }
+
+// Decode and execute one instruction. Callers have already checked that the
+// CPU is usable; this is the innermost loop body of cpu_run.
+static cpu_exit_t cpu_execute(cpu_t *cpu) {
+  instruction_operands_t ops;
+  uint16_t pc = cpu->registers.pc;
+  const instruction_entry_t *entry = instruction_decode(cpu, pc, &ops);
+  cpu_exit_t reason;
+
+  if (!entry)
+    return CPU_EXIT_UNDEFINED;
+
+  cpu_record_instruction(cpu, pc, ops.length);
+  cpu->registers.pc = (uint16_t)(pc + ops.length);
+  reason = entry->handler(cpu, &ops);
+  if (reason == CPU_EXIT_IO) {
+    cpu->registers.pc = pc;
+    return reason;
+  }
+
+  cpu_charge(cpu, (uint16_t)(pc + ops.length), entry->tstates,
+             entry->tstates_taken);
+  cpu->instructions++;
+  return reason;
+}
+
+// Called between instructions once clock.cycles reaches the scheduler
+// deadline: run the due events, then take any interrupt they (or earlier
+// code) left pending. interrupt_accept drops the deadline back to 0 while
+// one is still waiting. The deadline also covers the run's T-state limit;
+// reaching it ends the instruction budget, so the loop stops after this
+// instruction.
+void cpu_service(cpu_t *cpu) {
+  uint64_t next = 0;
+
+  scheduler_dispatch(cpu);
+  next = scheduler_next(cpu);
+  cpu->scheduler.next_event = cpu->cycle_limit < next ? cpu->cycle_limit : next;
+  if (cpu->clock.cycles >= cpu->cycle_limit)
+    cpu->instruction_limit = cpu->instructions;
+  interrupt_accept(cpu);
+}
+
+// Run one instruction and stop if it touched a watchpoint. The instruction
+// completes; the PC is left after it.
+static cpu_exit_t cpu_execute_watched(cpu_t *cpu) {
+  cpu_exit_t reason;
+
+  cpu->memory.watch_hit.hit = false;
+  reason = cpu_execute(cpu);
+  if (reason == CPU_EXIT_NONE && cpu->memory.watch_hit.hit)
+    return CPU_EXIT_WATCHPOINT;
+  return reason;
+}
+
+cpu_exit_t cpu_step(cpu_t *cpu) {
+  if (!clock_available(cpu) || !cpu->memory.pool)
+    return CPU_EXIT_ERROR;
+
+  cpu_budget_set(cpu, 1);
+  return cpu_execute_watched(cpu);
+}
+
+cpu_exit_t cpu_run(cpu_t *cpu, uint64_t max_instructions) {
+  cpu_exit_t reason = CPU_EXIT_NONE;
+  uint64_t start = 0;
+
+  if (!clock_available(cpu) || !cpu->memory.pool)
+    return CPU_EXIT_ERROR;
+
+  cpu->halted = false;
+
+  if (cpu->breakpoint_count == 0 && cpu->memory.watch_count == 0) {
+    if (cpu->blocks)
+      return block_run(cpu, max_instructions);
+#ifdef RAVELOXZEMU_THREADED
+    return instruction_run_threaded(cpu, max_instructions);
+#else
+    cpu_budget_set(cpu, max_instructions);
+    while (cpu->instructions < cpu->instruction_limit) {
+      reason = cpu_execute(cpu);
+      if (reason != CPU_EXIT_NONE)
+        return reason;
+    }
+    return CPU_EXIT_BUDGET;
+#endif
+  }
+
+  // The instruction at the starting PC always runs so that resuming from a
+  // breakpoint makes progress.
+  cpu_budget_set(cpu, max_instructions);
+  start = cpu->instructions;
+  while (cpu->instructions < cpu->instruction_limit) {
+    if (cpu->instructions != start &&
+        cpu_breakpoint_get(cpu, cpu->registers.pc))
+      return CPU_EXIT_BREAKPOINT;
+    reason = cpu_execute_watched(cpu);
+    if (reason != CPU_EXIT_NONE)
+      return reason;
+  }
+  return CPU_EXIT_BUDGET;
+}
+
+// Run until either budget is used up. The T-state limit is folded into the
+// scheduler deadline the loops already compare against, so it costs nothing
+// per instruction; the run stops at the first instruction (or native block)
+// boundary at or past it.
+cpu_exit_t cpu_run_tstates(cpu_t *cpu, uint64_t max_instructions,
+                           uint64_t max_tstates) {
+  cpu_exit_t reason = CPU_EXIT_NONE;
+
+  if (!clock_available(cpu) || !cpu->memory.pool)
+    return CPU_EXIT_ERROR;
+  if (max_tstates == 0)
+    return CPU_EXIT_BUDGET;
+
+  cpu->cycle_limit = max_tstates > CPU_RUN_FOREVER - cpu->clock.cycles
+                         ? CPU_RUN_FOREVER
+                         : cpu->clock.cycles + max_tstates;
+  if (cpu->cycle_limit < cpu->scheduler.next_event)
+    cpu->scheduler.next_event = cpu->cycle_limit;
+  reason = cpu_run(cpu, max_instructions);
+  // A deadline left early by the limit only costs one cpu_service call.
+  cpu->cycle_limit = CPU_RUN_FOREVER;
+  return reason;
+}
+
+const char *cpu_exit_name(cpu_exit_t reason) {
+  switch (reason) {
+  case CPU_EXIT_NONE:
+    return "none";
+  case CPU_EXIT_HALT:
+    return "HALT";
+  case CPU_EXIT_BUDGET:
+    return "budget exhausted";
+  case CPU_EXIT_BREAKPOINT:
+    return "breakpoint";
+  case CPU_EXIT_WATCHPOINT:
+    return "watchpoint";
+  case CPU_EXIT_UNDEFINED:
+    return "undefined opcode";
+  case CPU_EXIT_IO:
+    return "I/O trap";
+  case CPU_EXIT_ERROR:
+    return "error";
+  default:
+    return "unknown";
+  }
+}
+
+int cpu_breakpoint_set(cpu_t *cpu, uint16_t address) {
+  uint8_t mask = (uint8_t)(1u << (address & 0x07));
+
+  if (!cpu)
+    return -1;
+
+  if (!(cpu->breakpoints[address >> 3] & mask)) {
+    cpu->breakpoints[address >> 3] |= mask;
+    cpu->breakpoint_count++;
+  }
+  return 0;
+}
+
+int cpu_breakpoint_clear(cpu_t *cpu, uint16_t address) {
+  uint8_t mask = (uint8_t)(1u << (address & 0x07));
+
+  if (!cpu)
+    return -1;
+
+  if (cpu->breakpoints[address >> 3] & mask) {
+    cpu->breakpoints[address >> 3] &= (uint8_t)~mask;
+    cpu->breakpoint_count--;
+  }
+  return 0;
+}
+
+bool cpu_breakpoint_get(cpu_t *cpu, uint16_t address) {
+  if (!cpu)
+    return false;
+  return (cpu->breakpoints[address >> 3] >> (address & 0x07)) & 1;
+}
+
+void cpu_io_attach(cpu_t *cpu, cpu_io_read_t read, cpu_io_write_t write,
+                   void *context) {
+  if (!cpu)
+    return;
+
+  cpu->io.read = read;
+  cpu->io.write = write;
+  cpu->io.context = context;
+}
@@ -0,0 +1,182 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cpu.h"
+#include "disasm.h"
+#include "opcode_table.h"
+
+enum {
+  SPACE_MAIN,
+  SPACE_CB,
+  SPACE_ED,
+  SPACE_DD,
+  SPACE_FD,
+  SPACE_DDCB,
+  SPACE_FDCB,
+  SPACE_COUNT
+};
+
+// opcode_table is a flat list; index it by prefix and opcode on first use.
+static const opcode_info_t *disasm_index[SPACE_COUNT][256];
+static bool disasm_indexed = false;
+
+static void disasm_build_index(void) {
+  for (size_t i = 0; i < opcode_table_size; i++) {
+    const opcode_info_t *info = &opcode_table[i];
+    const uint8_t *b = info->bytes;
+    int space = SPACE_MAIN;
+    uint8_t key = b[0];
+
+    // The bare prefixes have single-byte entries of their own.
+    if (info->length >= 2 && (b[0] == 0xCB || b[0] == 0xED || b[0] == 0xDD ||
+                              b[0] == 0xFD)) {
+      key = b[1];
+      if (b[0] == 0xCB) {
+        space = SPACE_CB;
+      } else if (b[0] == 0xED) {
+        space = SPACE_ED;
+      } else if (b[0] == 0xDD || b[0] == 0xFD) {
+        bool indexed_cb = b[1] == 0xCB && info->has_displacement;
+
+        if (indexed_cb)
+          key = b[3];
+        if (b[0] == 0xDD)
+          space = indexed_cb ? SPACE_DDCB : SPACE_DD;
+        else
+          space = indexed_cb ? SPACE_FDCB : SPACE_FD;
+      }
+    }
+
+    if (!disasm_index[space][key])
+      disasm_index[space][key] = info;
+  }
+  disasm_indexed = true;
+}
+
+// Append to text, keeping track of the total length like snprintf does.
+static void disasm_append(char *text, size_t size, int *used,
+                          const char *format, int value) {
+  size_t offset = (size_t)*used < size ? (size_t)*used : size;
+  int written = snprintf(size ? text + offset : NULL,
+                         size ? size - offset : 0, format, value);
+
+  if (written > 0)
+    *used += written;
+}
+
+int disasm_format(const uint8_t *bytes, uint8_t length, char *text,
+                  size_t size) {
+  const opcode_info_t *info = NULL;
+  uint8_t operand = 1; // Offset of the first operand byte
+  bool displacement = false;
+  int used = 0;
+
+  if (!bytes || length == 0)
+    return -1;
+  if (!disasm_indexed)
+    disasm_build_index();
+
+  switch (bytes[0]) {
+  case 0xCB:
+  case 0xED:
+    if (length < 2)
+      return -1;
+    info = disasm_index[bytes[0] == 0xCB ? SPACE_CB : SPACE_ED][bytes[1]];
+    operand = 2;
+    break;
+  case 0xDD:
+  case 0xFD:
+    if (length < 2)
+      return -1;
+    operand = 2;
+    if (bytes[1] == 0xCB) {
+      if (length < 4)
+        return -1;
+      int space = bytes[0] == 0xDD ? SPACE_DDCB : SPACE_FDCB;
+
+      info = disasm_index[space][bytes[3]];
+      displacement = true;
+    } else {
+      info = disasm_index[bytes[0] == 0xDD ? SPACE_DD : SPACE_FD][bytes[1]];
+      displacement = info && info->has_displacement;
+    }
+    break;
+  default:
+    info = disasm_index[SPACE_MAIN][bytes[0]];
+    break;
+  }
+
+  if (!info)
+    return -1;
+  if (size)
+    text[0] = '\0';
+
+  // The displacement comes first, then any immediate byte or word.
+  uint8_t immediate = (uint8_t)(operand + (displacement ? 1 : 0));
+
+  for (const char *p = info->label; *p;) {
+    const char *word = p;
+    size_t word_length;
+
+    if (!isalpha((unsigned char)*p)) {
+      disasm_append(text, size, &used, "%c", *p++);
+      continue;
+    }
+
+    while (isalpha((unsigned char)*p))
+      p++;
+    word_length = (size_t)(p - word);
+
+    if (word_length == 2 && strncmp(word, "nn", 2) == 0) {
+      if (immediate + 2 > length)
+        return -1;
+      disasm_append(text, size, &used, "0x%04X",
+                    bytes[immediate] | (bytes[immediate + 1] << 8));
+    } else if (word_length == 1 && *word == 'n') {
+      if (immediate + 1 > length)
+        return -1;
+      disasm_append(text, size, &used, "0x%02X", bytes[immediate]);
+    } else if (word_length == 1 && *word == 'd') {
+      // Relative jumps and (IX+d): print the signed offset in place of "+d".
+      if (operand + 1 > length)
+        return -1;
+      if (used > 0 && (size_t)used <= size && text[used - 1] == '+')
+        text[--used] = '\0';
+      disasm_append(text, size, &used, "%+d", (int8_t)bytes[operand]);
+    } else {
+      for (size_t i = 0; i < word_length; i++)
+        disasm_append(text, size, &used, "%c", word[i]);
+    }
+  }
+
+  return used;
+}
+
+int disasm_last(cpu_t *cpu, char *text, size_t size) {
+  if (!cpu || cpu->last_instruction.length == 0)
+    return -1;
+
+  return disasm_format(cpu->last_instruction.bytes,
+                       cpu->last_instruction.length, text, size);
+}
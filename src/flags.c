@@ -0,0 +1,106 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+
+#include "cpu.h"
+#include "flag_tables.h"
+#include "flags.h"
+
+#define FLAG_BIT(flag, condition) ((condition) ? (uint8_t)(1u << (flag)) : 0)
+
+// Flags produced by an operation, with the bits it writes in *mask.
+static uint8_t flags_compute(const flags_pending_t *p, uint8_t *mask) {
+  uint16_t a = p->a;
+  uint16_t value = p->value;
+  uint16_t result = p->result;
+
+  *mask = (uint8_t)((1u << FLAG_S) | (1u << FLAG_Z) | (1u << FLAG_H) |
+                    (1u << FLAG_PV) | (1u << FLAG_N) | (1u << FLAG_C));
+
+  switch (p->kind) {
+  case FLAGS_ADD:
+    return flags_add[FLAG_TABLE_INDEX(a, value, p->carry)];
+  case FLAGS_SUB:
+    return flags_sub[FLAG_TABLE_INDEX(a, value, p->carry)];
+  case FLAGS_ADD16:
+    return FLAG_BIT(FLAG_S, result & 0x8000) | FLAG_BIT(FLAG_Z, result == 0) |
+           FLAG_BIT(FLAG_H,
+                    ((a & 0x0FFF) + (value & 0x0FFF) + p->carry) > 0x0FFF) |
+           FLAG_BIT(FLAG_PV, (~(a ^ value) & (a ^ result) & 0x8000) != 0) |
+           FLAG_BIT(FLAG_C, p->wide > 0xFFFF);
+  case FLAGS_SUB16:
+    return FLAG_BIT(FLAG_S, result & 0x8000) | FLAG_BIT(FLAG_Z, result == 0) |
+           FLAG_BIT(FLAG_H, (a & 0x0FFF) < ((value & 0x0FFF) + p->carry)) |
+           FLAG_BIT(FLAG_PV, ((a ^ value) & (a ^ result) & 0x8000) != 0) |
+           FLAG_BIT(FLAG_N, 1) | FLAG_BIT(FLAG_C, p->wide < 0);
+  case FLAGS_ADD16_HL:
+    *mask = (uint8_t)((1u << FLAG_H) | (1u << FLAG_N) | (1u << FLAG_C));
+    return FLAG_BIT(FLAG_H, ((a & 0x0FFF) + (value & 0x0FFF)) > 0x0FFF) |
+           FLAG_BIT(FLAG_C, p->wide > 0xFFFF);
+  case FLAGS_LOGIC:
+    return flags_szp[(uint8_t)result] | FLAG_BIT(FLAG_H, p->carry);
+  case FLAGS_ROTATE:
+    return flags_szp[(uint8_t)result] | FLAG_BIT(FLAG_C, p->carry);
+  case FLAGS_INC:
+    *mask &= (uint8_t)~(1u << FLAG_C);
+    return flags_add[FLAG_TABLE_INDEX(value, 1, 0)];
+  case FLAGS_DEC:
+    *mask &= (uint8_t)~(1u << FLAG_C);
+    return flags_sub[FLAG_TABLE_INDEX(value, 1, 0)];
+  case FLAGS_BIT:
+    *mask &= (uint8_t)~(1u << FLAG_C);
+    return flags_szp[(uint8_t)result] | FLAG_BIT(FLAG_H, 1);
+  default:
+    *mask = 0;
+    return 0;
+  }
+}
+
+static void flags_apply(cpu_t *cpu, const flags_pending_t *p) {
+  uint8_t mask = 0;
+  uint8_t flags = flags_compute(p, &mask);
+  uint8_t *f = &cpu->registers.f;
+
+  *f = (uint8_t)((*f & ~mask) | (flags & mask));
+}
+
+void flags_record(cpu_t *cpu, uint8_t kind, uint16_t a, uint16_t value,
+                  uint8_t carry, uint16_t result, int32_t wide) {
+  flags_pending_t p = {kind, carry, a, value, result, wide};
+
+  if (!cpu->lazy_flags) {
+    flags_apply(cpu, &p);
+    return;
+  }
+
+  // Partial updates keep earlier flags, so those must be real first.
+  if (kind == FLAGS_ADD16_HL || kind == FLAGS_INC || kind == FLAGS_DEC ||
+      kind == FLAGS_BIT)
+    flags_materialize(cpu);
+  cpu->flags = p;
+}
+
+void flags_materialize(cpu_t *cpu) {
+  if (cpu->flags.kind == FLAGS_NONE)
+    return;
+
+  flags_apply(cpu, &cpu->flags);
+  cpu->flags.kind = FLAGS_NONE;
+}
@@ -17,456 +17,18 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "block.h"
 #include "cpu.h" // IWYU pragma: keep
+#include "flag_tables.h"
+#include "flags.h"
 #include "instruction.h"
 #include "memory.h"
 #include "register.h"
 
-static instruction_map_t instruction_map[] = {
-    {0x00, I_NOP, "NOP"},
-    {0x01, I_LOAD_RR_NN, "LD rr,nn"},
-    {0x02, I_LOAD_RR_A, "LD (BC/DE),A"},
-    {0x06, I_LOAD_R_N, "LD r,n"},
-    {0x08, I_EX, "EX AF,AF'"},
-    {0x0A, I_LOAD_RR_A, "LD (BC/DE),A"},
-    {0x0E, I_LOAD_R_N, "LD r,n"},
-    {0x03, I_INC_RR, "INC rr"},
-    {0x0B, I_DEC_RR, "DEC rr"},
-    {0x09, I_ADD_HL_RR, "ADD HL,rr"},
-    {0x11, I_LOAD_RR_NN, "LD rr,nn"},
-    {0x12, I_LOAD_RR_A, "LD (BC/DE),A"},
-    {0x16, I_LOAD_R_N, "LD r,n"},
-    {0x1A, I_LOAD_RR_A, "LD (BC/DE),A"},
-    {0x1E, I_LOAD_R_N, "LD r,n"},
-    {0x13, I_INC_RR, "INC rr"},
-    {0x1B, I_DEC_RR, "DEC rr"},
-    {0x19, I_ADD_HL_RR, "ADD HL,rr"},
-    {0x18, I_JR, "JR d"},
-    {0x21, I_LOAD_RR_NN, "LD rr,nn"},
-    {0x26, I_LOAD_R_N, "LD r,n"},
-    {0x2E, I_LOAD_R_N, "LD r,n"},
-    {0x27, I_DAA, "DAA"},
-    {0x22, I_LOAD_MEM_RR, "LD (nn),rr"},
-    {0x23, I_INC_RR, "INC rr"},
-    {0x2B, I_DEC_RR, "DEC rr"},
-    {0x29, I_ADD_HL_RR, "ADD HL,rr"},
-    {0x2A, I_LOAD_RR_MEM, "LD rr,(nn)"},
-    {0x31, I_LOAD_RR_NN, "LD rr,nn"},
-    {0x32, I_LOAD_MEM_A, "LD (nn),A"},
-    {0x3A, I_LOAD_A_MEM, "LD A,(nn)"},
-    {0x3E, I_LOAD_R_N, "LD r,n"},
-    {0x36, I_LOAD_HL_N, "LD (HL),n"},
-    {0x2F, I_CPL, "CPL"},
-    {0x33, I_INC_RR, "INC rr"},
-    {0x3B, I_DEC_RR, "DEC rr"},
-    {0x39, I_ADD_HL_RR, "ADD HL,rr"},
-    {0x20, I_JR, "JR NZ,d"},
-    {0x28, I_JR, "JR Z,d"},
-    {0x30, I_JR, "JR NC,d"},
-    {0x38, I_JR, "JR C,d"},
-    {0x40, I_LOAD_R_R, "LD r,r"},
-    {0x41, I_LOAD_R_R, "LD r,r"},
-    {0x42, I_LOAD_R_R, "LD r,r"},
-    {0x43, I_LOAD_R_R, "LD r,r"},
-    {0x44, I_LOAD_R_R, "LD r,r"},
-    {0x45, I_LOAD_R_R, "LD r,r"},
-    {0x46, I_LOAD_HL_R, "LD (HL),r"},
-    {0x47, I_LOAD_R_R, "LD r,r"},
-    {0x48, I_LOAD_R_R, "LD r,r"},
-    {0x49, I_LOAD_R_R, "LD r,r"},
-    {0x4A, I_LOAD_R_R, "LD r,r"},
-    {0x4B, I_LOAD_R_R, "LD r,r"},
-    {0x4C, I_LOAD_R_R, "LD r,r"},
-    {0x4D, I_LOAD_R_R, "LD r,r"},
-    {0x4E, I_LOAD_HL_R, "LD (HL),r"},
-    {0x4F, I_LOAD_R_R, "LD r,r"},
-    {0x50, I_LOAD_R_R, "LD r,r"},
-    {0x51, I_LOAD_R_R, "LD r,r"},
-    {0x52, I_LOAD_R_R, "LD r,r"},
-    {0x53, I_LOAD_R_R, "LD r,r"},
-    {0x54, I_LOAD_R_R, "LD r,r"},
-    {0x55, I_LOAD_R_R, "LD r,r"},
-    {0x56, I_LOAD_HL_R, "LD (HL),r"},
-    {0x57, I_LOAD_R_R, "LD r,r"},
-    {0x58, I_LOAD_R_R, "LD r,r"},
-    {0x59, I_LOAD_R_R, "LD r,r"},
-    {0x5A, I_LOAD_R_R, "LD r,r"},
-    {0x5B, I_LOAD_R_R, "LD r,r"},
-    {0x5C, I_LOAD_R_R, "LD r,r"},
-    {0x5D, I_LOAD_R_R, "LD r,r"},
-    {0x5E, I_LOAD_HL_R, "LD (HL),r"},
-    {0x5F, I_LOAD_R_R, "LD r,r"},
-    {0x60, I_LOAD_R_R, "LD r,r"},
-    {0x61, I_LOAD_R_R, "LD r,r"},
-    {0x62, I_LOAD_R_R, "LD r,r"},
-    {0x63, I_LOAD_R_R, "LD r,r"},
-    {0x64, I_LOAD_R_R, "LD r,r"},
-    {0x65, I_LOAD_R_R, "LD r,r"},
-    {0x66, I_LOAD_HL_R, "LD (HL),r"},
-    {0x67, I_LOAD_R_R, "LD r,r"},
-    {0x68, I_LOAD_R_R, "LD r,r"},
-    {0x69, I_LOAD_R_R, "LD r,r"},
-    {0x6A, I_LOAD_R_R, "LD r,r"},
-    {0x6B, I_LOAD_R_R, "LD r,r"},
-    {0x6C, I_LOAD_R_R, "LD r,r"},
-    {0x6D, I_LOAD_R_R, "LD r,r"},
-    {0x6E, I_LOAD_HL_R, "LD (HL),r"},
-    {0x6F, I_LOAD_R_R, "LD r,r"},
-    {0x7E, I_LOAD_HL_R, "LD (HL),r"},
-    {0x70, I_LOAD_HL_R, "LD (HL),r"},
-    {0x71, I_LOAD_HL_R, "LD (HL),r"},
-    {0x72, I_LOAD_HL_R, "LD (HL),r"},
-    {0x73, I_LOAD_HL_R, "LD (HL),r"},
-    {0x74, I_LOAD_HL_R, "LD (HL),r"},
-    {0x75, I_LOAD_HL_R, "LD (HL),r"},
-    {0x77, I_LOAD_HL_R, "LD (HL),r"},
-    {0x78, I_LOAD_R_R, "LD r,r"},
-    {0x79, I_LOAD_R_R, "LD r,r"},
-    {0x7A, I_LOAD_R_R, "LD r,r"},
-    {0x7B, I_LOAD_R_R, "LD r,r"},
-    {0x7C, I_LOAD_R_R, "LD r,r"},
-    {0x7D, I_LOAD_R_R, "LD r,r"},
-    {0x7F, I_LOAD_R_R, "LD r,r"},
-    {0x76, I_HALT, "HALT"},
-    {0x80, I_ADD_A_R, "ADD A,r"},
-    {0x81, I_ADD_A_R, "ADD A,r"},
-    {0x82, I_ADD_A_R, "ADD A,r"},
-    {0x83, I_ADD_A_R, "ADD A,r"},
-    {0x84, I_ADD_A_R, "ADD A,r"},
-    {0x85, I_ADD_A_R, "ADD A,r"},
-    {0x86, I_ADD_A_R, "ADD A,(HL)"},
-    {0x87, I_ADD_A_R, "ADD A,r"},
-    {0x88, I_ADC_A_R, "ADC A,r"},
-    {0x89, I_ADC_A_R, "ADC A,r"},
-    {0x8A, I_ADC_A_R, "ADC A,r"},
-    {0x8B, I_ADC_A_R, "ADC A,r"},
-    {0x8C, I_ADC_A_R, "ADC A,r"},
-    {0x8D, I_ADC_A_R, "ADC A,r"},
-    {0x8E, I_ADC_A_R, "ADC A,(HL)"},
-    {0x8F, I_ADC_A_R, "ADC A,r"},
-    {0x90, I_SUB_R, "SUB r"},
-    {0x91, I_SUB_R, "SUB r"},
-    {0x92, I_SUB_R, "SUB r"},
-    {0x93, I_SUB_R, "SUB r"},
-    {0x94, I_SUB_R, "SUB r"},
-    {0x95, I_SUB_R, "SUB r"},
-    {0x96, I_SUB_R, "SUB (HL)"},
-    {0x97, I_SUB_R, "SUB r"},
-    {0x98, I_SBC_A_R, "SBC A,r"},
-    {0x99, I_SBC_A_R, "SBC A,r"},
-    {0x9A, I_SBC_A_R, "SBC A,r"},
-    {0x9B, I_SBC_A_R, "SBC A,r"},
-    {0x9C, I_SBC_A_R, "SBC A,r"},
-    {0x9D, I_SBC_A_R, "SBC A,r"},
-    {0x9E, I_SBC_A_R, "SBC A,(HL)"},
-    {0x9F, I_SBC_A_R, "SBC A,r"},
-    {0xA0, I_AND_R, "AND r"},
-    {0xA1, I_AND_R, "AND r"},
-    {0xA2, I_AND_R, "AND r"},
-    {0xA3, I_AND_R, "AND r"},
-    {0xA4, I_AND_R, "AND r"},
-    {0xA5, I_AND_R, "AND r"},
-    {0xA6, I_AND_R, "AND (HL)"},
-    {0xA7, I_AND_R, "AND r"},
-    {0xA8, I_XOR_R, "XOR r"},
-    {0xA9, I_XOR_R, "XOR r"},
-    {0xAA, I_XOR_R, "XOR r"},
-    {0xAB, I_XOR_R, "XOR r"},
-    {0xAC, I_XOR_R, "XOR r"},
-    {0xAD, I_XOR_R, "XOR r"},
-    {0xAE, I_XOR_R, "XOR (HL)"},
-    {0xAF, I_XOR_R, "XOR r"},
-    {0xB0, I_OR_R, "OR r"},
-    {0xB1, I_OR_R, "OR r"},
-    {0xB2, I_OR_R, "OR r"},
-    {0xB3, I_OR_R, "OR r"},
-    {0xB4, I_OR_R, "OR r"},
-    {0xB5, I_OR_R, "OR r"},
-    {0xB6, I_OR_R, "OR (HL)"},
-    {0xB7, I_OR_R, "OR r"},
-    {0xB8, I_CP_R, "CP r"},
-    {0xB9, I_CP_R, "CP r"},
-    {0xBA, I_CP_R, "CP r"},
-    {0xBB, I_CP_R, "CP r"},
-    {0xBC, I_CP_R, "CP r"},
-    {0xBD, I_CP_R, "CP r"},
-    {0xBE, I_CP_R, "CP (HL)"},
-    {0xBF, I_CP_R, "CP r"},
-    {0xC0, I_RET, "RET NZ"},
-    {0xC2, I_JP, "JP NZ,nn"},
-    {0xC3, I_JP, "JP nn"},
-    {0xC4, I_CALL, "CALL NZ,nn"},
-    {0xC6, I_ADD_A_N, "ADD A,n"},
-    {0xC7, I_RST, "RST 00"},
-    {0xC8, I_RET, "RET Z"},
-    {0xC9, I_RET, "RET"},
-    {0xCA, I_JP, "JP Z,nn"},
-    {0xCC, I_CALL, "CALL Z,nn"},
-    {0xCD, I_CALL, "CALL nn"},
-    {0xCE, I_ADC_A_N, "ADC A,n"},
-    {0xD6, I_SUB_N, "SUB n"},
-    {0xD0, I_RET, "RET NC"},
-    {0xD2, I_JP, "JP NC,nn"},
-    {0xD4, I_CALL, "CALL NC,nn"},
-    {0xDE, I_SBC_A_N, "SBC A,n"},
-    {0xD7, I_RST, "RST 10"},
-    {0xD8, I_RET, "RET C"},
-    {0xDA, I_JP, "JP C,nn"},
-    {0xDC, I_CALL, "CALL C,nn"},
-    {0xDF, I_RST, "RST 18"},
-    {0xE0, I_RET, "RET PO"},
-    {0xE2, I_JP, "JP PO,nn"},
-    {0xE4, I_CALL, "CALL PO,nn"},
-    {0xE7, I_RST, "RST 20"},
-    {0xE8, I_RET, "RET PE"},
-    {0xE9, I_JP, "JP (HL)"},
-    {0xEA, I_JP, "JP PE,nn"},
-    {0xEC, I_CALL, "CALL PE,nn"},
-    {0xEF, I_RST, "RST 28"},
-    {0xF0, I_RET, "RET P"},
-    {0xF2, I_JP, "JP P,nn"},
-    {0xF4, I_CALL, "CALL P,nn"},
-    {0xF7, I_RST, "RST 30"},
-    {0xF8, I_RET, "RET M"},
-    {0xFA, I_JP, "JP M,nn"},
-    {0xFC, I_CALL, "CALL M,nn"},
-    {0xFF, I_RST, "RST 38"},
-    {0xE6, I_AND_N, "AND n"},
-    {0xEE, I_XOR_N, "XOR n"},
-    {0xF6, I_OR_N, "OR n"},
-    {0xFE, I_CP_N, "CP n"},
-    {0x04, I_INC_R, "INC r"},
-    {0x0C, I_INC_R, "INC r"},
-    {0x14, I_INC_R, "INC r"},
-    {0x1C, I_INC_R, "INC r"},
-    {0x24, I_INC_R, "INC r"},
-    {0x2C, I_INC_R, "INC r"},
-    {0x3C, I_INC_R, "INC r"},
-    {0x34, I_INC_HL, "INC (HL)"},
-    {0x05, I_DEC_R, "DEC r"},
-    {0x0D, I_DEC_R, "DEC r"},
-    {0x15, I_DEC_R, "DEC r"},
-    {0x1D, I_DEC_R, "DEC r"},
-    {0x25, I_DEC_R, "DEC r"},
-    {0x2D, I_DEC_R, "DEC r"},
-    {0x3D, I_DEC_R, "DEC r"},
-    {0x35, I_DEC_HL, "DEC (HL)"},
-    {0xC1, I_POP, "POP rr"},
-    {0xC5, I_PUSH, "PUSH rr"},
-    {0x37, I_SCF, "SCF"},
-    {0x3F, I_CCF, "CCF"},
-    {0xD1, I_POP, "POP rr"},
-    {0xD5, I_PUSH, "PUSH rr"},
-    {0xE1, I_POP, "POP rr"},
-    {0xE5, I_PUSH, "PUSH rr"},
-    {0xF1, I_POP, "POP rr"},
-    {0xF5, I_PUSH, "PUSH rr"},
-    {0xDD36, I_LOAD_IDX_N, "LD (IX/IY+d),n"},
-    {0xDD46, I_LOAD_R_IDX, "LD r,(IX/IY+d)"},
-    {0xDD4E, I_LOAD_R_IDX, "LD r,(IX/IY+d)"},
-    {0xDD56, I_LOAD_R_IDX, "LD r,(IX/IY+d)"},
-    {0xDD5E, I_LOAD_R_IDX, "LD r,(IX/IY+d)"},
-    {0xDD66, I_LOAD_R_IDX, "LD r,(IX/IY+d)"},
-    {0xDD6E, I_LOAD_R_IDX, "LD r,(IX/IY+d)"},
-    {0xDD70, I_LOAD_IDX_R, "LD (IX/IY+d),r"},
-    {0xDD71, I_LOAD_IDX_R, "LD (IX/IY+d),r"},
-    {0xDD72, I_LOAD_IDX_R, "LD (IX/IY+d),r"},
-    {0xDD73, I_LOAD_IDX_R, "LD (IX/IY+d),r"},
-    {0xDD74, I_LOAD_IDX_R, "LD (IX/IY+d),r"},
-    {0xDD75, I_LOAD_IDX_R, "LD (IX/IY+d),r"},
-    {0xDD77, I_LOAD_IDX_R, "LD (IX/IY+d),r"},
-    {0xDD7E, I_LOAD_IDX_R, "LD (IX/IY+d),r"},
-    {0xDD7E, I_LOAD_R_IDX, "LD r,(IX/IY+d)"},
-    {0xDD86, I_ADD_A_IDX, "ADD A,(IX/IY+d)"},
-    {0xDD8E, I_ADC_A_IDX, "ADC A,(IX/IY+d)"},
-    {0xDD96, I_SUB_IDX, "SUB (IX/IY+d)"},
-    {0xDD9E, I_SBC_A_IDX, "SBC A,(IX/IY+d)"},
-    {0xDDA6, I_AND_IDX, "AND (IX/IY+d)"},
-    {0xDDAE, I_XOR_IDX, "XOR (IX/IY+d)"},
-    {0xDDB6, I_OR_IDX, "OR (IX/IY+d)"},
-    {0xDDBE, I_CP_IDX, "CP (IX/IY+d)"},
-    {0xDD34, I_INC_IDX, "INC (IX/IY+d)"},
-    {0xDD35, I_DEC_IDX, "DEC (IX/IY+d)"},
-    {0xDDE1, I_POP, "POP rr"},
-    {0xDDE5, I_PUSH, "PUSH rr"},
-    {0xDD21, I_LOAD_RR_NN, "LD rr,nn"},
-    {0xDD22, I_LOAD_MEM_RR, "LD (nn),rr"},
-    {0xDD2A, I_LOAD_RR_MEM, "LD rr,(nn)"},
-    {0xDDE3, I_EX, "EX (SP),IX"},
-    {0xDDE9, I_JP, "JP (IX)"},
-    {0xDD09, I_ADD_IX_IY_RR, "ADD IX,rr"},
-    {0xDD19, I_ADD_IX_IY_RR, "ADD IX,rr"},
-    {0xDD29, I_ADD_IX_IY_RR, "ADD IX,rr"},
-    {0xDD39, I_ADD_IX_IY_RR, "ADD IX,rr"},
-    {0xDD23, I_INC_RR, "INC IX"},
-    {0xDD2B, I_DEC_RR, "DEC IX"},
-    {0xDDF9, I_LOAD_SP_RR, "LD SP,rr"},
-    {0xE3, I_EX, "EX (SP),HL"},
-    {0xEB, I_EX, "EX DE,HL"},
-    {0xED47, I_LOAD_A_I, "LD A,I"},
-    {0xED4F, I_LOAD_A_R_REG, "LD A,R"},
-    {0xED57, I_LOAD_I_A, "LD I,A"},
-    {0xED5F, I_LOAD_R_REG_A, "LD R,A"},
-    {0xED4A, I_ADC_HL_RR, "ADC HL,rr"},
-    {0xED5A, I_ADC_HL_RR, "ADC HL,rr"},
-    {0xED6A, I_ADC_HL_RR, "ADC HL,rr"},
-    {0xED7A, I_ADC_HL_RR, "ADC HL,rr"},
-    {0xED42, I_SBC_HL_RR, "SBC HL,rr"},
-    {0xED52, I_SBC_HL_RR, "SBC HL,rr"},
-    {0xED62, I_SBC_HL_RR, "SBC HL,rr"},
-    {0xED72, I_SBC_HL_RR, "SBC HL,rr"},
-    {0xED44, I_NEG, "NEG"},
-    {0xED4C, I_NEG, "NEG"},
-    {0xED54, I_NEG, "NEG"},
-    {0xED5C, I_NEG, "NEG"},
-    {0xED64, I_NEG, "NEG"},
-    {0xED6C, I_NEG, "NEG"},
-    {0xED74, I_NEG, "NEG"},
-    {0xED7C, I_NEG, "NEG"},
-    {0xED45, I_RET, "RETN"},
-    {0xED4D, I_RET, "RETI"},
-    {0xED55, I_RET, "RETN"},
-    {0xED5D, I_RET, "RETI"},
-    {0xED65, I_RET, "RETN"},
-    {0xED6D, I_RET, "RETI"},
-    {0xED75, I_RET, "RETN"},
-    {0xED7D, I_RET, "RETI"},
-    {0xED46, I_IM, "IM 0"},
-    {0xED4E, I_IM, "IM 0"},
-    {0xED66, I_IM, "IM 0"},
-    {0xED6E, I_IM, "IM 0"},
-    {0xED56, I_IM, "IM 1"},
-    {0xED76, I_IM, "IM 1"},
-    {0xED5E, I_IM, "IM 2"},
-    {0xED7E, I_IM, "IM 2"},
-    {0xED73, I_LOAD_MEM_SP, "LD (nn),SP"},
-    {0xED7B, I_LOAD_SP_MEM, "LD SP,(nn)"},
-    {0xEDA0, I_BLKT, "LDI"},
-    {0xEDA1, I_BLKS, "CPI"},
-    {0xEDA8, I_BLKT, "LDD"},
-    {0xEDA9, I_BLKS, "CPD"},
-    {0xEDB0, I_BLKT, "LDIR"},
-    {0xEDB1, I_BLKS, "CPIR"},
-    {0xEDB8, I_BLKT, "LDDR"},
-    {0xEDB9, I_BLKS, "CPDR"},
-    {0XFD36, I_LOAD_IDX_N, "LD (IX/IY+d),n"},
-    {0xFD46, I_LOAD_R_IDX, "LD r,(IX/IY+d)"},
-    {0xFD4E, I_LOAD_R_IDX, "LD r,(IX/IY+d)"},
-    {0xFD56, I_LOAD_R_IDX, "LD r,(IX/IY+d)"},
-    {0xFD5E, I_LOAD_R_IDX, "LD r,(IX/IY+d)"},
-    {0xFD66, I_LOAD_R_IDX, "LD r,(IX/IY+d)"},
-    {0xFD6E, I_LOAD_R_IDX, "LD r,(IX/IY+d)"},
-    {0xFD70, I_LOAD_IDX_R, "LD (IX/IY+d),r"},
-    {0xFD71, I_LOAD_IDX_R, "LD (IX/IY+d),r"},
-    {0xFD72, I_LOAD_IDX_R, "LD (IX/IY+d),r"},
-    {0xFD73, I_LOAD_IDX_R, "LD (IX/IY+d),r"},
-    {0xFD74, I_LOAD_IDX_R, "LD (IX/IY+d),r"},
-    {0xFD75, I_LOAD_IDX_R, "LD (IX/IY+d),r"},
-    {0xFD77, I_LOAD_IDX_R, "LD (IX/IY+d),r"},
-    {0xFD7E, I_LOAD_IDX_R, "LD (IX/IY+d),r"},
-    {0xFD7E, I_LOAD_R_IDX, "LD r,(IX/IY+d)"},
-    {0xFD86, I_ADD_A_IDX, "ADD A,(IX/IY+d)"},
-    {0xFD8E, I_ADC_A_IDX, "ADC A,(IX/IY+d)"},
-    {0xFD96, I_SUB_IDX, "SUB (IX/IY+d)"},
-    {0xFD9E, I_SBC_A_IDX, "SBC A,(IX/IY+d)"},
-    {0xFDA6, I_AND_IDX, "AND (IX/IY+d)"},
-    {0xFDAE, I_XOR_IDX, "XOR (IX/IY+d)"},
-    {0xFDB6, I_OR_IDX, "OR (IX/IY+d)"},
-    {0xFDBE, I_CP_IDX, "CP (IX/IY+d)"},
-    {0xFD34, I_INC_IDX, "INC (IX/IY+d)"},
-    {0xFD35, I_DEC_IDX, "DEC (IX/IY+d)"},
-    {0xFD21, I_LOAD_RR_NN, "LD rr,nn"},
-    {0xFD22, I_LOAD_MEM_RR, "LD (nn),rr"},
-    {0xFD2A, I_LOAD_RR_MEM, "LD rr,(nn)"},
-    {0xFDE3, I_EX, "EX (SP),IY"},
-    {0xFDE9, I_JP, "JP (IY)"},
-    {0xFDE1, I_POP, "POP rr"},
-    {0xFDE5, I_PUSH, "PUSH rr"},
-    {0xFD09, I_ADD_IX_IY_RR, "ADD IY,rr"},
-    {0xFD19, I_ADD_IX_IY_RR, "ADD IY,rr"},
-    {0xFD29, I_ADD_IX_IY_RR, "ADD IY,rr"},
-    {0xFD39, I_ADD_IX_IY_RR, "ADD IY,rr"},
-    {0xFD23, I_INC_RR, "INC IY"},
-    {0xFD2B, I_DEC_RR, "DEC IY"},
-    {0xFDF9, I_LOAD_SP_RR, "LD SP,rr"},
-    {0xF9, I_LOAD_SP_RR, "LD SP,rr"},
-    {0xF3, I_DI, "DI"},
-    {0xFB, I_EI, "EI"}};
-
-static instruction_group_t instruction_lookup[0x10000];
-static int instruction_lookup_ready = 0;
-
-void instruction_map_init(void) {
-  if (instruction_lookup_ready)
-    return;
-
-  size_t count = sizeof(instruction_map) / sizeof(instruction_map[0]);
-  for (size_t i = 0; i < 0x10000; i++)
-    instruction_lookup[i] = I_U;
-  for (size_t i = 0; i < count; i++) {
-    instruction_lookup[instruction_map[i].op_code] = instruction_map[i].group;
-  }
-  instruction_lookup_ready = 1;
-}
-
-static const char *register_name_8(uint8_t reg) {
-  switch (reg) {
-  case REG_A:
-    return "A";
-  case REG_B:
-    return "B";
-  case REG_C:
-    return "C";
-  case REG_D:
-    return "D";
-  case REG_E:
-    return "E";
-  case REG_H:
-    return "H";
-  case REG_L:
-    return "L";
-  default:
-    return "?";
-  }
-}
-
-static const char *register_name_16(uint8_t reg) {
-  switch (reg) {
-  case REG_AF:
-    return "AF";
-  case REG_BC:
-    return "BC";
-  case REG_DE:
-    return "DE";
-  case REG_HL:
-    return "HL";
-  case REG_IX:
-    return "IX";
-  case REG_IY:
-    return "IY";
-  case REG_SP:
-    return "SP";
-  default:
-    return "?";
-  }
-}
-
-static void instruction_log(cpu_t *cpu, const char *format, ...) {
-  va_list args;
-
-  if (!cpu)
-    return;
-
-  va_start(args, format);
-  vsnprintf(cpu->last_instruction, sizeof(cpu->last_instruction), format, args);
-  va_end(args);
-}
-
 static void flag_set(cpu_t *cpu, uint8_t flag, int condition) {
   if (condition)
     register_flag_set(cpu, flag);
@@ -474,36 +36,6 @@ static void flag_set(cpu_t *cpu, uint8_t flag, int condition) {
     register_flag_unset(cpu, flag);
 }
 
-static int parity_even(uint8_t value) {
-  value ^= value >> 4;
-  value ^= value >> 2;
-  value ^= value >> 1;
-  return (value & 1) == 0;
-}
-
-static const char *condition_label(uint8_t condition) {
-  switch (condition & 0x07) {
-  case 0x00:
-    return "NZ";
-  case 0x01:
-    return "Z";
-  case 0x02:
-    return "NC";
-  case 0x03:
-    return "C";
-  case 0x04:
-    return "PO";
-  case 0x05:
-    return "PE";
-  case 0x06:
-    return "P";
-  case 0x07:
-    return "M";
-  default:
-    return "?";
-  }
-}
-
 static int condition_true(cpu_t *cpu, uint8_t condition) {
   uint8_t flags = (uint8_t)register_value_get(cpu, REG_F);
   switch (condition & 0x07) {
@@ -528,94 +60,56 @@ static int condition_true(cpu_t *cpu, uint8_t condition) {
   }
 }
 
-static uint8_t read_r_value(cpu_t *cpu, uint8_t op_code, const char **label) {
+static uint8_t read_r_value(cpu_t *cpu, uint8_t op_code) {
   uint8_t r_bits = op_code & 0x07;
-  if (r_bits == 0x06) {
-    if (label)
-      *label = "(HL)";
-    return memory_get(cpu, register_value_get(cpu, REG_HL));
-  }
-  if (label)
-    *label = register_name_8(register_map(r_bits));
-  return (uint8_t)register_value_get(cpu, register_map(r_bits));
+  if (r_bits == 0x06)
+    return memory_get(cpu, cpu->registers.hl);
+  return (uint8_t)register_file_get(&cpu->registers, register_map(r_bits));
 }
 
 static void update_flags_add(cpu_t *cpu, uint8_t a, uint8_t value,
                              uint8_t carry, uint8_t result, uint16_t sum) {
-  flag_set(cpu, FLAG_S, result & 0x80);
-  flag_set(cpu, FLAG_Z, result == 0);
-  flag_set(cpu, FLAG_H,
-           ((a & 0x0F) + (value & 0x0F) + carry) > 0x0F);
-  flag_set(cpu, FLAG_PV, (~(a ^ value) & (a ^ result) & 0x80) != 0);
-  register_flag_unset(cpu, FLAG_N);
-  flag_set(cpu, FLAG_C, sum > 0xFF);
+  flags_record(cpu, FLAGS_ADD, a, value, carry, result, sum);
 }
 
 static void update_flags_sub(cpu_t *cpu, uint8_t a, uint8_t value,
                              uint8_t carry, uint8_t result, int16_t diff) {
-  flag_set(cpu, FLAG_S, result & 0x80);
-  flag_set(cpu, FLAG_Z, result == 0);
-  flag_set(cpu, FLAG_H, (a & 0x0F) < ((value & 0x0F) + carry));
-  flag_set(cpu, FLAG_PV, ((a ^ value) & (a ^ result) & 0x80) != 0);
-  register_flag_set(cpu, FLAG_N);
-  flag_set(cpu, FLAG_C, diff < 0);
+  flags_record(cpu, FLAGS_SUB, a, value, carry, result, diff);
 }
 
 static void update_flags_add16_full(cpu_t *cpu, uint16_t a, uint16_t value,
                                     uint16_t carry, uint16_t result,
                                     uint32_t sum) {
-  flag_set(cpu, FLAG_S, result & 0x8000);
-  flag_set(cpu, FLAG_Z, result == 0);
-  flag_set(cpu, FLAG_H,
-           ((a & 0x0FFF) + (value & 0x0FFF) + carry) > 0x0FFF);
-  flag_set(cpu, FLAG_PV,
-           (~(a ^ value) & (a ^ result) & 0x8000) != 0);
-  register_flag_unset(cpu, FLAG_N);
-  flag_set(cpu, FLAG_C, sum > 0xFFFF);
+  flags_record(cpu, FLAGS_ADD16, a, value, (uint8_t)carry, result,
+               (int32_t)sum);
 }
 
 static void update_flags_sub16_full(cpu_t *cpu, uint16_t a, uint16_t value,
                                     uint16_t carry, uint16_t result,
                                     int32_t diff) {
-  flag_set(cpu, FLAG_S, result & 0x8000);
-  flag_set(cpu, FLAG_Z, result == 0);
-  flag_set(cpu, FLAG_H, (a & 0x0FFF) < ((value & 0x0FFF) + carry));
-  flag_set(cpu, FLAG_PV,
-           ((a ^ value) & (a ^ result) & 0x8000) != 0);
-  register_flag_set(cpu, FLAG_N);
-  flag_set(cpu, FLAG_C, diff < 0);
+  flags_record(cpu, FLAGS_SUB16, a, value, (uint8_t)carry, result, diff);
 }
 
 static void update_flags_add16_hl(cpu_t *cpu, uint16_t a, uint16_t value,
                                   uint32_t sum) {
-  flag_set(cpu, FLAG_H, ((a & 0x0FFF) + (value & 0x0FFF)) > 0x0FFF);
-  register_flag_unset(cpu, FLAG_N);
-  flag_set(cpu, FLAG_C, sum > 0xFFFF);
+  flags_record(cpu, FLAGS_ADD16_HL, a, value, 0, (uint16_t)sum,
+               (int32_t)sum);
 }
 
 static void update_flags_logic(cpu_t *cpu, uint8_t result, uint8_t half_carry) {
-  flag_set(cpu, FLAG_S, result & 0x80);
-  flag_set(cpu, FLAG_Z, result == 0);
-  flag_set(cpu, FLAG_H, half_carry);
-  flag_set(cpu, FLAG_PV, parity_even(result));
-  register_flag_unset(cpu, FLAG_N);
-  register_flag_unset(cpu, FLAG_C);
+  flags_record(cpu, FLAGS_LOGIC, 0, 0, half_carry != 0, result, result);
 }
 
 static void update_flags_rotate(cpu_t *cpu, uint8_t result, uint8_t carry) {
-  flag_set(cpu, FLAG_S, result & 0x80);
-  flag_set(cpu, FLAG_Z, result == 0);
-  flag_set(cpu, FLAG_H, 0);
-  flag_set(cpu, FLAG_PV, parity_even(result));
-  register_flag_unset(cpu, FLAG_N);
-  flag_set(cpu, FLAG_C, carry);
+  flags_record(cpu, FLAGS_ROTATE, 0, 0, carry != 0, result, result);
 }
 
 static uint8_t cb_read_value(cpu_t *cpu, uint8_t r_bits, uint8_t use_index,
                              uint8_t index_reg, uint8_t d,
                              uint16_t *address_out) {
   if (use_index || r_bits == 0x06) {
-    uint16_t base = register_value_get(cpu, use_index ? index_reg : REG_HL);
+    uint16_t base =
+        register_file_get(&cpu->registers, use_index ? index_reg : REG_HL);
     uint16_t address = (uint16_t)(base + (int8_t)d);
     if (address_out)
       *address_out = address;
@@ -624,7 +118,7 @@ static uint8_t cb_read_value(cpu_t *cpu, uint8_t r_bits, uint8_t use_index,
 
   if (address_out)
     *address_out = 0;
-  return (uint8_t)register_value_get(cpu, register_map(r_bits));
+  return (uint8_t)register_file_get(&cpu->registers, register_map(r_bits));
 }
 
 static void cb_write_value(cpu_t *cpu, uint8_t r_bits, uint8_t use_index,
@@ -635,49 +129,35 @@ static void cb_write_value(cpu_t *cpu, uint8_t r_bits, uint8_t use_index,
   }
 
   if (!use_index && r_bits != 0x06) {
-    register_value_set(cpu, register_map(r_bits), value);
+    register_file_set(&cpu->registers, register_map(r_bits), value);
     return;
   }
 
   if (use_index && r_bits != 0x06) {
-    register_value_set(cpu, register_map(r_bits), value);
+    register_file_set(&cpu->registers, register_map(r_bits), value);
   }
 }
 
 static uint8_t inc_value(cpu_t *cpu, uint8_t value) {
   uint8_t result = (uint8_t)(value + 1);
-  flag_set(cpu, FLAG_S, result & 0x80);
-  flag_set(cpu, FLAG_Z, result == 0);
-  flag_set(cpu, FLAG_H, ((value & 0x0F) + 1) > 0x0F);
-  flag_set(cpu, FLAG_PV, value == 0x7F);
-  register_flag_unset(cpu, FLAG_N);
+  flags_record(cpu, FLAGS_INC, 0, value, 0, result, result);
   return result;
 }
 
 static uint8_t dec_value(cpu_t *cpu, uint8_t value) {
   uint8_t result = (uint8_t)(value - 1);
-  flag_set(cpu, FLAG_S, result & 0x80);
-  flag_set(cpu, FLAG_Z, result == 0);
-  flag_set(cpu, FLAG_H, (value & 0x0F) == 0x00);
-  flag_set(cpu, FLAG_PV, value == 0x80);
-  register_flag_set(cpu, FLAG_N);
+  flags_record(cpu, FLAGS_DEC, 0, value, 0, result, result);
   return result;
 }
 
-instruction_group_t instruction_group_get(uint16_t op_code) {
-  if (!instruction_lookup_ready)
-    instruction_map_init();
-  return instruction_lookup[op_code];
-}
-
 void _load_r_r(cpu_t *cpu, uint8_t source, uint8_t dest) {
-  uint8_t value = register_value_get(cpu,source);
-  register_value_set(cpu,dest, value);
+  uint8_t value = register_file_get(&cpu->registers, source);
+  register_file_set(&cpu->registers, dest, value);
 }
 
 void _load_r_from_mem(cpu_t *cpu, uint8_t reg, uint16_t address) {
   uint8_t value = memory_get(cpu,address);
-  register_value_set(cpu,reg, value);
+  register_file_set(&cpu->registers, reg, value);
 }
 
 void _load_mem_from_mem(cpu_t *cpu, uint16_t source, uint16_t dest) {
@@ -699,24 +179,20 @@ void inst_load_r_r(cpu_t *cpu, uint8_t op_code) {
   uint8_t source, dest;
   dest = register_map((op_code & 0x38) >> 3);
   source = register_map(op_code & 0x7);
-  instruction_log(cpu, "LD %s,%s", register_name_8(dest),
-                  register_name_8(source));
   _load_r_r(cpu,source, dest);
 }
 
 void inst_load_r_n(cpu_t *cpu, uint8_t op_code, uint8_t value) {
   uint8_t dest;
   dest = register_map((op_code & 0x38) >> 3);
-  instruction_log(cpu, "LD %s,0x%02X", register_name_8(dest), value);
-  register_value_set(cpu,dest, value);
+  register_file_set(&cpu->registers, dest, value);
 }
 
 void inst_load_r_hl(cpu_t *cpu, uint8_t op_code) {
   uint16_t hl_address;
   uint8_t dest;
   dest = register_map((op_code & 0x38) >> 3);
-  instruction_log(cpu, "LD %s,(HL)", register_name_8(dest));
-  hl_address = register_value_get(cpu,REG_HL);
+  hl_address = cpu->registers.hl;
   _load_r_from_mem(cpu,dest, hl_address);
 }
 
@@ -725,10 +201,8 @@ void inst_load_r_idx(cpu_t *cpu, uint8_t op_code, uint8_t index_reg,
   uint16_t index_address;
   uint8_t dest;
   dest = register_map((op_code & 0x38) >> 3);
-  instruction_log(cpu, "LD %s,(%s%+d)", register_name_8(dest),
-                  register_name_16(index_reg), (int8_t)d);
-  index_address = register_value_get(cpu,index_reg);
-  _load_r_from_mem(cpu,dest, index_address + d);
+  index_address = register_file_get(&cpu->registers, index_reg);
+  _load_r_from_mem(cpu, dest, (uint16_t)(index_address + (int8_t)d));
 }
 
 void inst_load_hl_r(cpu_t *cpu, uint8_t op_code) {
@@ -737,9 +211,8 @@ void inst_load_hl_r(cpu_t *cpu, uint8_t op_code) {
   uint8_t dest;
   uint8_t value;
   source_reg = register_map(op_code & 0x07);
-  instruction_log(cpu, "LD (HL),%s", register_name_8(source_reg));
-  value = register_value_get(cpu,source_reg);
-  hl_address = register_value_get(cpu,REG_HL);
+  value = register_file_get(&cpu->registers, source_reg);
+  hl_address = cpu->registers.hl;
   memory_set(cpu,hl_address, value);
 }
 
@@ -750,318 +223,273 @@ void inst_load_idx_r(cpu_t *cpu, uint8_t op_code, uint8_t index_reg,
   uint8_t dest;
   uint8_t value;
   source_reg = register_map((op_code & 0x07));
-  instruction_log(cpu, "LD (%s%+d),%s", register_name_16(index_reg),
-                  (int8_t)d,
-                  register_name_8(source_reg));
-  index_address = register_value_get(cpu,index_reg);
-  value = register_value_get(cpu,source_reg);
-  memory_set(cpu,index_address + d, value);
+  index_address = register_file_get(&cpu->registers, index_reg);
+  value = register_file_get(&cpu->registers, source_reg);
+  memory_set(cpu, (uint16_t)(index_address + (int8_t)d), value);
 }
 
 void inst_load_hl_n(cpu_t *cpu, uint8_t value) {
   uint16_t hl_address;
-  instruction_log(cpu, "LD (HL),0x%02X", value);
-  hl_address = register_value_get(cpu,REG_HL);
+  hl_address = cpu->registers.hl;
   memory_set(cpu,hl_address, value);
 }
 
 void inst_load_idx_n(cpu_t *cpu, uint8_t index_reg, uint8_t d, uint8_t value) {
   uint16_t index_address;
-  instruction_log(cpu, "LD (%s%+d),0x%02X", register_name_16(index_reg),
-                  (int8_t)d, value);
-  index_address = register_value_get(cpu,index_reg);
-  memory_set(cpu,index_address + d, value);
+  index_address = register_file_get(&cpu->registers, index_reg);
+  memory_set(cpu, (uint16_t)(index_address + (int8_t)d), value);
 }
 
 void inst_load_a_mem(cpu_t *cpu, uint16_t address) {
   uint8_t value;
-  instruction_log(cpu, "LD A,(0x%04X)", address);
   value = memory_get(cpu,address);
-  register_value_set(cpu,REG_A, value);
+  cpu->registers.a = value;
 }
 
 void inst_load_a_rr(cpu_t *cpu, uint8_t rr) {
   uint16_t reg_address;
-  instruction_log(cpu, "LD A,(%s)", register_name_16(rr));
-  reg_address = register_value_get(cpu,rr);
+  reg_address = register_file_get(&cpu->registers, rr);
   inst_load_a_mem(cpu, reg_address);
 }
 
 void inst_load_mem_a(cpu_t *cpu, uint16_t address) {
   uint8_t value;
-  instruction_log(cpu, "LD (0x%04X),A", address);
-  value = register_value_get(cpu,REG_A);
+  value = cpu->registers.a;
   memory_set(cpu,address, value);
 }
 void inst_load_rr_a(cpu_t *cpu, uint8_t rr) {
   uint16_t reg_address;
-  instruction_log(cpu, "LD (%s),A", register_name_16(rr));
-  reg_address = register_value_get(cpu,rr);
+  reg_address = register_file_get(&cpu->registers, rr);
   inst_load_mem_a(cpu, reg_address);
 }
 
 void inst_load_rr_nn(cpu_t *cpu, uint8_t rr, uint16_t value) {
-  instruction_log(cpu, "LD %s,0x%04X", register_name_16(rr), value);
-  register_value_set(cpu,rr, value);
+  register_file_set(&cpu->registers, rr, value);
 }
 
 void inst_load_rr_mem(cpu_t *cpu, uint8_t rr, uint16_t address) {
-  instruction_log(cpu, "LD %s,(0x%04X)", register_name_16(rr), address);
-  register_value_set(cpu,rr, _load_word_from_mem(cpu,address));
+  register_file_set(&cpu->registers, rr, _load_word_from_mem(cpu,address));
 }
 
 void inst_load_mem_rr(cpu_t *cpu, uint8_t rr, uint16_t address) {
-  instruction_log(cpu, "LD (0x%04X),%s", address, register_name_16(rr));
-  _store_word_to_mem(cpu,address, register_value_get(cpu,rr));
+  _store_word_to_mem(cpu,address, register_file_get(&cpu->registers, rr));
 }
 
 void inst_load_sp_rr(cpu_t *cpu, uint8_t rr) {
-  instruction_log(cpu, "LD SP,%s", register_name_16(rr));
-  register_value_set(cpu,REG_SP, register_value_get(cpu,rr));
+  cpu->registers.sp = register_file_get(&cpu->registers, rr);
 }
 
 void inst_load_sp_mem(cpu_t *cpu, uint16_t address) {
-  instruction_log(cpu, "LD SP,(0x%04X)", address);
-  register_value_set(cpu,REG_SP, _load_word_from_mem(cpu,address));
+  cpu->registers.sp = _load_word_from_mem(cpu,address);
 }
 
 void inst_load_mem_sp(cpu_t *cpu, uint16_t address) {
-  instruction_log(cpu, "LD (0x%04X),SP", address);
-  _store_word_to_mem(cpu,address, register_value_get(cpu,REG_SP));
+  _store_word_to_mem(cpu,address, cpu->registers.sp);
 }
 
 void inst_push_rr(cpu_t *cpu, uint8_t rr) {
-  uint16_t sp = register_value_get(cpu,REG_SP);
-  uint16_t value = register_value_get(cpu,rr);
-  instruction_log(cpu, "PUSH %s", register_name_16(rr));
+  uint16_t sp = cpu->registers.sp;
+  // rr may be AF, so stay on the tagged API to settle pending flags.
+  uint16_t value = register_value_get(cpu, rr);
 
   sp--;
   memory_set(cpu,sp, (uint8_t)((value >> 8) & 0x00FF));
   sp--;
   memory_set(cpu,sp, (uint8_t)(value & 0x00FF));
 
-  register_value_set(cpu,REG_SP, sp);
+  cpu->registers.sp = sp;
 }
 
 void inst_pop_rr(cpu_t *cpu, uint8_t rr) {
-  uint16_t sp = register_value_get(cpu,REG_SP);
+  uint16_t sp = cpu->registers.sp;
   uint8_t low = memory_get(cpu,sp);
   sp++;
   uint8_t high = memory_get(cpu,sp);
   sp++;
 
-  instruction_log(cpu, "POP %s", register_name_16(rr));
-  register_value_set(cpu,rr, (uint16_t)((high << 8) | low));
-  register_value_set(cpu,REG_SP, sp);
+  register_value_set(cpu, rr, (uint16_t)((high << 8) | low));
+  cpu->registers.sp = sp;
 }
 
 void inst_add_a_r(cpu_t *cpu, uint8_t op_code) {
-  const char *label = NULL;
-  uint8_t value = read_r_value(cpu, op_code, &label);
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint8_t value = read_r_value(cpu, op_code);
+  uint8_t a = cpu->registers.a;
   uint16_t sum = (uint16_t)(a + value);
   uint8_t result = (uint8_t)sum;
 
-  instruction_log(cpu, "ADD A,%s", label ? label : "?");
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_add(cpu, a, value, 0, result, sum);
 }
 
 void inst_add_a_n(cpu_t *cpu, uint8_t value) {
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint8_t a = cpu->registers.a;
   uint16_t sum = (uint16_t)(a + value);
   uint8_t result = (uint8_t)sum;
 
-  instruction_log(cpu, "ADD A,0x%02X", value);
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_add(cpu, a, value, 0, result, sum);
 }
 
 void inst_add_a_idx(cpu_t *cpu, uint8_t index_reg, uint8_t d) {
-  uint16_t address = register_value_get(cpu, index_reg);
-  uint8_t value = memory_get(cpu, (uint16_t)(address + d));
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint16_t address = register_file_get(&cpu->registers, index_reg);
+  uint8_t value = memory_get(cpu, (uint16_t)(address + (int8_t)d));
+  uint8_t a = cpu->registers.a;
   uint16_t sum = (uint16_t)(a + value);
   uint8_t result = (uint8_t)sum;
 
-  instruction_log(cpu, "ADD A,(%s%+d)", register_name_16(index_reg),
-                  (int8_t)d);
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_add(cpu, a, value, 0, result, sum);
 }
 
 void inst_adc_a_r(cpu_t *cpu, uint8_t op_code) {
-  const char *label = NULL;
-  uint8_t value = read_r_value(cpu, op_code, &label);
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint8_t value = read_r_value(cpu, op_code);
+  uint8_t a = cpu->registers.a;
   uint8_t flags = (uint8_t)register_value_get(cpu, REG_F);
   uint8_t carry = (flags & (1 << FLAG_C)) ? 1 : 0;
   uint16_t sum = (uint16_t)(a + value + carry);
   uint8_t result = (uint8_t)sum;
 
-  instruction_log(cpu, "ADC A,%s", label ? label : "?");
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_add(cpu, a, value, carry, result, sum);
 }
 
 void inst_adc_a_n(cpu_t *cpu, uint8_t value) {
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint8_t a = cpu->registers.a;
   uint8_t flags = (uint8_t)register_value_get(cpu, REG_F);
   uint8_t carry = (flags & (1 << FLAG_C)) ? 1 : 0;
   uint16_t sum = (uint16_t)(a + value + carry);
   uint8_t result = (uint8_t)sum;
 
-  instruction_log(cpu, "ADC A,0x%02X", value);
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_add(cpu, a, value, carry, result, sum);
 }
 
 void inst_adc_a_idx(cpu_t *cpu, uint8_t index_reg, uint8_t d) {
-  uint16_t address = register_value_get(cpu, index_reg);
-  uint8_t value = memory_get(cpu, (uint16_t)(address + d));
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint16_t address = register_file_get(&cpu->registers, index_reg);
+  uint8_t value = memory_get(cpu, (uint16_t)(address + (int8_t)d));
+  uint8_t a = cpu->registers.a;
   uint8_t flags = (uint8_t)register_value_get(cpu, REG_F);
   uint8_t carry = (flags & (1 << FLAG_C)) ? 1 : 0;
   uint16_t sum = (uint16_t)(a + value + carry);
   uint8_t result = (uint8_t)sum;
 
-  instruction_log(cpu, "ADC A,(%s%+d)", register_name_16(index_reg),
-                  (int8_t)d);
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_add(cpu, a, value, carry, result, sum);
 }
 
 void inst_sub_r(cpu_t *cpu, uint8_t op_code) {
-  const char *label = NULL;
-  uint8_t value = read_r_value(cpu, op_code, &label);
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint8_t value = read_r_value(cpu, op_code);
+  uint8_t a = cpu->registers.a;
   int16_t diff = (int16_t)a - (int16_t)value;
   uint8_t result = (uint8_t)diff;
 
-  instruction_log(cpu, "SUB %s", label ? label : "?");
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_sub(cpu, a, value, 0, result, diff);
 }
 
 void inst_sub_n(cpu_t *cpu, uint8_t value) {
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint8_t a = cpu->registers.a;
   int16_t diff = (int16_t)a - (int16_t)value;
   uint8_t result = (uint8_t)diff;
 
-  instruction_log(cpu, "SUB 0x%02X", value);
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_sub(cpu, a, value, 0, result, diff);
 }
 
 void inst_sub_idx(cpu_t *cpu, uint8_t index_reg, uint8_t d) {
-  uint16_t address = register_value_get(cpu, index_reg);
-  uint8_t value = memory_get(cpu, (uint16_t)(address + d));
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint16_t address = register_file_get(&cpu->registers, index_reg);
+  uint8_t value = memory_get(cpu, (uint16_t)(address + (int8_t)d));
+  uint8_t a = cpu->registers.a;
   int16_t diff = (int16_t)a - (int16_t)value;
   uint8_t result = (uint8_t)diff;
 
-  instruction_log(cpu, "SUB (%s%+d)", register_name_16(index_reg),
-                  (int8_t)d);
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_sub(cpu, a, value, 0, result, diff);
 }
 
 void inst_sbc_a_r(cpu_t *cpu, uint8_t op_code) {
-  const char *label = NULL;
-  uint8_t value = read_r_value(cpu, op_code, &label);
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint8_t value = read_r_value(cpu, op_code);
+  uint8_t a = cpu->registers.a;
   uint8_t flags = (uint8_t)register_value_get(cpu, REG_F);
   uint8_t carry = (flags & (1 << FLAG_C)) ? 1 : 0;
   int16_t diff = (int16_t)a - (int16_t)value - (int16_t)carry;
   uint8_t result = (uint8_t)diff;
 
-  instruction_log(cpu, "SBC A,%s", label ? label : "?");
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_sub(cpu, a, value, carry, result, diff);
 }
 
 void inst_sbc_a_n(cpu_t *cpu, uint8_t value) {
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint8_t a = cpu->registers.a;
   uint8_t flags = (uint8_t)register_value_get(cpu, REG_F);
   uint8_t carry = (flags & (1 << FLAG_C)) ? 1 : 0;
   int16_t diff = (int16_t)a - (int16_t)value - (int16_t)carry;
   uint8_t result = (uint8_t)diff;
 
-  instruction_log(cpu, "SBC A,0x%02X", value);
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_sub(cpu, a, value, carry, result, diff);
 }
 
 void inst_sbc_a_idx(cpu_t *cpu, uint8_t index_reg, uint8_t d) {
-  uint16_t address = register_value_get(cpu, index_reg);
-  uint8_t value = memory_get(cpu, (uint16_t)(address + d));
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint16_t address = register_file_get(&cpu->registers, index_reg);
+  uint8_t value = memory_get(cpu, (uint16_t)(address + (int8_t)d));
+  uint8_t a = cpu->registers.a;
   uint8_t flags = (uint8_t)register_value_get(cpu, REG_F);
   uint8_t carry = (flags & (1 << FLAG_C)) ? 1 : 0;
   int16_t diff = (int16_t)a - (int16_t)value - (int16_t)carry;
   uint8_t result = (uint8_t)diff;
 
-  instruction_log(cpu, "SBC A,(%s%+d)", register_name_16(index_reg),
-                  (int8_t)d);
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_sub(cpu, a, value, carry, result, diff);
 }
 
 void inst_inc_r(cpu_t *cpu, uint8_t op_code) {
   uint8_t reg = register_map((op_code & 0x38) >> 3);
-  uint8_t value = (uint8_t)register_value_get(cpu, reg);
+  uint8_t value = (uint8_t)register_file_get(&cpu->registers, reg);
   uint8_t result = inc_value(cpu, value);
 
-  instruction_log(cpu, "INC %s", register_name_8(reg));
-  register_value_set(cpu, reg, result);
+  register_file_set(&cpu->registers, reg, result);
 }
 
 void inst_inc_hl(cpu_t *cpu) {
-  uint16_t address = register_value_get(cpu, REG_HL);
+  uint16_t address = cpu->registers.hl;
   uint8_t value = memory_get(cpu, address);
   uint8_t result = inc_value(cpu, value);
 
-  instruction_log(cpu, "INC (HL)");
   memory_set(cpu, address, result);
 }
 
 void inst_inc_idx(cpu_t *cpu, uint8_t index_reg, uint8_t d) {
-  uint16_t address = register_value_get(cpu, index_reg);
-  uint16_t target = (uint16_t)(address + d);
+  uint16_t address = register_file_get(&cpu->registers, index_reg);
+  uint16_t target = (uint16_t)(address + (int8_t)d);
   uint8_t value = memory_get(cpu, target);
   uint8_t result = inc_value(cpu, value);
 
-  instruction_log(cpu, "INC (%s%+d)", register_name_16(index_reg),
-                  (int8_t)d);
   memory_set(cpu, target, result);
 }
 
 void inst_dec_r(cpu_t *cpu, uint8_t op_code) {
   uint8_t reg = register_map((op_code & 0x38) >> 3);
-  uint8_t value = (uint8_t)register_value_get(cpu, reg);
+  uint8_t value = (uint8_t)register_file_get(&cpu->registers, reg);
   uint8_t result = dec_value(cpu, value);
 
-  instruction_log(cpu, "DEC %s", register_name_8(reg));
-  register_value_set(cpu, reg, result);
+  register_file_set(&cpu->registers, reg, result);
 }
 
 void inst_dec_hl(cpu_t *cpu) {
-  uint16_t address = register_value_get(cpu, REG_HL);
+  uint16_t address = cpu->registers.hl;
   uint8_t value = memory_get(cpu, address);
   uint8_t result = dec_value(cpu, value);
 
-  instruction_log(cpu, "DEC (HL)");
   memory_set(cpu, address, result);
 }
 
 void inst_dec_idx(cpu_t *cpu, uint8_t index_reg, uint8_t d) {
-  uint16_t address = register_value_get(cpu, index_reg);
-  uint16_t target = (uint16_t)(address + d);
+  uint16_t address = register_file_get(&cpu->registers, index_reg);
+  uint16_t target = (uint16_t)(address + (int8_t)d);
   uint8_t value = memory_get(cpu, target);
   uint8_t result = dec_value(cpu, value);
 
-  instruction_log(cpu, "DEC (%s%+d)", register_name_16(index_reg),
-                  (int8_t)d);
   memory_set(cpu, target, result);
 }
 
@@ -1074,14 +502,6 @@ void inst_cb(cpu_t *cpu, uint8_t op_code, uint8_t use_index, uint8_t index_reg,
   uint8_t value = 0;
   uint8_t result = 0;
   uint8_t carry = 0;
-  uint8_t flags = (uint8_t)register_value_get(cpu, REG_F);
-  const char *target = NULL;
-
-  if (use_index || r_bits == 0x06) {
-    target = use_index ? "(IX/IY+d)" : "(HL)";
-  } else {
-    target = register_name_8(register_map(r_bits));
-  }
 
   value = cb_read_value(cpu, r_bits, use_index, index_reg, d, &address);
 
@@ -1090,31 +510,31 @@ void inst_cb(cpu_t *cpu, uint8_t op_code, uint8_t use_index, uint8_t index_reg,
     case 0x00: // RLC
       carry = (value >> 7) & 1;
       result = (uint8_t)((value << 1) | carry);
-      instruction_log(cpu, "RLC %s", target);
       update_flags_rotate(cpu, result, carry);
       cb_write_value(cpu, r_bits, use_index, index_reg, d, address, result);
       return;
     case 0x01: // RRC
       carry = value & 1;
       result = (uint8_t)((value >> 1) | (carry << 7));
-      instruction_log(cpu, "RRC %s", target);
       update_flags_rotate(cpu, result, carry);
       cb_write_value(cpu, r_bits, use_index, index_reg, d, address, result);
       return;
     case 0x02: { // RL
+      uint8_t flags = (uint8_t)register_value_get(cpu, REG_F);
       uint8_t carry_in = (flags & (1 << FLAG_C)) ? 1 : 0;
+
       carry = (value >> 7) & 1;
       result = (uint8_t)((value << 1) | carry_in);
-      instruction_log(cpu, "RL %s", target);
       update_flags_rotate(cpu, result, carry);
       cb_write_value(cpu, r_bits, use_index, index_reg, d, address, result);
       return;
     }
     case 0x03: { // RR
+      uint8_t flags = (uint8_t)register_value_get(cpu, REG_F);
       uint8_t carry_in = (flags & (1 << FLAG_C)) ? 1 : 0;
+
       carry = value & 1;
       result = (uint8_t)((value >> 1) | (carry_in << 7));
-      instruction_log(cpu, "RR %s", target);
       update_flags_rotate(cpu, result, carry);
       cb_write_value(cpu, r_bits, use_index, index_reg, d, address, result);
       return;
@@ -1122,28 +542,24 @@ void inst_cb(cpu_t *cpu, uint8_t op_code, uint8_t use_index, uint8_t index_reg,
     case 0x04: // SLA
       carry = (value >> 7) & 1;
       result = (uint8_t)(value << 1);
-      instruction_log(cpu, "SLA %s", target);
       update_flags_rotate(cpu, result, carry);
       cb_write_value(cpu, r_bits, use_index, index_reg, d, address, result);
       return;
     case 0x05: // SRA
       carry = value & 1;
       result = (uint8_t)((value >> 1) | (value & 0x80));
-      instruction_log(cpu, "SRA %s", target);
       update_flags_rotate(cpu, result, carry);
       cb_write_value(cpu, r_bits, use_index, index_reg, d, address, result);
       return;
     case 0x06: // SLL (undocumented)
       carry = (value >> 7) & 1;
       result = (uint8_t)((value << 1) | 0x01);
-      instruction_log(cpu, "SLL %s", target);
       update_flags_rotate(cpu, result, carry);
       cb_write_value(cpu, r_bits, use_index, index_reg, d, address, result);
       return;
     case 0x07: // SRL
       carry = value & 1;
       result = (uint8_t)(value >> 1);
-      instruction_log(cpu, "SRL %s", target);
       update_flags_rotate(cpu, result, carry);
       cb_write_value(cpu, r_bits, use_index, index_reg, d, address, result);
       return;
@@ -1153,153 +569,119 @@ void inst_cb(cpu_t *cpu, uint8_t op_code, uint8_t use_index, uint8_t index_reg,
   } else if (group == 1) { // BIT
     uint8_t bit = op;
     uint8_t mask = (uint8_t)(1u << bit);
-    uint8_t is_set = (value & mask) != 0;
-    uint8_t carry_flag = (flags & (1 << FLAG_C)) ? 1 : 0;
 
-    instruction_log(cpu, "BIT %u,%s", bit, target);
-    if (bit == 7)
-      flag_set(cpu, FLAG_S, is_set);
-    else
-      flag_set(cpu, FLAG_S, 0);
-    flag_set(cpu, FLAG_Z, !is_set);
-    flag_set(cpu, FLAG_H, 1);
-    flag_set(cpu, FLAG_PV, !is_set);
-    register_flag_unset(cpu, FLAG_N);
-    flag_set(cpu, FLAG_C, carry_flag);
+    flags_record(cpu, FLAGS_BIT, 0, value, 0, value & mask, value & mask);
     return;
   } else if (group == 2) { // RES
     uint8_t bit = op;
     result = (uint8_t)(value & ~(1u << bit));
-    instruction_log(cpu, "RES %u,%s", bit, target);
     cb_write_value(cpu, r_bits, use_index, index_reg, d, address, result);
     return;
   } else if (group == 3) { // SET
     uint8_t bit = op;
     result = (uint8_t)(value | (1u << bit));
-    instruction_log(cpu, "SET %u,%s", bit, target);
     cb_write_value(cpu, r_bits, use_index, index_reg, d, address, result);
     return;
   }
 
-  instruction_log(cpu, "CB 0x%02X", op_code);
 }
 
 void inst_and_r(cpu_t *cpu, uint8_t op_code) {
-  const char *label = NULL;
-  uint8_t value = read_r_value(cpu, op_code, &label);
-  uint8_t result = (uint8_t)register_value_get(cpu, REG_A) & value;
+  uint8_t value = read_r_value(cpu, op_code);
+  uint8_t result = cpu->registers.a & value;
 
-  instruction_log(cpu, "AND %s", label ? label : "?");
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_logic(cpu, result, 1);
 }
 
 void inst_and_n(cpu_t *cpu, uint8_t value) {
-  uint8_t result = (uint8_t)register_value_get(cpu, REG_A) & value;
+  uint8_t result = cpu->registers.a & value;
 
-  instruction_log(cpu, "AND 0x%02X", value);
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_logic(cpu, result, 1);
 }
 
 void inst_and_idx(cpu_t *cpu, uint8_t index_reg, uint8_t d) {
-  uint16_t address = register_value_get(cpu, index_reg);
-  uint8_t value = memory_get(cpu, (uint16_t)(address + d));
-  uint8_t result = (uint8_t)register_value_get(cpu, REG_A) & value;
+  uint16_t address = register_file_get(&cpu->registers, index_reg);
+  uint8_t value = memory_get(cpu, (uint16_t)(address + (int8_t)d));
+  uint8_t result = cpu->registers.a & value;
 
-  instruction_log(cpu, "AND (%s%+d)", register_name_16(index_reg),
-                  (int8_t)d);
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_logic(cpu, result, 1);
 }
 
 void inst_or_r(cpu_t *cpu, uint8_t op_code) {
-  const char *label = NULL;
-  uint8_t value = read_r_value(cpu, op_code, &label);
-  uint8_t result = (uint8_t)register_value_get(cpu, REG_A) | value;
+  uint8_t value = read_r_value(cpu, op_code);
+  uint8_t result = cpu->registers.a | value;
 
-  instruction_log(cpu, "OR %s", label ? label : "?");
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_logic(cpu, result, 0);
 }
 
 void inst_or_n(cpu_t *cpu, uint8_t value) {
-  uint8_t result = (uint8_t)register_value_get(cpu, REG_A) | value;
+  uint8_t result = cpu->registers.a | value;
 
-  instruction_log(cpu, "OR 0x%02X", value);
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_logic(cpu, result, 0);
 }
 
 void inst_or_idx(cpu_t *cpu, uint8_t index_reg, uint8_t d) {
-  uint16_t address = register_value_get(cpu, index_reg);
-  uint8_t value = memory_get(cpu, (uint16_t)(address + d));
-  uint8_t result = (uint8_t)register_value_get(cpu, REG_A) | value;
+  uint16_t address = register_file_get(&cpu->registers, index_reg);
+  uint8_t value = memory_get(cpu, (uint16_t)(address + (int8_t)d));
+  uint8_t result = cpu->registers.a | value;
 
-  instruction_log(cpu, "OR (%s%+d)", register_name_16(index_reg),
-                  (int8_t)d);
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_logic(cpu, result, 0);
 }
 
 void inst_xor_r(cpu_t *cpu, uint8_t op_code) {
-  const char *label = NULL;
-  uint8_t value = read_r_value(cpu, op_code, &label);
-  uint8_t result = (uint8_t)register_value_get(cpu, REG_A) ^ value;
+  uint8_t value = read_r_value(cpu, op_code);
+  uint8_t result = cpu->registers.a ^ value;
 
-  instruction_log(cpu, "XOR %s", label ? label : "?");
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_logic(cpu, result, 0);
 }
 
 void inst_xor_n(cpu_t *cpu, uint8_t value) {
-  uint8_t result = (uint8_t)register_value_get(cpu, REG_A) ^ value;
+  uint8_t result = cpu->registers.a ^ value;
 
-  instruction_log(cpu, "XOR 0x%02X", value);
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_logic(cpu, result, 0);
 }
 
 void inst_xor_idx(cpu_t *cpu, uint8_t index_reg, uint8_t d) {
-  uint16_t address = register_value_get(cpu, index_reg);
-  uint8_t value = memory_get(cpu, (uint16_t)(address + d));
-  uint8_t result = (uint8_t)register_value_get(cpu, REG_A) ^ value;
+  uint16_t address = register_file_get(&cpu->registers, index_reg);
+  uint8_t value = memory_get(cpu, (uint16_t)(address + (int8_t)d));
+  uint8_t result = cpu->registers.a ^ value;
 
-  instruction_log(cpu, "XOR (%s%+d)", register_name_16(index_reg),
-                  (int8_t)d);
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_logic(cpu, result, 0);
 }
 
 void inst_cp_r(cpu_t *cpu, uint8_t op_code) {
-  const char *label = NULL;
-  uint8_t value = read_r_value(cpu, op_code, &label);
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint8_t value = read_r_value(cpu, op_code);
+  uint8_t a = cpu->registers.a;
   int16_t diff = (int16_t)a - (int16_t)value;
   uint8_t result = (uint8_t)diff;
 
-  instruction_log(cpu, "CP %s", label ? label : "?");
   update_flags_sub(cpu, a, value, 0, result, diff);
 }
 
 void inst_cp_n(cpu_t *cpu, uint8_t value) {
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint8_t a = cpu->registers.a;
   int16_t diff = (int16_t)a - (int16_t)value;
   uint8_t result = (uint8_t)diff;
 
-  instruction_log(cpu, "CP 0x%02X", value);
   update_flags_sub(cpu, a, value, 0, result, diff);
 }
 
 void inst_cp_idx(cpu_t *cpu, uint8_t index_reg, uint8_t d) {
-  uint16_t address = register_value_get(cpu, index_reg);
-  uint8_t value = memory_get(cpu, (uint16_t)(address + d));
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint16_t address = register_file_get(&cpu->registers, index_reg);
+  uint8_t value = memory_get(cpu, (uint16_t)(address + (int8_t)d));
+  uint8_t a = cpu->registers.a;
   int16_t diff = (int16_t)a - (int16_t)value;
   uint8_t result = (uint8_t)diff;
 
-  instruction_log(cpu, "CP (%s%+d)", register_name_16(index_reg),
-                  (int8_t)d);
   update_flags_sub(cpu, a, value, 0, result, diff);
 }
 
@@ -1315,13 +697,12 @@ void inst_add_hl_rr(cpu_t *cpu, uint16_t op_code) {
   else
     rr = REG_SP;
 
-  uint16_t hl = register_value_get(cpu, REG_HL);
-  uint16_t value = register_value_get(cpu, rr);
+  uint16_t hl = cpu->registers.hl;
+  uint16_t value = register_file_get(&cpu->registers, rr);
   uint32_t sum = (uint32_t)hl + (uint32_t)value;
   uint16_t result = (uint16_t)sum;
 
-  instruction_log(cpu, "ADD HL,%s", register_name_16(rr));
-  register_value_set(cpu, REG_HL, result);
+  cpu->registers.hl = result;
   update_flags_add16_hl(cpu, hl, value, sum);
 }
 
@@ -1337,14 +718,12 @@ void inst_add_ix_iy_rr(cpu_t *cpu, uint16_t op_code, uint8_t index_reg) {
   else
     rr = REG_SP;
 
-  uint16_t idx_value = register_value_get(cpu, index_reg);
-  uint16_t value = register_value_get(cpu, rr);
+  uint16_t idx_value = register_file_get(&cpu->registers, index_reg);
+  uint16_t value = register_file_get(&cpu->registers, rr);
   uint32_t sum = (uint32_t)idx_value + (uint32_t)value;
   uint16_t result = (uint16_t)sum;
 
-  instruction_log(cpu, "ADD %s,%s", register_name_16(index_reg),
-                  register_name_16(rr));
-  register_value_set(cpu, index_reg, result);
+  register_file_set(&cpu->registers, index_reg, result);
   update_flags_add16_hl(cpu, idx_value, value, sum);
 }
 
@@ -1360,15 +739,14 @@ void inst_adc_hl_rr(cpu_t *cpu, uint16_t op_code) {
   else
     rr = REG_SP;
 
-  uint16_t hl = register_value_get(cpu, REG_HL);
-  uint16_t value = register_value_get(cpu, rr);
+  uint16_t hl = cpu->registers.hl;
+  uint16_t value = register_file_get(&cpu->registers, rr);
   uint8_t flags = (uint8_t)register_value_get(cpu, REG_F);
   uint16_t carry = (flags & (1 << FLAG_C)) ? 1 : 0;
   uint32_t sum = (uint32_t)hl + (uint32_t)value + carry;
   uint16_t result = (uint16_t)sum;
 
-  instruction_log(cpu, "ADC HL,%s", register_name_16(rr));
-  register_value_set(cpu, REG_HL, result);
+  cpu->registers.hl = result;
   update_flags_add16_full(cpu, hl, value, carry, result, sum);
 }
 
@@ -1384,15 +762,14 @@ void inst_sbc_hl_rr(cpu_t *cpu, uint16_t op_code) {
   else
     rr = REG_SP;
 
-  uint16_t hl = register_value_get(cpu, REG_HL);
-  uint16_t value = register_value_get(cpu, rr);
+  uint16_t hl = cpu->registers.hl;
+  uint16_t value = register_file_get(&cpu->registers, rr);
   uint8_t flags = (uint8_t)register_value_get(cpu, REG_F);
   uint16_t carry = (flags & (1 << FLAG_C)) ? 1 : 0;
   int32_t diff = (int32_t)hl - (int32_t)value - (int32_t)carry;
   uint16_t result = (uint16_t)diff;
 
-  instruction_log(cpu, "SBC HL,%s", register_name_16(rr));
-  register_value_set(cpu, REG_HL, result);
+  cpu->registers.hl = result;
   update_flags_sub16_full(cpu, hl, value, carry, result, diff);
 }
 
@@ -1415,8 +792,8 @@ void inst_inc_rr(cpu_t *cpu, uint16_t op_code) {
       rr = REG_SP;
   }
 
-  instruction_log(cpu, "INC %s", register_name_16(rr));
-  register_value_set(cpu, rr, (uint16_t)(register_value_get(cpu, rr) + 1));
+  register_file_set(&cpu->registers, rr,
+                    (uint16_t)(register_file_get(&cpu->registers, rr) + 1));
 }
 
 void inst_dec_rr(cpu_t *cpu, uint16_t op_code) {
@@ -1438,136 +815,121 @@ void inst_dec_rr(cpu_t *cpu, uint16_t op_code) {
       rr = REG_SP;
   }
 
-  instruction_log(cpu, "DEC %s", register_name_16(rr));
-  register_value_set(cpu, rr, (uint16_t)(register_value_get(cpu, rr) - 1));
+  register_file_set(&cpu->registers, rr,
+                    (uint16_t)(register_file_get(&cpu->registers, rr) - 1));
 }
 
 void inst_jr(cpu_t *cpu, uint8_t op_code, uint8_t displacement) {
   int8_t offset = (int8_t)displacement;
-  uint16_t pc = register_value_get(cpu, REG_PC);
+  uint16_t pc = cpu->registers.pc;
   int take = 0;
 
   if (op_code == 0x18) {
-    instruction_log(cpu, "JR %+d", offset);
     take = 1;
   } else {
     uint8_t condition = (op_code >> 3) & 0x03;
-    instruction_log(cpu, "JR %s,%+d", condition_label(condition), offset);
     take = condition_true(cpu, condition);
   }
 
   if (take) {
-    register_value_set(cpu, REG_PC, (uint16_t)(pc + offset));
+    cpu->registers.pc = (uint16_t)(pc + offset);
+  }
+}
+
+void inst_djnz(cpu_t *cpu, uint8_t displacement) {
+  uint8_t b = (uint8_t)(cpu->registers.b - 1);
+
+  cpu->registers.b = b;
+  if (b != 0) {
+    cpu->registers.pc = (uint16_t)(cpu->registers.pc + (int8_t)displacement);
   }
 }
 
 void inst_jp(cpu_t *cpu, uint16_t op_code, uint16_t address) {
   if (op_code == 0xE9) {
-    instruction_log(cpu, "JP (HL)");
-    register_value_set(cpu, REG_PC, register_value_get(cpu, REG_HL));
+    cpu->registers.pc = cpu->registers.hl;
     return;
   }
   if (op_code == 0xDDE9) {
-    instruction_log(cpu, "JP (IX)");
-    register_value_set(cpu, REG_PC, register_value_get(cpu, REG_IX));
+    cpu->registers.pc = cpu->registers.ix;
     return;
   }
   if (op_code == 0xFDE9) {
-    instruction_log(cpu, "JP (IY)");
-    register_value_set(cpu, REG_PC, register_value_get(cpu, REG_IY));
+    cpu->registers.pc = cpu->registers.iy;
     return;
   }
 
   if (op_code == 0xC3) {
-    instruction_log(cpu, "JP 0x%04X", address);
-    register_value_set(cpu, REG_PC, address);
+    cpu->registers.pc = address;
     return;
   }
 
   if ((op_code & 0xC7) == 0xC2) {
     uint8_t condition = (op_code >> 3) & 0x07;
-    instruction_log(cpu, "JP %s,0x%04X", condition_label(condition), address);
     if (condition_true(cpu, condition))
-      register_value_set(cpu, REG_PC, address);
+      cpu->registers.pc = address;
     return;
   }
 
-  instruction_log(cpu, "JP 0x%04X", address);
-  register_value_set(cpu, REG_PC, address);
+  cpu->registers.pc = address;
 }
 
 void inst_call(cpu_t *cpu, uint16_t op_code, uint16_t address) {
-  uint16_t pc = register_value_get(cpu, REG_PC);
+  uint16_t pc = cpu->registers.pc;
   int take = 1;
 
   if (op_code != 0xCD) {
     uint8_t condition = (op_code >> 3) & 0x07;
-    instruction_log(cpu, "CALL %s,0x%04X", condition_label(condition),
-                    address);
     take = condition_true(cpu, condition);
-  } else {
-    instruction_log(cpu, "CALL 0x%04X", address);
   }
 
   if (!take)
     return;
 
-  uint16_t sp = register_value_get(cpu, REG_SP);
+  uint16_t sp = cpu->registers.sp;
   sp--;
   memory_set(cpu, sp, (uint8_t)((pc >> 8) & 0x00FF));
   sp--;
   memory_set(cpu, sp, (uint8_t)(pc & 0x00FF));
-  register_value_set(cpu, REG_SP, sp);
-  register_value_set(cpu, REG_PC, address);
+  cpu->registers.sp = sp;
+  cpu->registers.pc = address;
 }
 
 void inst_ret(cpu_t *cpu, uint16_t op_code) {
   int take = 1;
 
-  if (op_code == 0xC9) {
-    instruction_log(cpu, "RET");
-  } else if ((op_code & 0xC7) == 0xC0) {
+  if ((op_code & 0xC7) == 0xC0) {
     uint8_t condition = (op_code >> 3) & 0x07;
-    instruction_log(cpu, "RET %s", condition_label(condition));
     take = condition_true(cpu, condition);
-  } else if (op_code == 0xED4D || op_code == 0xED5D || op_code == 0xED6D ||
-             op_code == 0xED7D) {
-    instruction_log(cpu, "RETI");
-  } else if (op_code == 0xED45 || op_code == 0xED55 || op_code == 0xED65 ||
-             op_code == 0xED75) {
-    instruction_log(cpu, "RETN");
-  } else {
-    instruction_log(cpu, "RET");
   }
 
   if (!take)
     return;
 
-  uint16_t sp = register_value_get(cpu, REG_SP);
+  uint16_t sp = cpu->registers.sp;
   uint8_t low = memory_get(cpu, sp);
   sp++;
   uint8_t high = memory_get(cpu, sp);
   sp++;
-  register_value_set(cpu, REG_SP, sp);
-  register_value_set(cpu, REG_PC, (uint16_t)((high << 8) | low));
+  cpu->registers.sp = sp;
+  cpu->registers.pc = (uint16_t)((high << 8) | low);
 }
 
 void inst_rst(cpu_t *cpu, uint8_t op_code) {
-  uint16_t pc = register_value_get(cpu, REG_PC);
-  uint16_t sp = register_value_get(cpu, REG_SP);
+  uint16_t pc = cpu->registers.pc;
+  uint16_t sp = cpu->registers.sp;
   uint16_t vector = (uint16_t)(op_code & 0x38);
 
-  instruction_log(cpu, "RST 0x%02X", (uint8_t)vector);
   sp--;
   memory_set(cpu, sp, (uint8_t)((pc >> 8) & 0x00FF));
   sp--;
   memory_set(cpu, sp, (uint8_t)(pc & 0x00FF));
-  register_value_set(cpu, REG_SP, sp);
-  register_value_set(cpu, REG_PC, vector);
+  cpu->registers.sp = sp;
+  cpu->registers.pc = vector;
 }
 
 void inst_daa(cpu_t *cpu) {
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint8_t a = cpu->registers.a;
   uint8_t flags = (uint8_t)register_value_get(cpu, REG_F);
   uint8_t adjust = 0;
   uint8_t carry = (flags & (1 << FLAG_C)) ? 1 : 0;
@@ -1591,32 +953,29 @@ void inst_daa(cpu_t *cpu) {
     result = (uint8_t)(a - adjust);
   }
 
-  instruction_log(cpu, "DAA");
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   flag_set(cpu, FLAG_S, result & 0x80);
   flag_set(cpu, FLAG_Z, result == 0);
   flag_set(cpu, FLAG_H, ((a ^ result) & 0x10) != 0);
-  flag_set(cpu, FLAG_PV, parity_even(result));
+  flag_set(cpu, FLAG_PV, flags_szp[result] & (1 << FLAG_PV));
   flag_set(cpu, FLAG_C, carry);
 }
 
 void inst_cpl(cpu_t *cpu) {
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint8_t a = cpu->registers.a;
   uint8_t result = (uint8_t)~a;
 
-  instruction_log(cpu, "CPL");
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   register_flag_set(cpu, FLAG_H);
   register_flag_set(cpu, FLAG_N);
 }
 
 void inst_neg(cpu_t *cpu) {
-  uint8_t a = (uint8_t)register_value_get(cpu, REG_A);
+  uint8_t a = cpu->registers.a;
   int16_t diff = 0 - (int16_t)a;
   uint8_t result = (uint8_t)diff;
 
-  instruction_log(cpu, "NEG");
-  register_value_set(cpu, REG_A, result);
+  cpu->registers.a = result;
   update_flags_sub(cpu, 0, a, 0, result, diff);
 }
 
@@ -1624,159 +983,1129 @@ void inst_ccf(cpu_t *cpu) {
   uint8_t flags = (uint8_t)register_value_get(cpu, REG_F);
   uint8_t carry = (flags & (1 << FLAG_C)) ? 1 : 0;
 
-  instruction_log(cpu, "CCF");
   flag_set(cpu, FLAG_C, !carry);
   flag_set(cpu, FLAG_H, carry);
   register_flag_unset(cpu, FLAG_N);
 }
 
 void inst_scf(cpu_t *cpu) {
-  instruction_log(cpu, "SCF");
   register_flag_set(cpu, FLAG_C);
   register_flag_unset(cpu, FLAG_H);
   register_flag_unset(cpu, FLAG_N);
 }
 
+// RLCA, RRCA, RLA and RRA: unlike the CB rotates, S, Z and P/V are kept.
+void inst_rot_a(cpu_t *cpu, uint8_t op_code) {
+  uint8_t flags = (uint8_t)register_value_get(cpu, REG_F);
+  uint8_t carry = (flags & (1 << FLAG_C)) ? 1 : 0;
+  uint8_t a = cpu->registers.a;
+  uint8_t result = 0;
+
+  switch ((op_code >> 3) & 0x03) {
+  case 0: // RLCA
+    carry = a >> 7;
+    result = (uint8_t)((a << 1) | carry);
+    break;
+  case 1: // RRCA
+    carry = a & 0x01;
+    result = (uint8_t)((a >> 1) | (carry << 7));
+    break;
+  case 2: // RLA
+    result = (uint8_t)((a << 1) | carry);
+    carry = a >> 7;
+    break;
+  default: // RRA
+    result = (uint8_t)((a >> 1) | (carry << 7));
+    carry = a & 0x01;
+    break;
+  }
+
+  cpu->registers.a = result;
+  flag_set(cpu, FLAG_C, carry);
+  register_flag_unset(cpu, FLAG_H);
+  register_flag_unset(cpu, FLAG_N);
+}
+
 void inst_halt(cpu_t *cpu) {
-  instruction_log(cpu, "HALT");
   cpu->halted = true;
 }
 
 void inst_di(cpu_t *cpu) {
-  instruction_log(cpu, "DI");
-  cpu->interrupts_enabled = false;
+  cpu->interrupt.iff1 = false;
+  cpu->interrupt.iff2 = false;
 }
 
+// INT is not accepted until the instruction after EI has run.
 void inst_ei(cpu_t *cpu) {
-  instruction_log(cpu, "EI");
-  cpu->interrupts_enabled = true;
+  cpu->interrupt.iff1 = true;
+  cpu->interrupt.iff2 = true;
+  cpu->interrupt.ei_delay = true;
+  interrupt_poll(cpu);
 }
 
 void inst_im(cpu_t *cpu, uint8_t mode) {
-  instruction_log(cpu, "IM %u", mode);
-  cpu->interrupt_mode = mode;
+  cpu->interrupt.mode = mode;
 }
 
-void inst_blkt(cpu_t *cpu, uint16_t op_code) {
-  uint8_t hl_value = 0;
-  uint8_t repeat = 0;
-  uint8_t op = (uint8_t)(op_code & 0x00FF);
-
-  if (op == 0xA0) {
-    instruction_log(cpu, "LDI");
-  } else if (op == 0xA8) {
-    instruction_log(cpu, "LDD");
-  } else if (op == 0xB0) {
-    instruction_log(cpu, "LDIR");
-  } else if (op == 0xB8) {
-    instruction_log(cpu, "LDDR");
-  } else {
-    instruction_log(cpu, "LDI/LDD/LDIR/LDDR");
+// RETN and RETI both restore IFF1 from IFF2.
+void inst_retn(cpu_t *cpu) {
+  inst_ret(cpu, 0xC9);
+  cpu->interrupt.iff1 = cpu->interrupt.iff2;
+  if (interrupt_pending(cpu))
+    interrupt_poll(cpu);
+}
+
+// LD A,I and LD A,R copy IFF2 into P/V.
+void inst_load_a_ir(cpu_t *cpu, uint8_t source) {
+  uint8_t value = (uint8_t)register_value_get(cpu, source);
+
+  cpu->registers.a = value;
+  flag_set(cpu, FLAG_S, value & 0x80);
+  flag_set(cpu, FLAG_Z, value == 0);
+  flag_set(cpu, FLAG_PV, cpu->interrupt.iff2);
+  register_flag_unset(cpu, FLAG_H);
+  register_flag_unset(cpu, FLAG_N);
+}
+
+void inst_in(cpu_t *cpu, uint16_t op_code, uint16_t port) {
+  uint8_t value = cpu->io.read(cpu->io.context, port);
+  uint8_t reg;
+
+  if (op_code == 0xDB) {
+    cpu->registers.a = value;
+    return;
   }
 
-  while (1) {
-    uint16_t hl = register_value_get(cpu, REG_HL);
-    uint16_t de = register_value_get(cpu, REG_DE);
-    uint16_t bc = register_value_get(cpu, REG_BC);
+  reg = register_map((op_code >> 3) & 0x07);
+  register_value_set(cpu, reg, value);
+  flag_set(cpu, FLAG_S, value & 0x80);
+  flag_set(cpu, FLAG_Z, value == 0);
+  register_flag_unset(cpu, FLAG_H);
+  flag_set(cpu, FLAG_PV, flags_szp[value] & (1 << FLAG_PV));
+  register_flag_unset(cpu, FLAG_N);
+}
+
+void inst_out(cpu_t *cpu, uint16_t op_code, uint16_t port) {
+  uint8_t reg;
 
-    hl_value = memory_get(cpu, hl);
-    memory_set(cpu, de, hl_value);
+  if (op_code == 0xD3) {
+    cpu->io.write(cpu->io.context, port, cpu->registers.a);
+    return;
+  }
 
-    if (op_code & 0x0008) {
-      de = (uint16_t)(de - 1);
-      hl = (uint16_t)(hl - 1);
+  reg = register_map((op_code >> 3) & 0x07);
+  cpu->io.write(cpu->io.context, port,
+                (uint8_t)register_value_get(cpu, reg));
+}
+
+// Bytes from address to the end of its memory page in the direction of a
+// block instruction, so a chunk never leaves the page its pointer covers.
+static inline uint32_t block_page_run(uint16_t address, bool down) {
+  return down ? (uint32_t)(address & MEMORY_PAGE_MASK) + 1
+              : MEMORY_PAGE_SIZE - (address & MEMORY_PAGE_MASK);
+}
+
+// Copy count bytes for LDIR/LDDR a page-sized chunk at a time through the
+// page pointers. A destination just ahead of the source (LDIR) or just
+// behind it (LDDR) repeats the source bytes, exactly as the byte-at-a-time
+// copy does, so those overlaps copy in order instead of with memmove.
+// Chunks on pages without plain pointers go through memory_get/memory_set,
+// except RAM that only holds cached code, which is written directly and
+// invalidated here.
+static void block_copy_bulk(cpu_t *cpu, uint16_t hl, uint16_t de,
+                            uint32_t count, bool down) {
+  uint16_t src = hl;
+  uint16_t dst = de;
+
+  for (uint32_t left = count; left > 0;) {
+    uint32_t n = block_page_run(src, down);
+    uint32_t run = block_page_run(dst, down);
+    const uint8_t *from = cpu->memory.read[src >> MEMORY_PAGE_SHIFT];
+    uint8_t *to = cpu->memory.write[dst >> MEMORY_PAGE_SHIFT];
+    uint8_t flags = cpu->memory.flags[dst >> MEMORY_PAGE_SHIFT];
+    uint16_t low = dst;
+
+    if (run < n)
+      n = run;
+    if (left < n)
+      n = left;
+    if (!to && flags == (MEMORY_RAM | MEMORY_CODE) && !cpu->memory.observe &&
+        memory_page_dirty(cpu, dst))
+      to = cpu->memory.data[dst >> MEMORY_PAGE_SHIFT];
+
+    if (!from || !to) {
+      for (uint32_t i = 0; i < n; i++) {
+        uint16_t offset = (uint16_t)(down ? 0 - i : i);
+
+        memory_set(cpu, (uint16_t)(dst + offset),
+                   memory_get(cpu, (uint16_t)(src + offset)));
+      }
     } else {
-      de = (uint16_t)(de + 1);
-      hl = (uint16_t)(hl + 1);
+      const uint8_t *s = from + (src & MEMORY_PAGE_MASK);
+      uint8_t *d = to + (dst & MEMORY_PAGE_MASK);
+
+      if (down) {
+        s -= n - 1;
+        d -= n - 1;
+        low = (uint16_t)(dst - (n - 1));
+      }
+      if (!down && d > s && d < s + n) {
+        if (d == s + 1)
+          memset(d, *s, n);
+        else
+          for (uint32_t i = 0; i < n; i++)
+            d[i] = s[i];
+      } else if (down && d < s && d + n > s) {
+        for (uint32_t i = n; i-- > 0;)
+          d[i] = s[i];
+      } else {
+        memmove(d, s, n);
+      }
+
+      if (cpu->blocks) {
+        for (uint32_t page = low >> BLOCK_PAGE_SHIFT;
+             page <= (low + n - 1u) >> BLOCK_PAGE_SHIFT; page++) {
+          if (cpu->blocks->code_pages[page])
+            block_cache_invalidate(cpu, (uint16_t)(page << BLOCK_PAGE_SHIFT));
+        }
+      }
     }
 
-    bc = (uint16_t)(bc - 1);
-    register_value_set(cpu, REG_DE, de);
-    register_value_set(cpu, REG_HL, hl);
-    register_value_set(cpu, REG_BC, bc);
+    src = (uint16_t)(down ? src - n : src + n);
+    dst = (uint16_t)(down ? dst - n : dst + n);
+    left -= n;
+  }
+}
 
-    // Flags: H and N reset, P/V set if BC != 0, S/Z/C unchanged.
-    register_flag_unset(cpu,FLAG_H);
-    register_flag_unset(cpu,FLAG_N);
-    if (bc != 0) {
-      register_flag_set(cpu,FLAG_PV);
-    } else {
-      register_flag_unset(cpu,FLAG_PV);
-    }
-    repeat = ((op_code & 0x00FF) == 0x00B0 || (op_code & 0x00FF) == 0x00B8);
-    if (repeat && bc > 0) {
-      continue;
-    }
+// LDI/LDD/LDIR/LDDR. Runs up to limit iterations (1 for LDI/LDD) and
+// returns how many ran; the caller winds the PC back while BC != 0.
+uint32_t inst_blkt(cpu_t *cpu, uint16_t op_code, uint32_t limit) {
+  bool down = (op_code & 0x0008) != 0;
+  uint16_t hl = cpu->registers.hl;
+  uint16_t de = cpu->registers.de;
+  uint16_t bc = cpu->registers.bc;
+  uint32_t remaining = bc ? bc : 0x10000;
+  uint32_t count = limit < remaining ? limit : remaining;
 
-    break;
+  if (count == 0)
+    count = 1;
+  block_copy_bulk(cpu, hl, de, count, down);
+
+  if (down) {
+    hl = (uint16_t)(hl - count);
+    de = (uint16_t)(de - count);
+  } else {
+    hl = (uint16_t)(hl + count);
+    de = (uint16_t)(de + count);
   }
+  bc = (uint16_t)(bc - count);
+  cpu->registers.de = de;
+  cpu->registers.hl = hl;
+  cpu->registers.bc = bc;
+
+  // Flags: H and N reset, P/V set if BC != 0, S/Z/C unchanged.
+  register_flag_unset(cpu, FLAG_H);
+  register_flag_unset(cpu, FLAG_N);
+  flag_set(cpu, FLAG_PV, bc != 0);
+  return count;
 }
 
-void inst_blks(cpu_t *cpu, uint16_t op_code) {
-  uint8_t a_value = (uint8_t)register_value_get(cpu, REG_A);
+// Offset of the first byte equal to a among count bytes from hl, scanning
+// down for CPDR, or count if there is none. Scans a page at a time, with
+// memchr going up.
+static uint32_t block_search(cpu_t *cpu, uint16_t hl, uint8_t a,
+                             uint32_t count, bool down) {
+  uint16_t at = hl;
+
+  for (uint32_t done = 0; done < count;) {
+    uint32_t n = block_page_run(at, down);
+    const uint8_t *page = cpu->memory.read[at >> MEMORY_PAGE_SHIFT];
+
+    if (count - done < n)
+      n = count - done;
+
+    if (!page) {
+      for (uint32_t i = 0; i < n; i++) {
+        uint16_t offset = (uint16_t)(down ? 0 - i : i);
+
+        if (memory_get(cpu, (uint16_t)(at + offset)) == a)
+          return done + i;
+      }
+    } else if (!down) {
+      const uint8_t *start = page + (at & MEMORY_PAGE_MASK);
+      const uint8_t *found = memchr(start, a, n);
+
+      if (found)
+        return done + (uint32_t)(found - start);
+    } else {
+      const uint8_t *start = page + (at & MEMORY_PAGE_MASK);
+
+      for (uint32_t i = 0; i < n; i++) {
+        if (*(start - i) == a)
+          return done + i;
+      }
+    }
+
+    at = (uint16_t)(down ? at - n : at + n);
+    done += n;
+  }
+  return count;
+}
+
+// CPI/CPD/CPIR/CPDR. Compares up to limit bytes (1 for CPI/CPD), stopping
+// at a match, and returns how many were compared. Flags come from the last
+// comparison; the caller winds the PC back while BC != 0 and Z is clear.
+uint32_t inst_blks(cpu_t *cpu, uint16_t op_code, uint32_t limit) {
+  bool down = (op_code & 0x0008) != 0;
+  uint8_t a_value = cpu->registers.a;
+  uint16_t hl = cpu->registers.hl;
+  uint16_t bc = cpu->registers.bc;
+  uint32_t remaining = bc ? bc : 0x10000;
+  uint32_t count = limit < remaining ? limit : remaining;
+  uint32_t compared = 0;
   uint8_t hl_value = 0;
   uint8_t result = 0;
-  uint16_t bc_value = 0;
-  uint8_t repeat = 0;
-  uint8_t op = (uint8_t)(op_code & 0x00FF);
-
-  if (op == 0xA1) {
-    instruction_log(cpu, "CPI");
-  } else if (op == 0xA9) {
-    instruction_log(cpu, "CPD");
-  } else if (op == 0xB1) {
-    instruction_log(cpu, "CPIR");
-  } else if (op == 0xB9) {
-    instruction_log(cpu, "CPDR");
+
+  if (count == 0)
+    count = 1;
+  compared = block_search(cpu, hl, a_value, count, down);
+  if (compared < count)
+    compared++;
+  hl = (uint16_t)(down ? hl - (compared - 1) : hl + (compared - 1));
+  hl_value = memory_get(cpu, hl);
+  result = (uint8_t)(a_value - hl_value);
+
+  cpu->registers.hl = (uint16_t)(down ? hl - 1 : hl + 1);
+  bc = (uint16_t)(bc - compared);
+  cpu->registers.bc = bc;
+
+  // Flags from the last comparison; C unchanged.
+  flag_set(cpu, FLAG_Z, result == 0);
+  flag_set(cpu, FLAG_S, result & 0x80);
+  flag_set(cpu, FLAG_H, (a_value & 0x0F) < (hl_value & 0x0F));
+  register_flag_set(cpu, FLAG_N);
+  flag_set(cpu, FLAG_PV, bc != 0);
+  return compared;
+}
+
+// INI/IND/OUTI/OUTD and their repeating forms, one iteration per call; the
+// caller winds the PC back while B != 0.
+void inst_blkio(cpu_t *cpu, uint16_t op_code) {
+  uint8_t output = (op_code & 0x0001) != 0;
+  uint16_t hl = cpu->registers.hl;
+  uint8_t b = cpu->registers.b;
+
+  // INI reads from BC before B is decremented; OUTI decrements B first.
+  if (output) {
+    b = (uint8_t)(b - 1);
+    cpu->registers.b = b;
+    cpu->io.write(cpu->io.context, cpu->registers.bc, memory_get(cpu, hl));
   } else {
-    instruction_log(cpu, "CPI/CPD/CPIR/CPDR");
+    memory_set(cpu, hl, cpu->io.read(cpu->io.context, cpu->registers.bc));
+    b = (uint8_t)(b - 1);
+    cpu->registers.b = b;
   }
 
-  while (1) {
-    uint16_t hl = register_value_get(cpu, REG_HL);
-    uint16_t bc = register_value_get(cpu, REG_BC);
-    hl_value = memory_get(cpu, hl);
-    result = (uint8_t)(a_value - hl_value);
+  if (op_code & 0x0008) {
+    hl = (uint16_t)(hl - 1);
+  } else {
+    hl = (uint16_t)(hl + 1);
+  }
+  cpu->registers.hl = hl;
 
-    // Flags from comparison
-    if (result == 0) {
-      register_flag_set(cpu,FLAG_Z);
-    } else {
-      register_flag_unset(cpu,FLAG_Z);
-    }
-    if (result & 0x80) {
-      register_flag_set(cpu,FLAG_S);
-    } else {
-      register_flag_unset(cpu,FLAG_S);
-    }
-    if ((a_value & 0x0F) < (hl_value & 0x0F)) {
-      register_flag_set(cpu,FLAG_H);
-    } else {
-      register_flag_unset(cpu,FLAG_H);
-    }
-    register_flag_set(cpu,FLAG_N);
+  // Flags: Z set when B reaches 0, N set; the rest are left as they were.
+  flag_set(cpu, FLAG_Z, b == 0);
+  register_flag_set(cpu, FLAG_N);
+}
 
-    bc = (uint16_t)(bc - 1);
-    register_value_set(cpu, REG_BC, bc);
-    bc_value = bc;
-    if (bc_value != 0) {
-      register_flag_set(cpu,FLAG_PV);
-    } else {
-      register_flag_unset(cpu,FLAG_PV);
-    }
+void inst_rld(cpu_t *cpu) {
+  uint16_t hl = cpu->registers.hl;
+  uint8_t value = memory_get(cpu, hl);
+  uint8_t a = cpu->registers.a;
+
+  memory_set(cpu, hl, (uint8_t)((value << 4) | (a & 0x0F)));
+  a = (uint8_t)((a & 0xF0) | (value >> 4));
+  cpu->registers.a = a;
+  flag_set(cpu, FLAG_S, a & 0x80);
+  flag_set(cpu, FLAG_Z, a == 0);
+  register_flag_unset(cpu, FLAG_H);
+  flag_set(cpu, FLAG_PV, flags_szp[a] & (1 << FLAG_PV));
+  register_flag_unset(cpu, FLAG_N);
+}
+
+void inst_rrd(cpu_t *cpu) {
+  uint16_t hl = cpu->registers.hl;
+  uint8_t value = memory_get(cpu, hl);
+  uint8_t a = cpu->registers.a;
+
+  memory_set(cpu, hl, (uint8_t)((a << 4) | (value >> 4)));
+  a = (uint8_t)((a & 0xF0) | (value & 0x0F));
+  cpu->registers.a = a;
+  flag_set(cpu, FLAG_S, a & 0x80);
+  flag_set(cpu, FLAG_Z, a == 0);
+  register_flag_unset(cpu, FLAG_H);
+  flag_set(cpu, FLAG_PV, flags_szp[a] & (1 << FLAG_PV));
+  register_flag_unset(cpu, FLAG_N);
+}
+
+static uint8_t pair_sp(const instruction_operands_t *ops) {
+  static const uint8_t pairs[] = {REG_BC, REG_DE, REG_HL, REG_SP};
+  uint8_t rr = pairs[(ops->op_code >> 4) & 0x03];
+  return (rr == REG_HL) ? ops->index_reg : rr;
+}
+
+static uint8_t pair_af(const instruction_operands_t *ops) {
+  static const uint8_t pairs[] = {REG_BC, REG_DE, REG_HL, REG_AF};
+  uint8_t rr = pairs[(ops->op_code >> 4) & 0x03];
+  return (rr == REG_HL) ? ops->index_reg : rr;
+}
+
+// Defined with the generated tables below.
+static const instruction_entry_t instruction_table_main[256];
+static const instruction_entry_t instruction_table_ed[256];
+
+// How many iterations a repeating block instruction may run in one call:
+// enough to reach the scheduler deadline at the repeat cost, but no more
+// than the run's instruction budget has left, and just one when an
+// interrupt is waiting, a breakpoint sits on the instruction or any
+// watchpoint is set, so a watchpoint stops at the iteration that hit it.
+static uint32_t block_repeat_limit(cpu_t *cpu,
+                                   const instruction_operands_t *ops) {
+  uint8_t cost = instruction_table_ed[ops->op_code & 0xFF].tstates_taken;
+  uint16_t pc = (uint16_t)(cpu->registers.pc - ops->length);
+  uint64_t now = cpu->clock.cycles;
+  uint64_t deadline = cpu->scheduler.next_event;
+  uint64_t budget = cpu_budget_left(cpu);
+  uint64_t limit = 0;
+
+  if (deadline <= now || budget <= 1 || cpu->memory.watch_count ||
+      (cpu->breakpoint_count && cpu_breakpoint_get(cpu, pc)))
+    return 1;
+
+  limit = (deadline - now + cost - 1) / cost;
+  if (limit > budget)
+    limit = budget;
+  return limit < 0x10000 ? (uint32_t)limit : 0x10000;
+}
+
+// A copy whose destination reaches the instruction's own bytes stops after
+// writing the first of them, so the next iteration fetches what was written.
+static uint32_t block_copy_limit(cpu_t *cpu, const instruction_operands_t *ops,
+                                 uint32_t limit) {
+  uint16_t pc = (uint16_t)(cpu->registers.pc - ops->length);
+  uint16_t de = cpu->registers.de;
+  bool down = (ops->op_code & 0x0008) != 0;
+
+  for (uint8_t i = 0; i < ops->length; i++) {
+    uint16_t at = (uint16_t)(pc + i);
+    uint32_t distance = (uint16_t)(down ? de - at : at - de);
+
+    if (distance < limit)
+      limit = distance + 1;
+  }
+  return limit;
+}
+
+// The run loops charge a block instruction once: the repeat cost when it
+// wound the PC back to run again, the final cost otherwise. Iterations run
+// before that in the same call each cost the repeat T-states and count as an
+// instruction, the same as running them one at a time. The length and cost
+// are taken before the handler writes memory: a write into the instruction's
+// own cached block frees the operands.
+static void block_iterations(cpu_t *cpu, uint8_t length, uint8_t cost,
+                             uint32_t iterations, bool again) {
+  if (again)
+    cpu->registers.pc = (uint16_t)(cpu->registers.pc - length);
+  if (iterations > 1) {
+    cpu->clock.cycles += (uint64_t)(iterations - 1) * cost;
+    cpu->instructions += iterations - 1;
+  }
+}
+
+static cpu_exit_t io_trap(cpu_t *cpu, uint16_t port, bool write) {
+  cpu->io.trap_port = port;
+  cpu->io.trap_write = write;
+  return CPU_EXIT_IO;
+}
+
+static cpu_exit_t op_nop(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)cpu;
+  (void)ops;
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_r_r(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_load_r_r(cpu, (uint8_t)ops->op_code);
+  return CPU_EXIT_NONE;
+}
 
-    if (op_code & 0x0008) {
-      hl = (uint16_t)(hl - 1);
+static cpu_exit_t op_load_r_n(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_load_r_n(cpu, (uint8_t)ops->op_code, ops->n);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_r_hl(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_load_r_hl(cpu, (uint8_t)ops->op_code);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_hl_r(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_load_hl_r(cpu, (uint8_t)ops->op_code);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_hl_n(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_load_hl_n(cpu, ops->n);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_r_idx(cpu_t *cpu,
+                                const instruction_operands_t *ops) {
+  inst_load_r_idx(cpu, (uint8_t)ops->op_code, ops->index_reg, ops->d);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_idx_r(cpu_t *cpu,
+                                const instruction_operands_t *ops) {
+  inst_load_idx_r(cpu, (uint8_t)ops->op_code, ops->index_reg, ops->d);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_idx_n(cpu_t *cpu,
+                                const instruction_operands_t *ops) {
+  inst_load_idx_n(cpu, ops->index_reg, ops->d, ops->n);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_a_mem(cpu_t *cpu,
+                                const instruction_operands_t *ops) {
+  inst_load_a_mem(cpu, ops->nn);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_mem_a(cpu_t *cpu,
+                                const instruction_operands_t *ops) {
+  inst_load_mem_a(cpu, ops->nn);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_a_rr(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_load_a_rr(cpu, (ops->op_code & 0x10) ? REG_DE : REG_BC);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_rr_a(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_load_rr_a(cpu, (ops->op_code & 0x10) ? REG_DE : REG_BC);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_rr_nn(cpu_t *cpu,
+                                const instruction_operands_t *ops) {
+  inst_load_rr_nn(cpu, pair_sp(ops), ops->nn);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_rr_mem(cpu_t *cpu,
+                                 const instruction_operands_t *ops) {
+  inst_load_rr_mem(cpu, pair_sp(ops), ops->nn);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_mem_rr(cpu_t *cpu,
+                                 const instruction_operands_t *ops) {
+  inst_load_mem_rr(cpu, pair_sp(ops), ops->nn);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_sp_rr(cpu_t *cpu,
+                                const instruction_operands_t *ops) {
+  inst_load_sp_rr(cpu, ops->index_reg);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_a_i(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  inst_load_a_ir(cpu, REG_I);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_a_r_reg(cpu_t *cpu,
+                                  const instruction_operands_t *ops) {
+  (void)ops;
+  inst_load_a_ir(cpu, REG_R);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_i_a(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  _load_r_r(cpu, REG_A, REG_I);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_load_r_reg_a(cpu_t *cpu,
+                                  const instruction_operands_t *ops) {
+  (void)ops;
+  _load_r_r(cpu, REG_A, REG_R);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_push(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_push_rr(cpu, pair_af(ops));
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_pop(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_pop_rr(cpu, pair_af(ops));
+  return CPU_EXIT_NONE;
+}
+
+#define ALU_HANDLERS(name)                                                     \
+  static cpu_exit_t op_##name##_r(cpu_t *cpu,                                 \
+                                  const instruction_operands_t *ops) {        \
+    inst_##name##_r(cpu, (uint8_t)ops->op_code);                              \
+    return CPU_EXIT_NONE;                                                      \
+  }                                                                            \
+  static cpu_exit_t op_##name##_n(cpu_t *cpu,                                 \
+                                  const instruction_operands_t *ops) {        \
+    inst_##name##_n(cpu, ops->n);                                              \
+    return CPU_EXIT_NONE;                                                      \
+  }                                                                            \
+  static cpu_exit_t op_##name##_idx(cpu_t *cpu,                               \
+                                    const instruction_operands_t *ops) {      \
+    inst_##name##_idx(cpu, ops->index_reg, ops->d);                            \
+    return CPU_EXIT_NONE;                                                      \
+  }
+
+ALU_HANDLERS(add_a)
+ALU_HANDLERS(adc_a)
+ALU_HANDLERS(sub)
+ALU_HANDLERS(sbc_a)
+ALU_HANDLERS(and)
+ALU_HANDLERS(xor)
+ALU_HANDLERS(or)
+ALU_HANDLERS(cp)
+
+static cpu_exit_t op_inc_r(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_inc_r(cpu, (uint8_t)ops->op_code);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_inc_hl(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  inst_inc_hl(cpu);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_inc_idx(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_inc_idx(cpu, ops->index_reg, ops->d);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_dec_r(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_dec_r(cpu, (uint8_t)ops->op_code);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_dec_hl(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  inst_dec_hl(cpu);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_dec_idx(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_dec_idx(cpu, ops->index_reg, ops->d);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_add_hl_rr(cpu_t *cpu,
+                               const instruction_operands_t *ops) {
+  inst_add_hl_rr(cpu, ops->op_code);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_add_idx_rr(cpu_t *cpu,
+                                const instruction_operands_t *ops) {
+  inst_add_ix_iy_rr(cpu, ops->op_code, ops->index_reg);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_adc_hl_rr(cpu_t *cpu,
+                               const instruction_operands_t *ops) {
+  inst_adc_hl_rr(cpu, ops->op_code);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_sbc_hl_rr(cpu_t *cpu,
+                               const instruction_operands_t *ops) {
+  inst_sbc_hl_rr(cpu, ops->op_code);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_inc_rr(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_inc_rr(cpu, ops->op_code);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_dec_rr(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_dec_rr(cpu, ops->op_code);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_jr(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_jr(cpu, (uint8_t)ops->op_code, ops->n);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_djnz(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_djnz(cpu, ops->n);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_jp(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_jp(cpu, ops->op_code, ops->nn);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_jp_rr(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_jp(cpu, ops->op_code, 0);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_call(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_call(cpu, ops->op_code, ops->nn);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_ret(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_ret(cpu, ops->op_code);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_retn(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  inst_retn(cpu);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_rst(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_rst(cpu, (uint8_t)ops->op_code);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_daa(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  inst_daa(cpu);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_cpl(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  inst_cpl(cpu);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_neg(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  inst_neg(cpu);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_ccf(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  inst_ccf(cpu);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_rot_a(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_rot_a(cpu, (uint8_t)ops->op_code);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_scf(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  inst_scf(cpu);
+  return CPU_EXIT_NONE;
+}
+
+// Every pass of a waiting HALT before the scheduler deadline is the same,
+// so charge all but the last (which the run loop charges) at once, within
+// what is left of the run's instruction budget. Each pass still counts as
+// an instruction.
+static void halt_skip(cpu_t *cpu) {
+  uint8_t tstates = instruction_table_main[0x76].tstates;
+  uint64_t now = cpu->clock.cycles;
+  uint64_t deadline = cpu->scheduler.next_event;
+  uint64_t budget = cpu_budget_left(cpu);
+  uint64_t passes = 0;
+
+  if (deadline == SCHEDULER_NONE || deadline <= now + tstates || budget <= 1)
+    return;
+
+  passes = (deadline - now - 1) / tstates;
+  if (passes > budget - 1)
+    passes = budget - 1;
+  cpu->clock.cycles += passes * tstates;
+  cpu->instructions += passes;
+  cpu->idle_tstates += passes * tstates;
+}
+
+// With nothing able to raise an interrupt, HALT ends the run as it always
+// has. Otherwise it waits with the PC on itself, costing 4 T-states per
+// pass, until interrupt_accept steps past it; the wait up to the next
+// scheduled event is skipped in one go.
+static cpu_exit_t op_halt(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  inst_halt(cpu);
+  if (!interrupt_can_wake(cpu))
+    return CPU_EXIT_HALT;
+  cpu->registers.pc = (uint16_t)(cpu->registers.pc - 1);
+  halt_skip(cpu);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_di(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  inst_di(cpu);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_ei(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  inst_ei(cpu);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_im(cpu_t *cpu, const instruction_operands_t *ops) {
+  static const uint8_t modes[] = {0, 0, 1, 2};
+  inst_im(cpu, modes[(ops->op_code >> 3) & 0x03]);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_blkt(cpu_t *cpu, const instruction_operands_t *ops) {
+  bool repeat = (ops->op_code & 0x0010) != 0;
+  uint8_t length = ops->length;
+  uint8_t cost = instruction_table_ed[ops->op_code & 0xFF].tstates_taken;
+  uint32_t limit =
+      repeat ? block_copy_limit(cpu, ops, block_repeat_limit(cpu, ops)) : 1;
+  uint32_t iterations = inst_blkt(cpu, ops->op_code, limit);
+
+  block_iterations(cpu, length, cost, iterations,
+                   repeat && cpu->registers.bc != 0);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_blks(cpu_t *cpu, const instruction_operands_t *ops) {
+  bool repeat = (ops->op_code & 0x0010) != 0;
+  uint8_t length = ops->length;
+  uint8_t cost = instruction_table_ed[ops->op_code & 0xFF].tstates_taken;
+  uint32_t limit = repeat ? block_repeat_limit(cpu, ops) : 1;
+  uint32_t iterations = inst_blks(cpu, ops->op_code, limit);
+
+  block_iterations(cpu, length, cost, iterations,
+                   repeat && cpu->registers.bc != 0 &&
+                       !(register_value_get(cpu, REG_F) & (1 << FLAG_Z)));
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_ex_af(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  register_ex_af_af_alt(cpu);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_ex_de_hl(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  register_ex_de_hl(cpu);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_ex_sp_rr(cpu_t *cpu, const instruction_operands_t *ops) {
+  if (ops->index_reg == REG_IX)
+    register_ex_sp_ix(cpu);
+  else if (ops->index_reg == REG_IY)
+    register_ex_sp_iy(cpu);
+  else
+    register_ex_sp_hl(cpu);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_exx(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  register_exx(cpu);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_in_n(cpu_t *cpu, const instruction_operands_t *ops) {
+  uint16_t port =
+      (uint16_t)((cpu->registers.a << 8) | ops->n);
+
+  if (!cpu->io.read)
+    return io_trap(cpu, port, false);
+  inst_in(cpu, ops->op_code, port);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_in_c(cpu_t *cpu, const instruction_operands_t *ops) {
+  uint16_t port = cpu->registers.bc;
+
+  if (!cpu->io.read)
+    return io_trap(cpu, port, false);
+  inst_in(cpu, ops->op_code, port);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_out_n(cpu_t *cpu, const instruction_operands_t *ops) {
+  uint16_t port =
+      (uint16_t)((cpu->registers.a << 8) | ops->n);
+
+  if (!cpu->io.write)
+    return io_trap(cpu, port, true);
+  inst_out(cpu, ops->op_code, port);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_out_c(cpu_t *cpu, const instruction_operands_t *ops) {
+  uint16_t port = cpu->registers.bc;
+
+  if (!cpu->io.write)
+    return io_trap(cpu, port, true);
+  inst_out(cpu, ops->op_code, port);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_blkio(cpu_t *cpu, const instruction_operands_t *ops) {
+  bool output = (ops->op_code & 0x0001) != 0;
+  bool repeat = (ops->op_code & 0x0010) != 0;
+  uint8_t length = ops->length;
+  uint8_t cost = instruction_table_ed[ops->op_code & 0xFF].tstates_taken;
+
+  if (output ? !cpu->io.write : !cpu->io.read)
+    return io_trap(cpu, cpu->registers.bc, output);
+  inst_blkio(cpu, ops->op_code);
+  block_iterations(cpu, length, cost, 1, repeat && cpu->registers.b != 0);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_rld(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  inst_rld(cpu);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_rrd(cpu_t *cpu, const instruction_operands_t *ops) {
+  (void)ops;
+  inst_rrd(cpu);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_cb(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_cb(cpu, (uint8_t)ops->op_code, 0, REG_HL, 0);
+  return CPU_EXIT_NONE;
+}
+
+static cpu_exit_t op_cb_idx(cpu_t *cpu, const instruction_operands_t *ops) {
+  inst_cb(cpu, (uint8_t)ops->op_code, 1, ops->index_reg, ops->d);
+  return CPU_EXIT_NONE;
+}
+
+// The dispatch tables are generated from src/op_codes.txt at build time.
+#include "instruction_tables.h"
+
+// Decode the instruction at address whose first byte, op, the caller has
+// already fetched.
+static inline const instruction_entry_t *
+instruction_decode_op(cpu_t *cpu, uint16_t address, uint8_t op,
+                      instruction_operands_t *ops) {
+  const instruction_entry_t *table = instruction_table_main;
+  const instruction_entry_t *entry = NULL;
+  uint16_t pc = (uint16_t)(address + 1);
+
+  ops->op_code = op;
+  ops->index_reg = REG_HL;
+  ops->d = 0;
+  ops->n = 0;
+  ops->nn = 0;
+
+  if (op == 0xCB) {
+    op = memory_get(cpu, pc++);
+    table = instruction_table_cb;
+    ops->op_code = op;
+  } else if (op == 0xED) {
+    op = memory_get(cpu, pc++);
+    table = instruction_table_ed;
+    ops->op_code = (uint16_t)(0xED00 | op);
+  } else if (op == 0xDD || op == 0xFD) {
+    uint8_t prefix = op;
+
+    ops->index_reg = (prefix == 0xDD) ? REG_IX : REG_IY;
+    op = memory_get(cpu, pc++);
+    if (op == 0xCB) {
+      ops->d = memory_get(cpu, pc++);
+      op = memory_get(cpu, pc++);
+      table = instruction_table_index_cb;
+      ops->op_code = op;
     } else {
-      hl = (uint16_t)(hl + 1);
+      table = instruction_table_index;
+      ops->op_code = (uint16_t)((prefix << 8) | op);
     }
-    register_value_set(cpu, REG_HL, hl);
+  }
 
-    repeat = ((op_code & 0x00FF) == 0x00B1 || (op_code & 0x00FF) == 0x00B9);
-    if (repeat && bc_value > 0 && result != 0) {
-      continue;
-    }
+  entry = &table[op];
+  if (!entry->handler)
+    return NULL;
 
-    break;
+  if (entry->operands & OPERAND_UNINDEXED) {
+    ops->op_code = op;
+    ops->index_reg = REG_HL;
+  }
+
+  if (entry->operands & OPERAND_D)
+    ops->d = memory_get(cpu, pc++);
+  if (entry->operands & OPERAND_N)
+    ops->n = memory_get(cpu, pc++);
+  if (entry->operands & OPERAND_NN) {
+    uint8_t low = memory_get(cpu, pc++);
+    uint8_t high = memory_get(cpu, pc++);
+    ops->nn = (uint16_t)((high << 8) | low);
   }
+
+  ops->length = (uint8_t)(pc - address);
+  return entry;
+}
+
+const instruction_entry_t *instruction_decode(cpu_t *cpu, uint16_t address,
+                                              instruction_operands_t *ops) {
+  return instruction_decode_op(cpu, address, memory_get(cpu, address), ops);
 }
+
+#ifdef RAVELOXZEMU_THREADED
+// Threaded core: every unprefixed opcode has its own label that ends in its
+// own indirect jump to the next opcode, so the host predictor sees 256 branch
+// sites instead of one. The table lookups below use a constant opcode and fold
+// into direct (and usually inlined) handler calls. Prefixed opcodes go through
+// instruction_decode_op with the byte the dispatch already fetched.
+static inline __attribute__((always_inline)) cpu_exit_t
+threaded_execute(cpu_t *cpu, uint16_t pc, uint8_t op) {
+  const instruction_entry_t *entry = &instruction_table_main[op];
+  instruction_operands_t ops;
+  cpu_exit_t reason;
+
+  if (op == 0xCB || op == 0xED || op == 0xDD || op == 0xFD) {
+    entry = instruction_decode_op(cpu, pc, op, &ops);
+    if (!entry)
+      return CPU_EXIT_UNDEFINED;
+  } else {
+    uint16_t next = (uint16_t)(pc + 1);
+
+    if (!entry->handler)
+      return CPU_EXIT_UNDEFINED;
+
+    ops.op_code = op;
+    ops.index_reg = REG_HL;
+    ops.d = 0;
+    ops.n = 0;
+    ops.nn = 0;
+    if (entry->operands & OPERAND_N)
+      ops.n = memory_get(cpu, next++);
+    if (entry->operands & OPERAND_NN) {
+      uint8_t low = memory_get(cpu, next++);
+      uint8_t high = memory_get(cpu, next++);
+      ops.nn = (uint16_t)((high << 8) | low);
+    }
+    ops.length = (uint8_t)(next - pc);
+  }
+
+  cpu_record_instruction(cpu, pc, ops.length);
+  cpu->registers.pc = (uint16_t)(pc + ops.length);
+  reason = entry->handler(cpu, &ops);
+  if (reason == CPU_EXIT_IO) {
+    cpu->registers.pc = pc;
+    return reason;
+  }
+  cpu_charge(cpu, (uint16_t)(pc + ops.length), entry->tstates,
+             entry->tstates_taken);
+
+  cpu->instructions++;
+  return reason;
+}
+
+#define THREADED_DISPATCH()                                                    \
+  do {                                                                         \
+    pc = cpu->registers.pc;                                                    \
+    goto *threaded_labels[(uint8_t)memory_get(cpu, pc)];                       \
+  } while (0)
+
+#define THREADED_OP(op)                                                        \
+  threaded_##op : reason = threaded_execute(cpu, pc, op);                      \
+  if (reason != CPU_EXIT_NONE ||                                               \
+      cpu->instructions >= cpu->instruction_limit)                             \
+    goto threaded_exit;                                                        \
+  THREADED_DISPATCH();
+
+#define THREADED_OP_X16(h)                                                     \
+  THREADED_OP(h##0)                                                            \
+  THREADED_OP(h##1)                                                            \
+  THREADED_OP(h##2)                                                            \
+  THREADED_OP(h##3)                                                            \
+  THREADED_OP(h##4)                                                            \
+  THREADED_OP(h##5)                                                            \
+  THREADED_OP(h##6)                                                            \
+  THREADED_OP(h##7)                                                            \
+  THREADED_OP(h##8)                                                            \
+  THREADED_OP(h##9)                                                            \
+  THREADED_OP(h##A)                                                            \
+  THREADED_OP(h##B)                                                            \
+  THREADED_OP(h##C)                                                            \
+  THREADED_OP(h##D)                                                            \
+  THREADED_OP(h##E)                                                            \
+  THREADED_OP(h##F)
+
+#define THREADED_LABEL_X16(h)                                                  \
+  &&threaded_##h##0, &&threaded_##h##1, &&threaded_##h##2, &&threaded_##h##3,  \
+      &&threaded_##h##4, &&threaded_##h##5, &&threaded_##h##6,                 \
+      &&threaded_##h##7, &&threaded_##h##8, &&threaded_##h##9,                 \
+      &&threaded_##h##A, &&threaded_##h##B, &&threaded_##h##C,                 \
+      &&threaded_##h##D, &&threaded_##h##E, &&threaded_##h##F
+
+cpu_exit_t instruction_run_threaded(cpu_t *cpu, uint64_t max_instructions) {
+  static void *const threaded_labels[256] = {
+      THREADED_LABEL_X16(0x0), THREADED_LABEL_X16(0x1),
+      THREADED_LABEL_X16(0x2), THREADED_LABEL_X16(0x3),
+      THREADED_LABEL_X16(0x4), THREADED_LABEL_X16(0x5),
+      THREADED_LABEL_X16(0x6), THREADED_LABEL_X16(0x7),
+      THREADED_LABEL_X16(0x8), THREADED_LABEL_X16(0x9),
+      THREADED_LABEL_X16(0xA), THREADED_LABEL_X16(0xB),
+      THREADED_LABEL_X16(0xC), THREADED_LABEL_X16(0xD),
+      THREADED_LABEL_X16(0xE), THREADED_LABEL_X16(0xF)};
+  cpu_exit_t reason = CPU_EXIT_NONE;
+  uint16_t pc;
+
+  if (max_instructions == 0)
+    return CPU_EXIT_BUDGET;
+  cpu_budget_set(cpu, max_instructions);
+
+  THREADED_DISPATCH();
+
+  THREADED_OP_X16(0x0)
+  THREADED_OP_X16(0x1)
+  THREADED_OP_X16(0x2)
+  THREADED_OP_X16(0x3)
+  THREADED_OP_X16(0x4)
+  THREADED_OP_X16(0x5)
+  THREADED_OP_X16(0x6)
+  THREADED_OP_X16(0x7)
+  THREADED_OP_X16(0x8)
+  THREADED_OP_X16(0x9)
+  THREADED_OP_X16(0xA)
+  THREADED_OP_X16(0xB)
+  THREADED_OP_X16(0xC)
+  THREADED_OP_X16(0xD)
+  THREADED_OP_X16(0xE)
+  THREADED_OP_X16(0xF)
+
+threaded_exit:
+  if (reason == CPU_EXIT_NONE)
+    return CPU_EXIT_BUDGET;
+  return reason;
+}
+#endif
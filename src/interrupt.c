@@ -0,0 +1,145 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "cpu.h"
+#include "interrupt.h"
+#include "memory.h"
+
+// Pending interrupts ride on the scheduler deadline: anything that may make
+// an interrupt acceptable drops next_event to 0, so the run loops pay no
+// extra compare while nothing is pending.
+void interrupt_poll(cpu_t *cpu) {
+  cpu->scheduler.next_event = 0;
+}
+
+int interrupt_init(cpu_t *cpu) {
+  if (!cpu)
+    return -1;
+
+  memset(&cpu->interrupt, 0, sizeof(cpu->interrupt));
+  return 0;
+}
+
+// Hold INT active with data on the bus for the acknowledge cycle: the
+// opcode for IM 0, the vector low byte for IM 2. INT is level triggered, so
+// it stays active until the device calls interrupt_clear.
+void interrupt_raise(cpu_t *cpu, uint8_t data) {
+  if (!cpu)
+    return;
+
+  cpu->interrupt.line = true;
+  cpu->interrupt.data = data;
+  interrupt_poll(cpu);
+}
+
+void interrupt_clear(cpu_t *cpu) {
+  if (!cpu)
+    return;
+
+  cpu->interrupt.line = false;
+}
+
+void interrupt_nmi(cpu_t *cpu) {
+  if (!cpu)
+    return;
+
+  cpu->interrupt.nmi = true;
+  interrupt_poll(cpu);
+}
+
+// True when an interrupt would be accepted at the next instruction boundary,
+// or will be once an EI delay has passed.
+bool interrupt_pending(cpu_t *cpu) {
+  return cpu->interrupt.nmi || (cpu->interrupt.line && cpu->interrupt.iff1);
+}
+
+// HALT only waits when something could still end it; otherwise the run
+// loop stops as it always has.
+bool interrupt_can_wake(cpu_t *cpu) {
+  return interrupt_pending(cpu) || cpu->scheduler.count > 0;
+}
+
+static void interrupt_call(cpu_t *cpu, uint16_t address, uint8_t tstates) {
+  uint16_t pc = cpu->registers.pc;
+  uint16_t sp = cpu->registers.sp;
+
+  // A HALT waits with the PC on itself; return to the instruction after.
+  if (cpu->halted) {
+    cpu->halted = false;
+    pc = (uint16_t)(pc + 1);
+  }
+
+  sp--;
+  memory_set(cpu, sp, (uint8_t)(pc >> 8));
+  sp--;
+  memory_set(cpu, sp, (uint8_t)(pc & 0x00FF));
+  cpu->registers.sp = sp;
+  cpu->registers.pc = address;
+  cpu->clock.cycles += tstates;
+}
+
+// Accept at most one interrupt at an instruction boundary. Keeps the
+// deadline at 0 while one is still waiting (behind EI, or a second source).
+void interrupt_accept(cpu_t *cpu) {
+  z80_interrupt_t *interrupt = &cpu->interrupt;
+
+  if (interrupt->nmi) {
+    interrupt->nmi = false;
+    interrupt->iff1 = false;
+    interrupt->nmis++;
+    interrupt_call(cpu, 0x0066, INTERRUPT_NMI_TSTATES);
+  } else if (interrupt->line && interrupt->iff1) {
+    if (interrupt->ei_delay) {
+      interrupt->ei_delay = false;
+      interrupt_poll(cpu);
+      return;
+    }
+    interrupt->iff1 = false;
+    interrupt->iff2 = false;
+    interrupt->accepted++;
+    switch (interrupt->mode) {
+    case 0: {
+      // Only RST opcodes are supported on the bus; anything else is taken
+      // as 0xFF (RST 38h), what an undriven bus reads as.
+      uint8_t op = (interrupt->data & 0xC7) == 0xC7 ? interrupt->data : 0xFF;
+
+      interrupt_call(cpu, (uint16_t)(op & 0x38), INTERRUPT_IM0_TSTATES);
+      break;
+    }
+    case 1:
+      interrupt_call(cpu, 0x0038, INTERRUPT_IM1_TSTATES);
+      break;
+    default: {
+      uint16_t table = (uint16_t)((cpu->registers.i << 8) | interrupt->data);
+      uint16_t low = memory_get(cpu, table);
+      uint16_t high = memory_get(cpu, (uint16_t)(table + 1));
+      uint16_t address = (uint16_t)(low | high << 8);
+
+      interrupt_call(cpu, address, INTERRUPT_IM2_TSTATES);
+      break;
+    }
+    }
+  }
+  interrupt->ei_delay = false;
+
+  if (interrupt_pending(cpu))
+    interrupt_poll(cpu);
+}
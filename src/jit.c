@@ -0,0 +1,934 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// MAP_ANONYMOUS is outside strict POSIX.
+#define _DEFAULT_SOURCE
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "block.h"
+#include "cpu.h"
+#include "flags.h"
+#include "jit.h"
+
+#if defined(__x86_64__) && (defined(__linux__) || defined(__APPLE__))
+#define JIT_SUPPORTED 1
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef JIT_SUPPORTED
+
+// x86-64 register numbers. Z80 pairs live in callee-saved registers for the
+// whole block; rax, rcx and rdx are scratch.
+#define HOST_RAX 0
+#define HOST_RCX 1
+#define HOST_RDX 2
+#define HOST_RBX 3
+#define HOST_R12 12
+#define HOST_R13 13
+#define HOST_R14 14
+#define HOST_R15 15 // cpu_t *
+
+// Host register for REG_AF..REG_HL.
+static const uint8_t host_pair[4] = {HOST_RBX, HOST_R12, HOST_R13, HOST_R14};
+
+// Sets of REG_AF..REG_HL, one bit per pair.
+#define PAIR_BIT(pair) (1u << (pair))
+#define PAIRS_ALL 0x0F
+
+typedef struct {
+  uint8_t *code;
+  size_t size;
+  size_t used;
+} jit_emitter_t;
+
+static void emit8(jit_emitter_t *e, uint8_t value) {
+  if (e->used < e->size)
+    e->code[e->used] = value;
+  e->used++;
+}
+
+static void emit16(jit_emitter_t *e, uint16_t value) {
+  emit8(e, (uint8_t)value);
+  emit8(e, (uint8_t)(value >> 8));
+}
+
+static void emit32(jit_emitter_t *e, uint32_t value) {
+  emit16(e, (uint16_t)value);
+  emit16(e, (uint16_t)(value >> 16));
+}
+
+static void emit64(jit_emitter_t *e, uint64_t value) {
+  emit32(e, (uint32_t)value);
+  emit32(e, (uint32_t)(value >> 32));
+}
+
+static void emit_rex(jit_emitter_t *e, uint8_t reg, uint8_t rm) {
+  uint8_t rex = (uint8_t)(0x40 | ((reg >> 3) << 2) | (rm >> 3));
+
+  if (rex != 0x40)
+    emit8(e, rex);
+}
+
+static uint32_t register_offset(uint8_t pair) {
+  return (uint32_t)(offsetof(cpu_t, registers.pairs) +
+                    pair * sizeof(z80_register_t));
+}
+
+// movzx host32, word [r15 + offset]
+static void emit_load_pair(jit_emitter_t *e, uint8_t host, uint32_t offset) {
+  emit_rex(e, host, HOST_R15);
+  emit8(e, 0x0F);
+  emit8(e, 0xB7);
+  emit8(e, (uint8_t)(0x80 | ((host & 7) << 3) | (HOST_R15 & 7)));
+  emit32(e, offset);
+}
+
+// mov word [r15 + offset], host16
+static void emit_store_pair(jit_emitter_t *e, uint8_t host, uint32_t offset) {
+  emit8(e, 0x66);
+  emit_rex(e, host, HOST_R15);
+  emit8(e, 0x89);
+  emit8(e, (uint8_t)(0x80 | ((host & 7) << 3) | (HOST_R15 & 7)));
+  emit32(e, offset);
+}
+
+// mov dword [r15 + offset], host32
+static void emit_store_dword(jit_emitter_t *e, uint8_t host,
+                             uint32_t offset) {
+  emit_rex(e, host, HOST_R15);
+  emit8(e, 0x89);
+  emit8(e, (uint8_t)(0x80 | ((host & 7) << 3) | (HOST_R15 & 7)));
+  emit32(e, offset);
+}
+
+// mov byte [r15 + offset], imm8
+static void emit_store_imm8(jit_emitter_t *e, uint32_t offset,
+                            uint8_t value) {
+  emit8(e, 0x41);
+  emit8(e, 0xC6);
+  emit8(e, 0x87);
+  emit32(e, offset);
+  emit8(e, value);
+}
+
+// mov word [r15 + offset], imm16
+static void emit_store_imm16(jit_emitter_t *e, uint32_t offset,
+                             uint16_t value) {
+  emit8(e, 0x66);
+  emit8(e, 0x41);
+  emit8(e, 0xC7);
+  emit8(e, 0x87);
+  emit32(e, offset);
+  emit16(e, value);
+}
+
+// add qword [r15 + clock.cycles], imm32
+static void emit_add_cycles(jit_emitter_t *e, uint32_t value) {
+  emit8(e, 0x49);
+  emit8(e, 0x81);
+  emit8(e, 0x87);
+  emit32(e, (uint32_t)offsetof(cpu_t, clock.cycles));
+  emit32(e, value);
+}
+
+// add word [r15 + offset], imm8
+static void emit_add_mem16(jit_emitter_t *e, uint32_t offset, int8_t value) {
+  emit8(e, 0x66);
+  emit8(e, 0x41);
+  emit8(e, 0x83);
+  emit8(e, 0x87);
+  emit32(e, offset);
+  emit8(e, (uint8_t)value);
+}
+
+// and/or/add host32, imm32 (ext selects the operation: 4, 1 or 0)
+static void emit_alu_imm(jit_emitter_t *e, uint8_t ext, uint8_t host,
+                         uint32_t value) {
+  emit_rex(e, 0, host);
+  emit8(e, 0x81);
+  emit8(e, (uint8_t)(0xC0 | (ext << 3) | (host & 7)));
+  emit32(e, value);
+}
+
+#define ALU_ADD 0
+#define ALU_OR 1
+#define ALU_AND 4
+
+// op dest32, source32 with a register-to-register ALU opcode (mov 0x89,
+// add 0x01, sub 0x29, and 0x21, or 0x09, xor 0x31)
+static void emit_alu_reg(jit_emitter_t *e, uint8_t opcode, uint8_t dest,
+                         uint8_t source) {
+  emit_rex(e, source, dest);
+  emit8(e, opcode);
+  emit8(e, (uint8_t)(0xC0 | ((source & 7) << 3) | (dest & 7)));
+}
+
+#define ALU_REG_MOV 0x89
+#define ALU_REG_ADD 0x01
+#define ALU_REG_SUB 0x29
+#define ALU_REG_AND 0x21
+#define ALU_REG_OR 0x09
+#define ALU_REG_XOR 0x31
+
+// shl/shr host32, imm8 (ext 4 or 5)
+static void emit_shift(jit_emitter_t *e, uint8_t ext, uint8_t host,
+                       uint8_t count) {
+  emit_rex(e, 0, host);
+  emit8(e, 0xC1);
+  emit8(e, (uint8_t)(0xC0 | (ext << 3) | (host & 7)));
+  emit8(e, count);
+}
+
+#define SHIFT_LEFT 4
+#define SHIFT_RIGHT 5
+
+static void emit_mov_imm(jit_emitter_t *e, uint8_t host, uint32_t value) {
+  emit_rex(e, 0, host);
+  emit8(e, (uint8_t)(0xB8 | (host & 7)));
+  emit32(e, value);
+}
+
+static void emit_load_pairs(jit_emitter_t *e, uint8_t pairs) {
+  for (uint8_t pair = REG_AF; pair <= REG_HL; pair++) {
+    if (pairs & PAIR_BIT(pair))
+      emit_load_pair(e, host_pair[pair], register_offset(pair));
+  }
+}
+
+static void emit_store_pairs(jit_emitter_t *e, uint8_t pairs) {
+  for (uint8_t pair = REG_AF; pair <= REG_HL; pair++) {
+    if (pairs & PAIR_BIT(pair))
+      emit_store_pair(e, host_pair[pair], register_offset(pair));
+  }
+}
+
+// Current cache generation into ecx.
+static void emit_load_generation(jit_emitter_t *e, cpu_t *cpu) {
+  emit8(e, 0x48); // mov rcx, imm64
+  emit8(e, 0xB9);
+  emit64(e, (uint64_t)(uintptr_t)&cpu->blocks->generation);
+  emit8(e, 0x8B); // mov ecx, [rcx]
+  emit8(e, 0x09);
+}
+
+static void emit_prologue(jit_emitter_t *e, cpu_t *cpu) {
+  static const uint8_t code[] = {
+      0x53,                   // push rbx
+      0x55,                   // push rbp
+      0x41, 0x54,             // push r12
+      0x41, 0x55,             // push r13
+      0x41, 0x56,             // push r14
+      0x41, 0x57,             // push r15
+      0x48, 0x83, 0xEC, 0x08, // sub rsp, 8 (realigns for calls)
+      0x49, 0x89, 0xFF,       // mov r15, rdi
+  };
+
+  for (size_t i = 0; i < sizeof(code); i++)
+    emit8(e, code[i]);
+
+  // Keep the entry generation at [rsp] to spot writes to cached code.
+  emit_load_generation(e, cpu);
+  emit8(e, 0x89); // mov [rsp], ecx
+  emit8(e, 0x0C);
+  emit8(e, 0x24);
+  emit_load_pairs(e, PAIRS_ALL);
+}
+
+static void emit_epilogue(jit_emitter_t *e) {
+  static const uint8_t code[] = {
+      0x48, 0x83, 0xC4, 0x08, // add rsp, 8
+      0x41, 0x5F,             // pop r15
+      0x41, 0x5E,             // pop r14
+      0x41, 0x5D,             // pop r13
+      0x41, 0x5C,             // pop r12
+      0x5D,                   // pop rbp
+      0x5B,                   // pop rbx
+      0xC3,                   // ret
+  };
+
+  for (size_t i = 0; i < sizeof(code); i++)
+    emit8(e, code[i]);
+}
+
+// Emit a rel32 jump (opcode bytes given) and return the offset to patch.
+static size_t emit_jump(jit_emitter_t *e, uint8_t op1, uint8_t op2) {
+  emit8(e, op1);
+  if (op2)
+    emit8(e, op2);
+  emit32(e, 0);
+  return e->used;
+}
+
+static void patch_jump(jit_emitter_t *e, size_t after, size_t target) {
+  uint32_t rel = (uint32_t)(target - after);
+
+  if (after > e->size)
+    return;
+  memcpy(e->code + after - 4, &rel, sizeof(rel));
+}
+
+// Z80 8-bit register field to {pair, high byte}.
+static void register_field(uint8_t field, uint8_t *pair, bool *high) {
+  static const uint8_t pairs[8] = {REG_BC, REG_BC, REG_DE, REG_DE,
+                                   REG_HL, REG_HL, 0,      REG_AF};
+
+  *pair = pairs[field];
+  *high = (field & 1) == 0 || field == 7;
+}
+
+static void emit_set_byte(jit_emitter_t *e, uint8_t field, uint8_t value) {
+  uint8_t pair;
+  bool high;
+
+  register_field(field, &pair, &high);
+  emit_alu_imm(e, ALU_AND, host_pair[pair], high ? 0x00FF : 0xFF00);
+  emit_alu_imm(e, ALU_OR, host_pair[pair],
+               high ? (uint32_t)value << 8 : value);
+}
+
+static void emit_copy_byte(jit_emitter_t *e, uint8_t dest, uint8_t source) {
+  uint8_t dest_pair, source_pair;
+  bool dest_high, source_high;
+  uint8_t host;
+
+  register_field(dest, &dest_pair, &dest_high);
+  register_field(source, &source_pair, &source_high);
+
+  host = host_pair[source_pair];
+  emit_rex(e, host, HOST_RAX); // mov eax, source
+  emit8(e, 0x89);
+  emit8(e, (uint8_t)(0xC0 | ((host & 7) << 3)));
+  if (source_high) {
+    emit8(e, 0xC1); // shr eax, 8
+    emit8(e, 0xE8);
+    emit8(e, 0x08);
+  }
+  emit8(e, 0x25); // and eax, 0xFF
+  emit32(e, 0xFF);
+  if (dest_high) {
+    emit8(e, 0xC1); // shl eax, 8
+    emit8(e, 0xE0);
+    emit8(e, 0x08);
+  }
+
+  host = host_pair[dest_pair];
+  emit_alu_imm(e, ALU_AND, host, dest_high ? 0x00FF : 0xFF00);
+  emit_rex(e, HOST_RAX, host); // or dest, eax
+  emit8(e, 0x09);
+  emit8(e, (uint8_t)(0xC0 | (host & 7)));
+}
+
+// Z80 8-bit register field into host, zero-extended.
+static void emit_get_byte(jit_emitter_t *e, uint8_t host, uint8_t field) {
+  uint8_t pair;
+  bool high;
+
+  register_field(field, &pair, &high);
+  emit_alu_reg(e, ALU_REG_MOV, host, host_pair[pair]);
+  if (high)
+    emit_shift(e, SHIFT_RIGHT, host, 8);
+  emit_alu_imm(e, ALU_AND, host, 0xFF);
+}
+
+// ADD/SUB/AND/XOR/OR/CP A with a register (op 0x80-0xBF) or an immediate
+// (op 0xC6-0xFE). A ends up in AF's host register and the flag inputs in
+// cpu->flags, exactly as flags_record leaves them in lazy mode.
+static void emit_alu_a(jit_emitter_t *e, uint8_t op, uint8_t n) {
+  static const uint8_t alu_ops[8] = {ALU_REG_ADD, 0, ALU_REG_SUB, 0,
+                                     ALU_REG_AND, ALU_REG_XOR, ALU_REG_OR,
+                                     ALU_REG_SUB};
+  uint8_t kind = (op >> 3) & 0x07;
+  bool logic = kind >= 4 && kind <= 6;
+
+  if (op < 0xC0)
+    emit_get_byte(e, HOST_RCX, op & 0x07);
+  else
+    emit_mov_imm(e, HOST_RCX, n);
+  emit_get_byte(e, HOST_RAX, 7);
+  emit_alu_reg(e, ALU_REG_MOV, HOST_RDX, HOST_RAX);
+  emit_alu_reg(e, alu_ops[kind], HOST_RDX, HOST_RCX);
+
+  // edx holds the untruncated sum or difference.
+  emit_store_dword(e, HOST_RDX, (uint32_t)offsetof(cpu_t, flags.wide));
+  emit_alu_imm(e, ALU_AND, HOST_RDX, 0xFF);
+  emit_store_pair(e, HOST_RDX, (uint32_t)offsetof(cpu_t, flags.result));
+  if (logic) {
+    emit_store_imm16(e, (uint32_t)offsetof(cpu_t, flags.a), 0);
+    emit_store_imm16(e, (uint32_t)offsetof(cpu_t, flags.value), 0);
+  } else {
+    emit_store_pair(e, HOST_RAX, (uint32_t)offsetof(cpu_t, flags.a));
+    emit_store_pair(e, HOST_RCX, (uint32_t)offsetof(cpu_t, flags.value));
+  }
+  emit_store_imm8(e, (uint32_t)offsetof(cpu_t, flags.kind),
+                  kind == 0 ? FLAGS_ADD : logic ? FLAGS_LOGIC : FLAGS_SUB);
+  emit_store_imm8(e, (uint32_t)offsetof(cpu_t, flags.carry), kind == 4);
+
+  if (kind == 7) // CP leaves A alone
+    return;
+  emit_shift(e, SHIFT_LEFT, HOST_RDX, 8);
+  emit_alu_imm(e, ALU_AND, HOST_RBX, 0x00FF);
+  emit_alu_reg(e, ALU_REG_OR, HOST_RBX, HOST_RDX);
+}
+
+// Bring F up to date if an operation is pending: call flags_materialize and
+// copy the new F into AF's host register, keeping the host's A.
+static void emit_materialize(jit_emitter_t *e) {
+  size_t to_done;
+
+  emit8(e, 0x41); // cmp byte [r15 + flags.kind], FLAGS_NONE
+  emit8(e, 0x80);
+  emit8(e, 0xBF);
+  emit32(e, (uint32_t)offsetof(cpu_t, flags.kind));
+  emit8(e, FLAGS_NONE);
+  to_done = emit_jump(e, 0x0F, 0x84); // je
+
+  emit8(e, 0x4C); // mov rdi, r15
+  emit8(e, 0x89);
+  emit8(e, 0xFF);
+  emit8(e, 0x48); // mov rax, imm64
+  emit8(e, 0xB8);
+  emit64(e, (uint64_t)(uintptr_t)flags_materialize);
+  emit8(e, 0xFF); // call rax
+  emit8(e, 0xD0);
+
+  emit8(e, 0x41); // movzx eax, byte [r15 + registers.f]
+  emit8(e, 0x0F);
+  emit8(e, 0xB6);
+  emit8(e, 0x87);
+  emit32(e, (uint32_t)offsetof(cpu_t, registers.f));
+  emit_alu_imm(e, ALU_AND, HOST_RBX, 0xFF00);
+  emit_alu_reg(e, ALU_REG_OR, HOST_RBX, HOST_RAX);
+  patch_jump(e, to_done, e->used);
+}
+
+// INC r or DEC r. These keep C, so earlier pending flags are made real
+// first, as flags_record does for the partial kinds.
+static void emit_inc_dec(jit_emitter_t *e, uint8_t field, bool dec) {
+  uint8_t pair;
+  bool high;
+  uint8_t host;
+
+  emit_materialize(e);
+  emit_get_byte(e, HOST_RAX, field);
+  emit_alu_reg(e, ALU_REG_MOV, HOST_RDX, HOST_RAX);
+  emit_alu_imm(e, ALU_ADD, HOST_RDX, dec ? 0xFFFFFFFFu : 1);
+  emit_alu_imm(e, ALU_AND, HOST_RDX, 0xFF);
+
+  emit_store_pair(e, HOST_RAX, (uint32_t)offsetof(cpu_t, flags.value));
+  emit_store_pair(e, HOST_RDX, (uint32_t)offsetof(cpu_t, flags.result));
+  emit_store_dword(e, HOST_RDX, (uint32_t)offsetof(cpu_t, flags.wide));
+  emit_store_imm16(e, (uint32_t)offsetof(cpu_t, flags.a), 0);
+  emit_store_imm8(e, (uint32_t)offsetof(cpu_t, flags.carry), 0);
+  emit_store_imm8(e, (uint32_t)offsetof(cpu_t, flags.kind),
+                  dec ? FLAGS_DEC : FLAGS_INC);
+
+  register_field(field, &pair, &high);
+  host = host_pair[pair];
+  if (high)
+    emit_shift(e, SHIFT_LEFT, HOST_RDX, 8);
+  emit_alu_imm(e, ALU_AND, host, high ? 0x00FF : 0xFF00);
+  emit_alu_reg(e, ALU_REG_OR, host, HOST_RDX);
+}
+
+static void emit_pair_step(jit_emitter_t *e, uint8_t rr, int8_t step) {
+  if (rr == 3) {
+    emit_add_mem16(e, register_offset(REG_SP), step);
+    return;
+  }
+
+  emit_rex(e, 0, host_pair[rr + 1]); // add host32, imm8
+  emit8(e, 0x83);
+  emit8(e, (uint8_t)(0xC0 | (host_pair[rr + 1] & 7)));
+  emit8(e, (uint8_t)step);
+  emit_alu_imm(e, ALU_AND, host_pair[rr + 1], 0xFFFF);
+}
+
+// Pair holding a Z80 8-bit register field, as a PAIR_BIT set.
+static uint8_t field_pairs(uint8_t field) {
+  uint8_t pair;
+  bool high;
+
+  register_field(field, &pair, &high);
+  return (uint8_t)PAIR_BIT(pair);
+}
+
+// Emit native code for the simple unprefixed instructions that touch no
+// memory. With lazy flags that includes ADD/SUB/AND/XOR/OR/CP and INC/DEC r,
+// which leave their flags pending just as their handlers do. Adds the pairs
+// it changes to dirty. Returns false when the instruction needs its handler.
+static bool emit_native(jit_emitter_t *e, const instruction_operands_t *ops,
+                        bool lazy_flags, uint16_t *end_pc, uint8_t *dirty) {
+  uint8_t op = (uint8_t)ops->op_code;
+  uint8_t rr = (op >> 4) & 0x03;
+
+  if (op == 0x00)
+    return true;
+
+  if (op >= 0x40 && op <= 0x7F && op != 0x76) {
+    uint8_t dest = (op >> 3) & 0x07;
+    uint8_t source = op & 0x07;
+
+    if (dest == 6 || source == 6)
+      return false;
+    emit_copy_byte(e, dest, source);
+    *dirty |= field_pairs(dest);
+    return true;
+  }
+
+  // ADD/SUB/AND/XOR/OR/CP; ADC and SBC read the carry.
+  if (lazy_flags && ((op >= 0x80 && op <= 0xBF && (op & 0x07) != 6) ||
+                     (op & 0xC7) == 0xC6)) {
+    uint8_t kind = (op >> 3) & 0x07;
+
+    if (kind == 1 || kind == 3)
+      return false;
+    emit_alu_a(e, op, ops->n);
+    if (kind != 7)
+      *dirty |= PAIR_BIT(REG_AF);
+    return true;
+  }
+
+  if (lazy_flags && (op & 0xC6) == 0x04 && ((op >> 3) & 0x07) != 6) {
+    emit_inc_dec(e, (op >> 3) & 0x07, op & 0x01);
+    *dirty |= field_pairs((op >> 3) & 0x07) | PAIR_BIT(REG_AF);
+    return true;
+  }
+
+  if ((op & 0xC7) == 0x06 && ((op >> 3) & 0x07) != 6) {
+    emit_set_byte(e, (op >> 3) & 0x07, ops->n);
+    *dirty |= field_pairs((op >> 3) & 0x07);
+    return true;
+  }
+
+  if ((op & 0xCF) == 0x01) {
+    if (rr == 3) {
+      emit_store_imm16(e, register_offset(REG_SP), ops->nn);
+    } else {
+      emit_mov_imm(e, host_pair[rr + 1], ops->nn);
+      *dirty |= PAIR_BIT(rr + 1);
+    }
+    return true;
+  }
+
+  if ((op & 0xCF) == 0x03 || (op & 0xCF) == 0x0B) {
+    emit_pair_step(e, rr, (op & 0x08) ? -1 : 1);
+    if (rr != 3)
+      *dirty |= PAIR_BIT(rr + 1);
+    return true;
+  }
+
+  if (op == 0xEB) {
+    emit8(e, 0x45); // xchg r13d, r14d
+    emit8(e, 0x87);
+    emit8(e, 0xEE);
+    *dirty |= PAIR_BIT(REG_DE) | PAIR_BIT(REG_HL);
+    return true;
+  }
+
+  if (op == 0xC3) {
+    *end_pc = ops->nn;
+    return true;
+  }
+
+  if (op == 0x18) {
+    *end_pc = (uint16_t)(*end_pc + (int8_t)ops->n);
+    return true;
+  }
+
+  return false;
+}
+
+// Pairs an unprefixed instruction's handler may write. F counts as written
+// whenever the handler sets flags or reads them (which materializes any that
+// are pending), so AF is in the set for both.
+static uint8_t handler_writes(uint8_t op) {
+  if (op >= 0x40 && op <= 0x7F) // LD r,(HL) and LD (HL),r
+    return (op & 0x07) == 6 ? field_pairs((op >> 3) & 0x07) : 0;
+  if (op >= 0x80 && op <= 0xBF)
+    return PAIR_BIT(REG_AF);
+
+  switch (op) {
+  case 0x02: // LD (BC),A
+  case 0x12: // LD (DE),A
+  case 0x22: // LD (nn),HL
+  case 0x32: // LD (nn),A
+  case 0x36: // LD (HL),n
+  case 0x18: // JR
+  case 0xC3: // JP
+  case 0xC9: // RET
+  case 0xCD: // CALL
+  case 0xC5: // PUSH BC
+  case 0xD5: // PUSH DE
+  case 0xE5: // PUSH HL
+  case 0xE9: // JP (HL)
+  case 0xF3: // DI
+  case 0xF9: // LD SP,HL
+  case 0xFB: // EI
+    return 0;
+  case 0x10: // DJNZ
+  case 0xC1: // POP BC
+    return PAIR_BIT(REG_BC);
+  case 0xD1: // POP DE
+    return PAIR_BIT(REG_DE);
+  case 0x2A: // LD HL,(nn)
+  case 0xE1: // POP HL
+  case 0xE3: // EX (SP),HL
+    return PAIR_BIT(REG_HL);
+  case 0xD9: // EXX
+    return PAIR_BIT(REG_BC) | PAIR_BIT(REG_DE) | PAIR_BIT(REG_HL);
+  case 0xEB: // EX DE,HL
+    return PAIR_BIT(REG_DE) | PAIR_BIT(REG_HL);
+  default:
+    break;
+  }
+
+  if ((op & 0xC7) == 0xC7) // RST
+    return 0;
+  if ((op & 0xC6) == 0x04) // INC/DEC r and (HL)
+    return (uint8_t)(field_pairs((op >> 3) & 0x07) | PAIR_BIT(REG_AF));
+  if ((op & 0xCF) == 0x09) // ADD HL,rr
+    return PAIR_BIT(REG_HL) | PAIR_BIT(REG_AF);
+  if ((op & 0xCF) == 0x01) // LD rr,nn
+    return (op >> 4) == 3 ? 0 : (uint8_t)PAIR_BIT((op >> 4) + 1);
+  if ((op & 0xC7) == 0x03) // INC/DEC rr
+    return (op >> 4) == 3 ? 0 : (uint8_t)PAIR_BIT(((op >> 4) & 0x03) + 1);
+  if (op == 0x0A || op == 0x1A || op == 0x3A || // LD A,(rr)/(nn)
+      (op & 0xC7) == 0x07 ||                    // rotates, DAA, CPL, SCF, CCF
+      (op & 0xE7) == 0x20 ||                    // JR cc
+      (op & 0xC7) == 0xC0 ||                    // RET cc
+      (op & 0xC7) == 0xC2 ||                    // JP cc
+      (op & 0xC7) == 0xC4 ||                    // CALL cc
+      (op & 0xC7) == 0xC6 ||                    // ALU A,n
+      op == 0x08 || op == 0xF1 || op == 0xF5)   // EX AF,AF', POP/PUSH AF
+    return PAIR_BIT(REG_AF);
+  return PAIRS_ALL;
+}
+
+// Call the interpreter handler with the changed registers spilled, then leave
+// the block if it returned an exit reason, wrote to cached code or branched.
+// Otherwise reload only the pairs the handler may have written. cycles is the
+// T-states of the block up to and including this instruction, charged on the
+// way out. dirty is the set of pairs whose host copy is newer than cpu_t; it
+// is empty afterwards.
+static void emit_handler_call(jit_emitter_t *e, cpu_t *cpu,
+                              const block_instruction_t *insn, uint16_t next,
+                              uint32_t retired, uint32_t cycles,
+                              uint8_t *dirty) {
+  size_t to_reason, to_same, to_none, to_continue, reason_at;
+
+  emit_store_pairs(e, *dirty);
+  *dirty = 0;
+  emit_store_imm16(e, register_offset(REG_PC), next);
+  emit8(e, 0x4C); // mov rdi, r15
+  emit8(e, 0x89);
+  emit8(e, 0xFF);
+  emit8(e, 0x48); // mov rsi, imm64
+  emit8(e, 0xBE);
+  emit64(e, (uint64_t)(uintptr_t)&insn->ops);
+  emit8(e, 0x48); // mov rax, imm64
+  emit8(e, 0xB8);
+  emit64(e, (uint64_t)(uintptr_t)insn->handler);
+  emit8(e, 0xFF); // call rax
+  emit8(e, 0xD0);
+
+  emit8(e, 0x85); // test eax, eax
+  emit8(e, 0xC0);
+  to_reason = emit_jump(e, 0x0F, 0x85); // jnz
+
+  // A branch is charged its taken time even when it also wrote cached code.
+  emit_load_pair(e, HOST_RCX, register_offset(REG_PC));
+  emit8(e, 0x81); // cmp ecx, imm32
+  emit8(e, 0xF9);
+  emit32(e, next);
+  to_same = emit_jump(e, 0x0F, 0x84); // je
+  if (insn->tstates_taken != insn->tstates)
+    emit_add_cycles(e, (uint32_t)(insn->tstates_taken - insn->tstates));
+  to_none = emit_jump(e, 0xE9, 0); // jmp
+
+  patch_jump(e, to_same, e->used);
+  emit_load_generation(e, cpu);
+  emit8(e, 0x3B); // cmp ecx, [rsp]
+  emit8(e, 0x0C);
+  emit8(e, 0x24);
+  to_continue = emit_jump(e, 0x0F, 0x84); // je
+
+  patch_jump(e, to_none, e->used);
+  emit8(e, 0x31); // xor eax, eax
+  emit8(e, 0xC0);
+  reason_at = e->used;
+  emit_add_cycles(e, cycles);
+  emit8(e, 0x89); // mov eax, eax
+  emit8(e, 0xC0);
+  emit8(e, 0x48); // shl rax, 32
+  emit8(e, 0xC1);
+  emit8(e, 0xE0);
+  emit8(e, 0x20);
+  emit8(e, 0x48); // or rax, imm32
+  emit8(e, 0x0D);
+  emit32(e, retired);
+  emit_epilogue(e);
+  patch_jump(e, to_reason, reason_at);
+
+  patch_jump(e, to_continue, e->used);
+  emit_load_pairs(e, handler_writes((uint8_t)insn->ops.op_code));
+}
+
+// Leave the block at pc: spill the changed pairs, charge its T-states and
+// return the number of instructions it retired.
+static void emit_exit(jit_emitter_t *e, uint8_t dirty, uint16_t pc,
+                      uint32_t cycles, uint32_t retired) {
+  emit_store_pairs(e, dirty);
+  emit_store_imm16(e, register_offset(REG_PC), pc);
+  emit_add_cycles(e, cycles);
+  emit_mov_imm(e, HOST_RAX, retired);
+  emit_epilogue(e);
+}
+
+// JR cc, JP cc and DJNZ, which always end their block. The taken path leaves
+// here with the taken T-states; the untaken one falls through to the block's
+// own exit. Returns false for any other instruction, having emitted nothing.
+static bool emit_branch(jit_emitter_t *e, const block_instruction_t *insn,
+                        uint16_t next, uint32_t retired, uint32_t cycles,
+                        uint8_t *dirty) {
+  static const uint8_t condition_flags[4] = {FLAG_Z, FLAG_C, FLAG_PV, FLAG_S};
+  uint8_t op = (uint8_t)insn->ops.op_code;
+  uint16_t target = (uint16_t)(next + (int8_t)insn->ops.n);
+  size_t to_untaken;
+
+  if (op == 0x10) {
+    emit_alu_imm(e, ALU_ADD, HOST_R12, 0xFFFFFF00u); // B - 1
+    emit_alu_imm(e, ALU_AND, HOST_R12, 0xFFFF);
+    *dirty |= PAIR_BIT(REG_BC);
+    emit_rex(e, 0, HOST_R12); // test r12d, 0xFF00
+    emit8(e, 0xF7);
+    emit8(e, (uint8_t)(0xC0 | (HOST_R12 & 7)));
+    emit32(e, 0xFF00);
+    to_untaken = emit_jump(e, 0x0F, 0x84); // jz
+  } else if ((op & 0xE7) == 0x20 || (op & 0xC7) == 0xC2) {
+    uint8_t condition = (op & 0xE7) == 0x20 ? (op >> 3) & 0x03
+                                            : (op >> 3) & 0x07;
+
+    if ((op & 0xC7) == 0xC2)
+      target = insn->ops.nn;
+    emit_materialize(e);
+    emit8(e, 0xF6); // test bl, imm8
+    emit8(e, 0xC3);
+    emit8(e, (uint8_t)(1u << condition_flags[condition >> 1]));
+    // Odd conditions are taken on a set flag, even ones on a clear flag.
+    to_untaken = emit_jump(e, 0x0F, (condition & 1) ? 0x84 : 0x85);
+  } else {
+    return false;
+  }
+
+  // Like cpu_charge, a branch to the next instruction costs the untaken time.
+  if (target != next)
+    cycles += (uint32_t)(insn->tstates_taken - insn->tstates);
+  emit_exit(e, *dirty, target, cycles, retired);
+  patch_jump(e, to_untaken, e->used);
+  return true;
+}
+
+// Prefixed instructions, port I/O and HALT always stay in the interpreter.
+// HALT's fast-forward reads the cycle and instruction counts, which native
+// code only brings up to date at block exit. The opcodes were fetched when
+// the block was built, so they are peeked here rather than fetched again.
+static bool jit_can_translate(cpu_t *cpu, const block_t *block) {
+  uint16_t address = block->start;
+
+  for (uint8_t i = 0; i < block->count; i++) {
+    uint8_t op = memory_peek(cpu, address);
+
+    if (op == 0xCB || op == 0xDD || op == 0xED || op == 0xFD || op == 0xD3 ||
+        op == 0xDB || op == 0x76)
+      return false;
+    if (cpu->blocks->page_writes[address >> BLOCK_PAGE_SHIFT] >=
+        JIT_VOLATILE_WRITES)
+      return false;
+    address = (uint16_t)(address + block->instructions[i].ops.length);
+  }
+  return true;
+}
+
+int jit_init(cpu_t *cpu) {
+  jit_t *jit = NULL;
+  void *buffer = NULL;
+
+  if (!cpu)
+    return -1;
+  if (cpu->jit)
+    return 0;
+  if (!cpu->blocks) {
+    fprintf(stderr, "JIT needs the block cache\n");
+    return -1;
+  }
+
+  jit = (jit_t *)calloc(1, sizeof(jit_t));
+  if (!jit) {
+    fprintf(stderr, "Cannot allocate JIT\n");
+    return -1;
+  }
+
+  // Never writable and executable at once: pages are written while
+  // read/write and only made read/execute once a block is finished.
+  buffer = mmap(NULL, JIT_BUFFER_SIZE, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (buffer == MAP_FAILED) {
+    fprintf(stderr, "Cannot map JIT code buffer\n");
+    free(jit);
+    return -1;
+  }
+
+  jit->buffer = (uint8_t *)buffer;
+  jit->page_size = (size_t)sysconf(_SC_PAGESIZE);
+  cpu->jit = jit;
+  return 0;
+}
+
+// Set the protection of the whole pages covering buffer[from, to).
+static int jit_protect(jit_t *jit, size_t from, size_t to, int prot) {
+  size_t start = from & ~(jit->page_size - 1);
+  size_t end = (to + jit->page_size - 1) & ~(jit->page_size - 1);
+
+  if (end > JIT_BUFFER_SIZE)
+    end = JIT_BUFFER_SIZE;
+  if (start >= end)
+    return 0;
+  return mprotect(jit->buffer + start, end - start, prot);
+}
+
+// A failed protection change leaves the buffer unusable, so drop every
+// native block and carry on with the block cache alone.
+static int jit_abandon(cpu_t *cpu) {
+  fprintf(stderr,
+          "Cannot change JIT code buffer protection, "
+          "falling back to the block cache\n");
+  jit_destroy(cpu);
+  return -1;
+}
+
+void jit_destroy(cpu_t *cpu) {
+  if (!cpu || !cpu->jit)
+    return;
+
+  // Blocks must not keep pointers into the unmapped buffer.
+  block_cache_flush(cpu);
+  munmap(cpu->jit->buffer, JIT_BUFFER_SIZE);
+  free(cpu->jit);
+  cpu->jit = NULL;
+}
+
+int jit_translate(cpu_t *cpu, block_t *block) {
+  jit_t *jit = NULL;
+  jit_emitter_t e;
+  uint16_t pc = 0;
+  uint16_t end_pc = 0;
+  uint8_t native = 0;
+  uint8_t dirty = 0;
+  uint32_t cycles = 0;
+
+  if (!cpu || !cpu->jit || !block)
+    return -1;
+
+  jit = cpu->jit;
+  if (!jit_can_translate(cpu, block)) {
+    block->native_failed = true;
+    jit->refused++;
+    return -1;
+  }
+
+  // Only the page shared with the previous block can be executable; the
+  // rest of the free space is still read/write.
+  if ((jit->used & (jit->page_size - 1)) &&
+      jit_protect(jit, jit->used, jit->used + 1, PROT_READ | PROT_WRITE) != 0)
+    return jit_abandon(cpu);
+
+  e.code = jit->buffer + jit->used;
+  e.size = JIT_BUFFER_SIZE - jit->used;
+  e.used = 0;
+
+  emit_prologue(&e, cpu);
+  pc = block->start;
+  for (uint8_t i = 0; i < block->count; i++) {
+    const block_instruction_t *insn = &block->instructions[i];
+    uint16_t next = (uint16_t)(pc + insn->ops.length);
+
+    end_pc = next;
+    cycles += insn->tstates;
+    if (emit_branch(&e, insn, next, (uint32_t)i + 1, cycles, &dirty) ||
+        emit_native(&e, &insn->ops, cpu->lazy_flags, &end_pc, &dirty))
+      native++;
+    else
+      emit_handler_call(&e, cpu, insn, next, (uint32_t)i + 1, cycles,
+                        &dirty);
+    pc = next;
+  }
+  emit_exit(&e, dirty, end_pc, cycles, block->count);
+
+  if (e.used > e.size) {
+    // Out of space: drop every block (and with them every native pointer)
+    // and start the buffer again. This block is retranslated when hot.
+    block_cache_flush(cpu);
+    jit->used = 0;
+    if (jit_protect(jit, 0, JIT_BUFFER_SIZE, PROT_READ | PROT_WRITE) != 0)
+      return jit_abandon(cpu);
+    return -1;
+  }
+
+  // A refused block's code is dropped, but the page it shares with the
+  // previous block still has to become executable again.
+  if (jit_protect(jit, jit->used, jit->used + (native ? e.used : 0),
+                  PROT_READ | PROT_EXEC) != 0)
+    return jit_abandon(cpu);
+
+  if (native == 0) {
+    block->native_failed = true;
+    jit->refused++;
+    return -1;
+  }
+
+  block->native = (block_native_t)(void *)e.code;
+  jit->used += e.used;
+  jit->translated++;
+  return 0;
+}
+
+#else
+
+int jit_init(cpu_t *cpu) {
+  (void)cpu;
+  fprintf(stderr, "JIT is only available on x86-64\n");
+  return -1;
+}
+
+void jit_destroy(cpu_t *cpu) { (void)cpu; }
+
+int jit_translate(cpu_t *cpu, block_t *block) {
+  (void)cpu;
+  if (block)
+    block->native_failed = true;
+  return -1;
+}
+
+#endif
@@ -18,34 +18,23 @@
  */
 
 #include <ctype.h>
+#include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "block.h"
 #include "clock.h"
 #include "cpu.h"
 #include "instruction.h"
+#include "jit.h"
 #include "memory.h"
 #include "register.h"
 #include "test_program.h"
 
-#define CLOCK_DELAY 1000
-#define MEMORY_SIZE (uint16_t)(64 * 1024) - 1
-
-uint8_t get_byte_from_pc(cpu_t *cpu) {
-  uint16_t pc = register_value_get(cpu, REG_PC);
-  uint8_t value = memory_get(cpu, pc);
-  register_value_set(cpu, REG_PC, (uint16_t)(pc + 1));
-  return value;
-}
-
-uint16_t get_word_from_pc(cpu_t *cpu) {
-  uint16_t pc = register_value_get(cpu, REG_PC);
-  uint8_t low = memory_get(cpu, pc);
-  uint8_t high = memory_get(cpu, (uint16_t)(pc + 1));
-  register_value_set(cpu, REG_PC, (uint16_t)(pc + 2));
-  return (uint16_t)((high << 8) | low);
-}
+#define MEMORY_SIZE 0x10000
+// Instructions between meter checks when the clock is unpaced
+#define METER_CHUNK 1000000
 
 static void dump_memory_window(cpu_t *cpu, uint16_t address) {
   uint16_t base = (uint16_t)(address & 0xFFF0);
@@ -55,12 +44,12 @@ static void dump_memory_window(cpu_t *cpu, uint16_t address) {
     fprintf(stdout, "  %04X  ", row_addr);
     for (uint16_t col = 0; col < 16; col++) {
       uint16_t addr = (uint16_t)(row_addr + col);
-      fprintf(stdout, "%02X ", (uint8_t)cpu->memory.memory[addr]);
+      fprintf(stdout, "%02X ", memory_peek(cpu, addr));
     }
     fprintf(stdout, " |");
     for (uint16_t col = 0; col < 16; col++) {
       uint16_t addr = (uint16_t)(row_addr + col);
-      uint8_t value = (uint8_t)cpu->memory.memory[addr];
+      uint8_t value = memory_peek(cpu, addr);
       fputc(isprint(value) ? value : '.', stdout);
     }
     fprintf(stdout, "|\n");
@@ -93,6 +82,7 @@ static void strip_enclosing_quotes(char *value) {
 static int load_file_to_memory(cpu_t *cpu, const char *path,
                                uint16_t address) {
   FILE *file = fopen(path, "rb");
+  uint8_t buffer[0x10000];
   size_t bytes_read = 0;
 
   if (!file) {
@@ -100,24 +90,46 @@ static int load_file_to_memory(cpu_t *cpu, const char *path,
     return -1;
   }
 
-  bytes_read = fread(cpu->memory.memory + address, 1,
-                     cpu->memory.size - address, file);
+  bytes_read = fread(buffer, 1, sizeof(buffer) - address, file);
   fclose(file);
 
   if (bytes_read == 0) {
     fprintf(stderr, "No data read from file: %s\n", path);
     return -1;
   }
+  if (memory_load_at(cpu, buffer, bytes_read, address) != 0) {
+    fprintf(stderr, "File does not fit in mapped memory: %s\n", path);
+    return -1;
+  }
 
   fprintf(stdout, "Loaded %zu bytes at %04X\n", bytes_read, address);
   return 0;
 }
 
+// Map a ROM or RAM image file from address 0 without copying it. Anything
+// past 64 KiB stays in the image for the embedder to bank in.
+static int map_image_file(cpu_t *cpu, const char *path, uint8_t type) {
+  int image = memory_image_open(cpu, path, type);
+  uint32_t length = memory_image_size(cpu, image);
+
+  if (image < 0)
+    return -1;
+  if (length > 0x10000)
+    length = 0x10000;
+  if (memory_map_image(cpu, image, 0, length, 0) != 0)
+    return -1;
+
+  fprintf(stdout, "Mapped %s %s at 0000-%04X\n",
+          type == MEMORY_ROM ? "ROM" : "RAM image", path, length - 1);
+  return 0;
+}
+
 static int dump_memory_to_file(cpu_t *cpu, const char *path, uint16_t address,
                                size_t length) {
   FILE *file = fopen(path, "wb");
+  uint8_t buffer[0x10000];
   size_t bytes_written = 0;
-  size_t max_len = cpu->memory.size - address;
+  size_t max_len = sizeof(buffer) - address;
 
   if (!file) {
     fprintf(stderr, "Cannot open file: %s\n", path);
@@ -127,7 +139,9 @@ static int dump_memory_to_file(cpu_t *cpu, const char *path, uint16_t address,
   if (length > max_len)
     length = max_len;
 
-  bytes_written = fwrite(cpu->memory.memory + address, 1, length, file);
+  for (size_t i = 0; i < length; i++)
+    buffer[i] = memory_peek(cpu, (uint16_t)(address + i));
+  bytes_written = fwrite(buffer, 1, length, file);
   fclose(file);
 
   if (bytes_written != length) {
@@ -160,6 +174,52 @@ static int parse_hex(const char *text, uint16_t *value_out) {
   return 0;
 }
 
+// Parse a clock frequency given in MHz, such as 3.5, into T-states per
+// second. 0 turns pacing off.
+static int parse_mhz(const char *text, uint32_t *frequency_out) {
+  char *end = NULL;
+  double mhz = 0;
+
+  if (!text)
+    return -1;
+
+  mhz = strtod(text, &end);
+  if (text == end || *end != '\0' || mhz < 0 || mhz > 4000)
+    return -1;
+
+  *frequency_out = (uint32_t)(mhz * 1e6 + 0.5);
+  return 0;
+}
+
+// Parse a speed multiplier such as 2, 10x or 0.5x.
+static int parse_speed(const char *text, double *speed_out) {
+  char *end = NULL;
+  double speed = 0;
+
+  if (!text)
+    return -1;
+
+  speed = strtod(text, &end);
+  if (text == end)
+    return -1;
+  if (*end == 'x' || *end == 'X')
+    end++;
+  if (*end != '\0' || !(speed > 0) || speed > 1000)
+    return -1;
+
+  *speed_out = speed;
+  return 0;
+}
+
+static void report_clock(cpu_t *cpu) {
+  if (cpu->clock.frequency == 0) {
+    fprintf(stdout, "Clock: unpaced\n");
+    return;
+  }
+  fprintf(stdout, "Clock: %.3f MHz x%g%s\n", cpu->clock.frequency / 1e6,
+          cpu->clock.speed, cpu->clock.turbo ? " (turbo)" : "");
+}
+
 static char *next_token(char **cursor) {
   char *ptr = *cursor;
 
@@ -192,9 +252,15 @@ typedef enum {
   CMD_CONT,
   CMD_MEM,
   CMD_SET,
-  CMD_DELAY,
+  CMD_SPEED,
+  CMD_TURBO,
+  CMD_MHZ,
   CMD_LOAD,
   CMD_DUMP,
+  CMD_BREAK,
+  CMD_CLEAR,
+  CMD_WATCH,
+  CMD_UNWATCH,
   CMD_HELP
 } command_t;
 
@@ -206,10 +272,13 @@ static command_t command_lookup(const char *cmd) {
       {"quit", CMD_QUIT}, {"q", CMD_QUIT},     {"run", CMD_RUN},
       {"r", CMD_RUN},     {"next", CMD_NEXT},  {"n", CMD_NEXT},
       {"cont", CMD_CONT}, {"c", CMD_CONT},     {"mem", CMD_MEM},
-      {"m", CMD_MEM},     {"set", CMD_SET},    {"delay", CMD_DELAY},
-      {"d", CMD_DELAY},   {"load", CMD_LOAD},  {"l", CMD_LOAD},
-      {"dump", CMD_DUMP}, {"x", CMD_DUMP},     {"help", CMD_HELP},
-      {"h", CMD_HELP},    {"usage", CMD_HELP}, {NULL, CMD_UNKNOWN}};
+      {"m", CMD_MEM},     {"set", CMD_SET},    {"speed", CMD_SPEED},
+      {"d", CMD_SPEED},   {"load", CMD_LOAD},  {"l", CMD_LOAD},
+      {"dump", CMD_DUMP}, {"x", CMD_DUMP},     {"break", CMD_BREAK},
+      {"b", CMD_BREAK},   {"clear", CMD_CLEAR}, {"help", CMD_HELP},
+      {"h", CMD_HELP},    {"usage", CMD_HELP}, {"mhz", CMD_MHZ},
+      {"delay", CMD_SPEED}, {"turbo", CMD_TURBO}, {"watch", CMD_WATCH},
+      {"w", CMD_WATCH},   {"unwatch", CMD_UNWATCH}, {NULL, CMD_UNKNOWN}};
 
   for (size_t i = 0; commands[i].name != NULL; i++) {
     if (strcmp(commands[i].name, cmd) == 0)
@@ -219,485 +288,109 @@ static command_t command_lookup(const char *cmd) {
   return CMD_UNKNOWN;
 }
 
-static int execute_instruction(cpu_t *cpu) {
-  uint16_t value = 0;
-  uint16_t op_code = 0;
-  uint8_t idx = 0;
-  uint8_t displacement = 0;
-  uint16_t mem_addr = 0;
-  uint8_t reg;
-
-  if (!clock_available(cpu))
-    return -1;
+static cpu_exit_t execute_instruction(cpu_t *cpu) {
+  cpu_exit_t reason = cpu_step(cpu);
 
-  op_code = get_byte_from_pc(cpu);
+  // A watchpoint stops after its instruction has run, so show it.
+  if (reason != CPU_EXIT_NONE && reason != CPU_EXIT_WATCHPOINT)
+    return reason;
 
-  // Special prefixes
-  if (op_code == 0xCB) {
-    uint8_t cb_op = get_byte_from_pc(cpu);
-    inst_cb(cpu, cb_op, 0, REG_HL, 0);
-    goto instruction_done;
-  }
+  register_display(cpu);
+  if (clock_pace(cpu) == -1)
+    return CPU_EXIT_ERROR;
 
-  if (op_code == 0xDD || op_code == 0xFD) {
-    uint8_t prefix = (uint8_t)op_code;
-    uint8_t next = get_byte_from_pc(cpu);
+  return reason;
+}
 
-    idx = (prefix == 0xDD) ? REG_IX : REG_IY;
-    if (next == 0xCB) {
-      displacement = get_byte_from_pc(cpu);
-      uint8_t cb_op = get_byte_from_pc(cpu);
-      inst_cb(cpu, cb_op, 1, idx, displacement);
-      goto instruction_done;
-    }
+static const char *watch_kind_name(uint8_t kind) {
+  switch (kind) {
+  case MEMORY_WATCH_READ:
+    return "read";
+  case MEMORY_WATCH_WRITE:
+    return "write";
+  default:
+    return "change";
+  }
+}
 
-    op_code = (uint16_t)((prefix << 8) | next);
-  } else if (op_code == 0xED) {
-    uint8_t next = get_byte_from_pc(cpu);
-    op_code = (uint16_t)((op_code << 8) | next);
+// Watch kinds from letters r, w and c; an empty string means write.
+static int parse_watch_kinds(const char *text, uint8_t *kinds) {
+  *kinds = 0;
+  if (!text) {
+    *kinds = MEMORY_WATCH_WRITE;
+    return 0;
+  }
+  for (; *text; text++) {
+    if (*text == 'r')
+      *kinds |= MEMORY_WATCH_READ;
+    else if (*text == 'w')
+      *kinds |= MEMORY_WATCH_WRITE;
+    else if (*text == 'c')
+      *kinds |= MEMORY_WATCH_CHANGE;
+    else
+      return -1;
   }
+  return *kinds ? 0 : -1;
+}
 
-  instruction_group_t group = instruction_group_get(op_code);
+static void report_stop(cpu_t *cpu, cpu_exit_t reason) {
+  uint16_t pc = register_value_get(cpu, REG_PC);
 
-  switch (group) {
-    case I_NOP:
-      break;
-    case I_LOAD_R_R:
-      inst_load_r_r(cpu, (uint8_t)op_code);
-      break;
-    case I_LOAD_R_N:
-      value = get_byte_from_pc(cpu);
-      inst_load_r_n(cpu, (uint8_t)op_code, (uint8_t)value);
-      break;
-    case I_LOAD_R_HL:
-      inst_load_r_hl(cpu, (uint8_t)op_code);
-      break;
-    case I_LOAD_R_IDX:
-      displacement = get_byte_from_pc(cpu);
-      inst_load_r_idx(cpu, op_code, idx, displacement);
-      break;
-    case I_LOAD_HL_R:
-      inst_load_hl_r(cpu, (uint8_t)op_code);
-      break;
-    case I_LOAD_HL_N:
-      value = get_byte_from_pc(cpu);
-      inst_load_hl_n(cpu, (uint8_t)value);
-      break;
-    case I_LOAD_IDX_R:
-      displacement = get_byte_from_pc(cpu);
-      inst_load_idx_r(cpu, op_code, idx, displacement);
-      break;
-    case I_LOAD_A_MEM:
-      mem_addr = get_word_from_pc(cpu);
-      inst_load_a_mem(cpu, mem_addr);
-      break;
-    case I_LOAD_A_RR:
-      if (op_code == 0x02) {
-        reg = REG_BC;
-      } else if (op_code == 0x12) {
-        reg = REG_DE;
-      } else {
-        fprintf(stderr, "op_code: %02x\t Incorrect group\n", op_code);
-        break;
-      }
-      inst_load_a_rr(cpu, reg);
-      break;
-    case I_LOAD_MEM_A:
-      mem_addr = get_word_from_pc(cpu);
-      inst_load_mem_a(cpu, mem_addr);
-      break;
-    case I_LOAD_RR_A:
-      if (op_code == 0x0A) {
-        reg = REG_BC;
-      } else if (op_code == 0x1A) {
-        reg = REG_DE;
-      } else {
-        fprintf(stderr, "op_code: %02x\t Incorrect group\n", op_code);
-        break;
-      }
-      inst_load_rr_a(cpu, reg);
-      break;
-    case I_LOAD_RR_NN:
-      mem_addr = get_word_from_pc(cpu);
-      if (op_code == 0x01) {
-        reg = REG_BC;
-      } else if (op_code == 0x11) {
-        reg = REG_DE;
-      } else if (op_code == 0x21) {
-        reg = REG_HL;
-      } else if (op_code == 0x31) {
-        reg = REG_SP;
-      } else if (op_code == 0xDD21) {
-        reg = REG_IX;
-      } else if (op_code == 0xFD21) {
-        reg = REG_IY;
-      } else {
-        fprintf(stderr, "op_code: %04x\t Incorrect group\n", op_code);
-        break;
-      }
-      inst_load_rr_nn(cpu, reg, mem_addr);
-      break;
-    case I_LOAD_RR_MEM:
-      mem_addr = get_word_from_pc(cpu);
-      if (op_code == 0x2A) {
-        reg = REG_HL;
-      } else if (op_code == 0xDD2A) {
-        reg = REG_IX;
-      } else if (op_code == 0xFD2A) {
-        reg = REG_IY;
-      } else {
-        fprintf(stderr, "op_code: %04x\t Incorrect group\n", op_code);
-        break;
-      }
-      inst_load_rr_mem(cpu, reg, mem_addr);
-      break;
-    case I_LOAD_MEM_RR:
-      mem_addr = get_word_from_pc(cpu);
-      if (op_code == 0x22) {
-        reg = REG_HL;
-      } else if (op_code == 0xDD22) {
-        reg = REG_IX;
-      } else if (op_code == 0xFD22) {
-        reg = REG_IY;
-      } else {
-        fprintf(stderr, "op_code: %04x\t Incorrect group\n", op_code);
-        break;
-      }
-      inst_load_mem_rr(cpu, reg, mem_addr);
-      break;
-    case I_LOAD_SP_RR:
-      if (op_code == 0xF9) {
-        reg = REG_HL;
-      } else if (op_code == 0xDDF9) {
-        reg = REG_IX;
-      } else if (op_code == 0xFDF9) {
-        reg = REG_IY;
-      } else {
-        fprintf(stderr, "op_code: %04x\t Incorrect group\n", op_code);
-        break;
-      }
-      inst_load_sp_rr(cpu, reg);
-      break;
-    case I_LOAD_SP_MEM:
-      mem_addr = get_word_from_pc(cpu);
-      inst_load_sp_mem(cpu, mem_addr);
-      break;
-    case I_LOAD_MEM_SP:
-      mem_addr = get_word_from_pc(cpu);
-      inst_load_mem_sp(cpu, mem_addr);
-      break;
-    case I_ADD_A_R:
-      inst_add_a_r(cpu, (uint8_t)op_code);
-      break;
-    case I_ADD_A_N:
-      value = get_byte_from_pc(cpu);
-      inst_add_a_n(cpu, (uint8_t)value);
-      break;
-    case I_ADD_A_IDX:
-      displacement = get_byte_from_pc(cpu);
-      inst_add_a_idx(cpu, idx, displacement);
-      break;
-    case I_ADC_A_R:
-      inst_adc_a_r(cpu, (uint8_t)op_code);
-      break;
-    case I_ADC_A_N:
-      value = get_byte_from_pc(cpu);
-      inst_adc_a_n(cpu, (uint8_t)value);
-      break;
-    case I_ADC_A_IDX:
-      displacement = get_byte_from_pc(cpu);
-      inst_adc_a_idx(cpu, idx, displacement);
-      break;
-    case I_SUB_R:
-      inst_sub_r(cpu, (uint8_t)op_code);
-      break;
-    case I_SUB_N:
-      value = get_byte_from_pc(cpu);
-      inst_sub_n(cpu, (uint8_t)value);
-      break;
-    case I_SUB_IDX:
-      displacement = get_byte_from_pc(cpu);
-      inst_sub_idx(cpu, idx, displacement);
-      break;
-    case I_SBC_A_R:
-      inst_sbc_a_r(cpu, (uint8_t)op_code);
-      break;
-    case I_SBC_A_N:
-      value = get_byte_from_pc(cpu);
-      inst_sbc_a_n(cpu, (uint8_t)value);
-      break;
-    case I_SBC_A_IDX:
-      displacement = get_byte_from_pc(cpu);
-      inst_sbc_a_idx(cpu, idx, displacement);
-      break;
-    case I_INC_R:
-      inst_inc_r(cpu, (uint8_t)op_code);
-      break;
-    case I_INC_HL:
-      inst_inc_hl(cpu);
-      break;
-    case I_INC_IDX:
-      displacement = get_byte_from_pc(cpu);
-      inst_inc_idx(cpu, idx, displacement);
-      break;
-    case I_DEC_R:
-      inst_dec_r(cpu, (uint8_t)op_code);
-      break;
-    case I_DEC_HL:
-      inst_dec_hl(cpu);
-      break;
-    case I_DEC_IDX:
-      displacement = get_byte_from_pc(cpu);
-      inst_dec_idx(cpu, idx, displacement);
-      break;
-    case I_ADD_HL_RR:
-      inst_add_hl_rr(cpu, op_code);
-      break;
-    case I_ADD_IX_IY_RR:
-      inst_add_ix_iy_rr(cpu, op_code, idx);
-      break;
-    case I_ADC_HL_RR:
-      inst_adc_hl_rr(cpu, op_code);
-      break;
-    case I_SBC_HL_RR:
-      inst_sbc_hl_rr(cpu, op_code);
-      break;
-    case I_INC_RR:
-      inst_inc_rr(cpu, op_code);
-      break;
-    case I_DEC_RR:
-      inst_dec_rr(cpu, op_code);
-      break;
-    case I_AND_R:
-      inst_and_r(cpu, (uint8_t)op_code);
-      break;
-    case I_AND_N:
-      value = get_byte_from_pc(cpu);
-      inst_and_n(cpu, (uint8_t)value);
-      break;
-    case I_AND_IDX:
-      displacement = get_byte_from_pc(cpu);
-      inst_and_idx(cpu, idx, displacement);
-      break;
-    case I_OR_R:
-      inst_or_r(cpu, (uint8_t)op_code);
-      break;
-    case I_OR_N:
-      value = get_byte_from_pc(cpu);
-      inst_or_n(cpu, (uint8_t)value);
-      break;
-    case I_OR_IDX:
-      displacement = get_byte_from_pc(cpu);
-      inst_or_idx(cpu, idx, displacement);
-      break;
-    case I_XOR_R:
-      inst_xor_r(cpu, (uint8_t)op_code);
-      break;
-    case I_XOR_N:
-      value = get_byte_from_pc(cpu);
-      inst_xor_n(cpu, (uint8_t)value);
-      break;
-    case I_XOR_IDX:
-      displacement = get_byte_from_pc(cpu);
-      inst_xor_idx(cpu, idx, displacement);
-      break;
-    case I_CP_R:
-      inst_cp_r(cpu, (uint8_t)op_code);
-      break;
-    case I_CP_N:
-      value = get_byte_from_pc(cpu);
-      inst_cp_n(cpu, (uint8_t)value);
-      break;
-    case I_CP_IDX:
-      displacement = get_byte_from_pc(cpu);
-      inst_cp_idx(cpu, idx, displacement);
-      break;
-    case I_JR:
-      displacement = get_byte_from_pc(cpu);
-      inst_jr(cpu, (uint8_t)op_code, displacement);
-      break;
-    case I_JP:
-      if (op_code == 0xE9 || op_code == 0xDDE9 || op_code == 0xFDE9) {
-        inst_jp(cpu, op_code, 0);
-      } else {
-        mem_addr = get_word_from_pc(cpu);
-        inst_jp(cpu, op_code, mem_addr);
-      }
-      break;
-    case I_CALL:
-      mem_addr = get_word_from_pc(cpu);
-      inst_call(cpu, op_code, mem_addr);
-      break;
-    case I_RET:
-      inst_ret(cpu, op_code);
-      break;
-    case I_RST:
-      inst_rst(cpu, (uint8_t)op_code);
-      break;
-    case I_DAA:
-      inst_daa(cpu);
-      break;
-    case I_CPL:
-      inst_cpl(cpu);
-      break;
-    case I_NEG:
-      inst_neg(cpu);
-      break;
-    case I_CCF:
-      inst_ccf(cpu);
-      break;
-    case I_SCF:
-      inst_scf(cpu);
-      break;
-    case I_HALT:
-      inst_halt(cpu);
-      break;
-    case I_DI:
-      inst_di(cpu);
-      break;
-    case I_EI:
-      inst_ei(cpu);
-      break;
-    case I_IM:
-      if (op_code == 0xED46 || op_code == 0xED4E || op_code == 0xED66 ||
-          op_code == 0xED6E) {
-        inst_im(cpu, 0);
-      } else if (op_code == 0xED56 || op_code == 0xED76) {
-        inst_im(cpu, 1);
-      } else if (op_code == 0xED5E || op_code == 0xED7E) {
-        inst_im(cpu, 2);
-      } else {
-        fprintf(stderr, "op_code: %04x\t Incorrect group\n", op_code);
-      }
-      break;
-    case I_PUSH:
-      if (op_code == 0xC5) {
-        reg = REG_BC;
-      } else if (op_code == 0xD5) {
-        reg = REG_DE;
-      } else if (op_code == 0xE5) {
-        reg = REG_HL;
-      } else if (op_code == 0xF5) {
-        reg = REG_AF;
-      } else if (op_code == 0xDDE5) {
-        reg = REG_IX;
-      } else if (op_code == 0xFDE5) {
-        reg = REG_IY;
-      } else {
-        fprintf(stderr, "op_code: %04x\t Incorrect group\n", op_code);
-        break;
-      }
-      inst_push_rr(cpu, reg);
-      break;
-    case I_POP:
-      if (op_code == 0xC1) {
-        reg = REG_BC;
-      } else if (op_code == 0xD1) {
-        reg = REG_DE;
-      } else if (op_code == 0xE1) {
-        reg = REG_HL;
-      } else if (op_code == 0xF1) {
-        reg = REG_AF;
-      } else if (op_code == 0xDDE1) {
-        reg = REG_IX;
-      } else if (op_code == 0xFDE1) {
-        reg = REG_IY;
-      } else {
-        fprintf(stderr, "op_code: %04x\t Incorrect group\n", op_code);
-        break;
-      }
-      inst_pop_rr(cpu, reg);
-      break;
-    case I_LOAD_A_I:
-      _load_r_r(cpu, REG_I, REG_A);
-      break;
-    case I_LOAD_A_R_REG:
-      _load_r_r(cpu, REG_R, REG_A);
-      break;
-    case I_LOAD_I_A:
-      _load_r_r(cpu, REG_A, REG_I);
-      break;
-    case I_LOAD_R_REG_A:
-      _load_r_r(cpu, REG_R, REG_A);
-      break;
-    case I_LOAD_IDX_N:
-      displacement = get_byte_from_pc(cpu);
-      value = get_byte_from_pc(cpu);
-      inst_load_idx_n(cpu, idx, displacement, value);
-      break;
-    case I_BLKT:
-      inst_blkt(cpu, op_code);
-      break;
-    case I_BLKS:
-      inst_blks(cpu, op_code);
-      break;
-    case I_EX:
-      switch (op_code) {
-      case 0x08:
-        register_ex_af_af_alt(cpu);
-        break;
-      case 0xE3:
-        register_ex_sp_hl(cpu);
-        break;
-      case 0xEB:
-        register_ex_de_hl(cpu);
-        break;
-      case 0xDDE3:
-        register_ex_sp_ix(cpu);
-        break;
-      case 0xFDE3:
-        register_ex_sp_iy(cpu);
-        break;
-      default:
-        fprintf(stderr, "op_code: %04x\t Incorrect EX group\n", op_code);
-        break;
-      }
-      break;
-    default:
-      fprintf(stderr, "Undefined opcode: %04x\t%u\n", op_code, group);
-      break;
-    }
+  if (reason == CPU_EXIT_NONE || reason == CPU_EXIT_HALT)
+    return;
 
-instruction_done:
-  if (cpu->halted)
-    return 1;
+  if (reason == CPU_EXIT_IO) {
+    fprintf(stdout, "Stopped: I/O trap (%s port %04X) at %04X\n",
+            cpu->io.trap_write ? "OUT" : "IN", cpu->io.trap_port, pc);
+    return;
+  }
 
-  register_display(cpu);
-  if (clock_delay(cpu) == -1)
-    return -1;
+  if (reason == CPU_EXIT_WATCHPOINT) {
+    const memory_watch_hit_t *hit = &cpu->memory.watch_hit;
 
-  return 0;
+    fprintf(stdout, "Stopped: watchpoint (%s %04X: %02X -> %02X) at %04X\n",
+            watch_kind_name(hit->kind), hit->address, hit->old_value,
+            hit->new_value, pc);
+    return;
+  }
+
+  fprintf(stdout, "Stopped: %s at %04X\n", cpu_exit_name(reason), pc);
 }
 
-static int run_from_address(cpu_t *cpu, uint16_t address) {
-  cpu->halted = false;
-  register_value_set(cpu, REG_PC, address);
-  register_value_set(cpu, REG_SP, memory_get_size(cpu));
+static cpu_exit_t run_until_halt(cpu_t *cpu) {
+  cpu_exit_t reason = CPU_EXIT_NONE;
 
+  cpu->halted = false;
+  clock_pace_reset(cpu);
   while (1) {
-    int status = execute_instruction(cpu);
-    if (status != 0)
-      return status;
+    reason = execute_instruction(cpu);
+    if (reason != CPU_EXIT_NONE)
+      break;
+    if (cpu_breakpoint_get(cpu, register_value_get(cpu, REG_PC))) {
+      reason = CPU_EXIT_BREAKPOINT;
+      break;
+    }
   }
 
-  return 0;
+  report_stop(cpu, reason);
+  return reason;
 }
 
-static int run_until_halt(cpu_t *cpu) {
-  cpu->halted = false;
-  while (1) {
-    int status = execute_instruction(cpu);
-    if (status != 0)
-      return status;
-  }
+static cpu_exit_t run_from_address(cpu_t *cpu, uint16_t address) {
+  register_value_set(cpu, REG_PC, address);
+  // SP comes out of reset as FFFF.
+  register_value_set(cpu, REG_SP, 0xFFFF);
 
-  return 0;
+  return run_until_halt(cpu);
 }
 
 static void debugger_prompt(cpu_t *cpu) {
   char line[128];
   int has_run = 0;
 
+  // The register display shows the last addresses read and written.
+  memory_observe(cpu, true);
+
   while (1) {
     fprintf(stdout, "\n(debug) ");
     if (!fgets(line, sizeof(line), stdin))
@@ -707,9 +400,9 @@ static void debugger_prompt(cpu_t *cpu) {
     char *cmd = next_token(&cursor);
 
     if (!cmd) {
-      if (cpu->clock.delay == 0 && has_run) {
+      if (has_run) {
         cpu->halted = false;
-        execute_instruction(cpu);
+        report_stop(cpu, execute_instruction(cpu));
       }
       continue;
     }
@@ -733,15 +426,15 @@ static void debugger_prompt(cpu_t *cpu) {
       continue;
     }
 
-    if (command == CMD_NEXT && cpu->clock.delay == 0) {
+    if (command == CMD_NEXT) {
       if (has_run) {
         cpu->halted = false;
-        execute_instruction(cpu);
+        report_stop(cpu, execute_instruction(cpu));
       }
       continue;
     }
 
-    if (command == CMD_CONT && cpu->clock.delay == 0) {
+    if (command == CMD_CONT) {
       if (has_run) {
         run_until_halt(cpu);
       }
@@ -790,9 +483,13 @@ static void debugger_prompt(cpu_t *cpu) {
           break;
         }
 
-        memory_set(cpu, address, (uint8_t)byte_value);
+        // Backing bytes only: no devices, watchpoints or ROM sink.
+        if (memory_poke(cpu, address, (uint8_t)byte_value) == 0)
+          count++;
+        else
+          fprintf(stdout, "Cannot write %04X: unmapped or read-only\n",
+                  address);
         address = (uint16_t)(address + 1);
-        count++;
         byte_str = next_token(&cursor);
       }
 
@@ -802,20 +499,56 @@ static void debugger_prompt(cpu_t *cpu) {
       continue;
     }
 
-    if (command == CMD_DELAY) {
+    if (command == CMD_SPEED) {
       char *value_token = next_token(&cursor);
+      double speed = 0;
+
       if (!value_token) {
-        fprintf(stdout, "Clock delay: %u\n", cpu->clock.delay);
+        report_clock(cpu);
         continue;
       }
-      char *end = NULL;
-      unsigned long value = strtoul(value_token, &end, 10);
-      if (value_token == end) {
-        fprintf(stdout, "Usage: delay <value>\n");
+      if (parse_speed(value_token, &speed) != 0) {
+        fprintf(stdout, "Usage: speed <multiplier> (e.g. 2x, 0.5x)\n");
+        continue;
+      }
+      clock_set_speed(cpu, speed);
+      report_clock(cpu);
+      if (cpu->clock.frequency == 0)
+        fprintf(stdout, "Set a clock with mhz for the speed to apply\n");
+      continue;
+    }
+
+    if (command == CMD_TURBO) {
+      char *value_token = next_token(&cursor);
+
+      if (!value_token) {
+        clock_set_turbo(cpu, !cpu->clock.turbo);
+      } else if (strcmp(value_token, "on") == 0) {
+        clock_set_turbo(cpu, true);
+      } else if (strcmp(value_token, "off") == 0) {
+        clock_set_turbo(cpu, false);
+      } else {
+        fprintf(stdout, "Usage: turbo [on|off]\n");
+        continue;
+      }
+      fprintf(stdout, "Turbo %s\n", cpu->clock.turbo ? "on" : "off");
+      continue;
+    }
+
+    if (command == CMD_MHZ) {
+      char *value_token = next_token(&cursor);
+      uint32_t frequency = 0;
+
+      if (!value_token) {
+        report_clock(cpu);
+        continue;
+      }
+      if (parse_mhz(value_token, &frequency) != 0) {
+        fprintf(stdout, "Usage: mhz <MHz> (0 runs unpaced)\n");
         continue;
       }
-      cpu->clock.delay = (uint32_t)value;
-      fprintf(stdout, "Clock delay set to %u\n", cpu->clock.delay);
+      clock_set_frequency(cpu, frequency);
+      fprintf(stdout, "Clock set to %.3f MHz\n", frequency / 1e6);
       continue;
     }
 
@@ -869,57 +602,320 @@ static void debugger_prompt(cpu_t *cpu) {
       continue;
     }
 
+    if (command == CMD_BREAK || command == CMD_CLEAR) {
+      uint16_t address = 0;
+      char *addr_token = next_token(&cursor);
+      if (!addr_token || parse_hex(addr_token, &address) != 0) {
+        fprintf(stdout, "Usage: %s <hex_address>\n",
+                command == CMD_BREAK ? "break" : "clear");
+        continue;
+      }
+      if (command == CMD_BREAK) {
+        cpu_breakpoint_set(cpu, address);
+        fprintf(stdout, "Breakpoint set at %04X\n", address);
+      } else {
+        cpu_breakpoint_clear(cpu, address);
+        fprintf(stdout, "Breakpoint cleared at %04X\n", address);
+      }
+      continue;
+    }
+
+    if (command == CMD_WATCH || command == CMD_UNWATCH) {
+      uint16_t address = 0;
+      uint8_t kinds = 0;
+      char *addr_token = next_token(&cursor);
+      char *kind_token = command == CMD_WATCH ? next_token(&cursor) : NULL;
+
+      if (!addr_token || parse_hex(addr_token, &address) != 0 ||
+          parse_watch_kinds(kind_token, &kinds) != 0) {
+        fprintf(stdout, command == CMD_WATCH
+                            ? "Usage: watch <hex_address> [r|w|c...]\n"
+                            : "Usage: unwatch <hex_address>\n");
+        continue;
+      }
+      if (command == CMD_WATCH) {
+        memory_watch_set(cpu, address, 1, kinds);
+        fprintf(stdout, "Watchpoint set at %04X (%s%s%s)\n", address,
+                kinds & MEMORY_WATCH_READ ? "r" : "",
+                kinds & MEMORY_WATCH_WRITE ? "w" : "",
+                kinds & MEMORY_WATCH_CHANGE ? "c" : "");
+      } else {
+        memory_watch_clear(cpu, address, 1, 0xFF);
+        fprintf(stdout, "Watchpoint cleared at %04X\n", address);
+      }
+      continue;
+    }
+
     if (command == CMD_HELP) {
       fprintf(stdout,
               "Commands:\n"
               "  run [hex]    start execution (defaults to PC)\n"
               "  mem [hex]    show 32-byte memory window (defaults to PC)\n"
               "  set <hex> <byte...>  write one or more bytes\n"
-              "  delay [n]    show/set clock delay\n"
+              "  mhz [f]      show/set the paced clock in MHz (0 = unpaced)\n"
+              "  speed [x]    show/set the speed multiplier (e.g. 2x, 0.5x)\n"
+              "  turbo [on|off]  toggle/set unthrottled running\n"
               "  load <path> <hex>   load file at address\n"
               "  dump <path> <hex> <len>  dump memory to file\n"
-              "  next         step one instruction (delay=0)\n"
-              "  cont         run until HALT (delay=0)\n"
+              "  break <hex>  set a breakpoint\n"
+              "  clear <hex>  clear a breakpoint\n"
+              "  watch <hex> [r|w|c]  stop on read/write/change (default w)\n"
+              "  unwatch <hex>  clear a watchpoint\n"
+              "  next         step one instruction\n"
+              "  cont         run until HALT\n"
               "  quit         exit emulator\n");
       continue;
     }
 
     fprintf(stdout,
-            "Commands: run [hex], mem [hex], set <hex> <byte...>, delay "
-            "[value], load <path> <hex>, dump <path> <hex> <len>, next, cont, "
-            "help, quit\n");
+            "Commands: run [hex], mem [hex], set <hex> <byte...>, mhz [MHz], "
+            "speed [x], turbo [on|off], load <path> <hex>, "
+            "dump <path> <hex> <len>, break <hex>, clear <hex>, "
+            "watch <hex> [rwc], unwatch <hex>, next, cont, help, quit\n");
+  }
+}
+
+static void report_meter(cpu_t *cpu) {
+  clock_speed_t speed = clock_meter(cpu);
+
+  fprintf(stdout, "Meter: %.3f MHz, %.0f instructions/s\n", speed.mhz,
+          speed.instructions_per_second);
+}
+
+// Paced runs go a slice of T-states at a time and sleep between slices.
+// Metered runs go in chunks of instructions and report once per host
+// second. Anything else makes a single cpu_run call.
+static cpu_exit_t headless_execute(cpu_t *cpu, uint64_t max_instructions,
+                                   int meter) {
+  uint64_t slice = clock_slice_tstates(cpu);
+  cpu_exit_t reason = CPU_EXIT_BUDGET;
+
+  if (slice == 0 && !meter)
+    return cpu_run(cpu, max_instructions);
+
+  clock_pace_reset(cpu);
+  clock_meter_reset(cpu);
+  while (max_instructions > 0) {
+    uint64_t before = cpu->instructions;
+
+    if (slice)
+      reason = cpu_run_tstates(cpu, max_instructions, slice);
+    else
+      reason = cpu_run(cpu, max_instructions < METER_CHUNK ? max_instructions
+                                                           : METER_CHUNK);
+    if (reason != CPU_EXIT_BUDGET)
+      break;
+    if (max_instructions != CPU_RUN_FOREVER)
+      max_instructions -= cpu->instructions - before;
+    clock_pace(cpu);
+    if (meter && clock_host_ns() - cpu->clock.meter_ns >= 1000000000ull)
+      report_meter(cpu);
+  }
+  return reason;
+}
+
+static void report_pacing(cpu_t *cpu, uint64_t elapsed) {
+  const clock_drift_t *drift = &cpu->clock.drift;
+
+  if (!clock_paced(cpu) || drift->slices == 0)
+    return;
+
+  fprintf(stdout,
+          "Pacing: %.3f MHz, %" PRIu64 " slices, %" PRIu64 " late, %" PRIu64
+          " resyncs\n",
+          cpu->clock.rate / 1e6, drift->slices, drift->late,
+          drift->resyncs);
+  fprintf(stdout, "Drift: mean %.1f us, max %.1f us\n",
+          (double)drift->drift_ns / (double)drift->slices / 1e3,
+          (double)drift->drift_max_ns / 1e3);
+  if (elapsed > 0) {
+    fprintf(stdout, "Host idle: %.1f%%\n",
+            100.0 * (double)drift->slept_ns / (double)elapsed);
+  }
+}
+
+static int headless_run(cpu_t *cpu, uint16_t address,
+                        uint64_t max_instructions, int meter) {
+  uint64_t start = 0;
+  uint64_t elapsed = 0;
+  clock_speed_t speed;
+  cpu_exit_t reason;
+
+  register_value_set(cpu, REG_PC, address);
+  register_value_set(cpu, REG_SP, 0xFFFF);
+
+  start = clock_host_ns();
+  reason = headless_execute(cpu, max_instructions, meter);
+  elapsed = clock_host_ns() - start;
+  speed = clock_speed(clock_cycles(cpu), cpu->instructions, elapsed);
+
+  fprintf(stdout, "Exit reason: %s\n", cpu_exit_name(reason));
+  fprintf(stdout, "PC: %04X\n", register_value_get(cpu, REG_PC));
+  fprintf(stdout, "Instructions: %" PRIu64 "\n", cpu->instructions);
+  fprintf(stdout, "T-states: %" PRIu64 "\n", clock_cycles(cpu));
+  fprintf(stdout, "Host time: %.6f s\n", (double)elapsed / 1e9);
+  if (elapsed > 0) {
+    fprintf(stdout, "Rate: %.0f instructions/s\n",
+            speed.instructions_per_second);
+    fprintf(stdout, "Emulated: %.3f MHz\n", speed.mhz);
+  }
+  if (cpu->blocks) {
+    fprintf(stdout, "Blocks: %" PRIu64 " built, %" PRIu64 " invalidated\n",
+            cpu->blocks->built, cpu->blocks->invalidated);
   }
+  if (cpu->jit) {
+    fprintf(stdout, "JIT: %" PRIu64 " translated, %" PRIu64 " refused\n",
+            cpu->jit->translated, cpu->jit->refused);
+  }
+  if (cpu->idle_tstates > 0) {
+    fprintf(stdout, "Idle: %" PRIu64 " T-states fast-forwarded (%.1f%%)\n",
+            cpu->idle_tstates,
+            100.0 * (double)cpu->idle_tstates / (double)clock_cycles(cpu));
+  }
+  report_pacing(cpu, elapsed);
+
+  return (reason == CPU_EXIT_HALT || reason == CPU_EXIT_BUDGET) ? 0 : -1;
+}
+
+static void usage(const char *name) {
+  fprintf(stderr,
+          "Usage: %s [--headless] [--bench] [--no-block-cache] [--jit] "
+          "[--eager-flags] [--max-instructions n] [--mhz f] [--speed x] "
+          "[--turbo] [--meter] [--idle-detect] [--rom path] [--ram-image path] "
+          "[path [hex_address]]\n",
+          name);
 }
 
 int main(int argc, char *argv[]) {
-  cpu_t *cpu = (cpu_t *)malloc(sizeof(cpu_t));
+  cpu_t *cpu = NULL;
+  int headless = 0;
+  int bench = 0;
+  int block_cache = 1;
+  int jit = 0;
+  int eager_flags = 0;
+  const char *path = NULL;
+  const char *rom_path = NULL;
+  const char *ram_path = NULL;
+  uint16_t address = 0;
+  uint64_t max_instructions = CPU_RUN_FOREVER;
+  uint32_t frequency = 0;
+  double speed = 1.0;
+  int turbo = 0;
+  int meter = 0;
+  int idle_detect = 0;
+  int status = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--headless") == 0) {
+      headless = 1;
+    } else if (strcmp(argv[i], "--bench") == 0) {
+      headless = 1;
+      bench = 1;
+    } else if (strcmp(argv[i], "--no-block-cache") == 0) {
+      block_cache = 0;
+    } else if (strcmp(argv[i], "--jit") == 0) {
+      jit = 1;
+    } else if (strcmp(argv[i], "--eager-flags") == 0) {
+      eager_flags = 1;
+    } else if (strcmp(argv[i], "--max-instructions") == 0 && i + 1 < argc) {
+      char *end = NULL;
+      max_instructions = strtoull(argv[++i], &end, 10);
+      if (*end != '\0' || max_instructions == 0) {
+        usage(argv[0]);
+        return -1;
+      }
+    } else if (strcmp(argv[i], "--mhz") == 0 && i + 1 < argc) {
+      if (parse_mhz(argv[++i], &frequency) != 0) {
+        usage(argv[0]);
+        return -1;
+      }
+    } else if (strcmp(argv[i], "--speed") == 0 && i + 1 < argc) {
+      if (parse_speed(argv[++i], &speed) != 0) {
+        usage(argv[0]);
+        return -1;
+      }
+    } else if (strcmp(argv[i], "--turbo") == 0) {
+      turbo = 1;
+    } else if (strcmp(argv[i], "--meter") == 0) {
+      meter = 1;
+    } else if (strcmp(argv[i], "--idle-detect") == 0) {
+      idle_detect = 1;
+    } else if (strcmp(argv[i], "--rom") == 0 && i + 1 < argc) {
+      rom_path = argv[++i];
+    } else if (strcmp(argv[i], "--ram-image") == 0 && i + 1 < argc) {
+      ram_path = argv[++i];
+    } else if (argv[i][0] == '-') {
+      usage(argv[0]);
+      return -1;
+    } else if (!path) {
+      path = argv[i];
+    } else if (parse_hex(argv[i], &address) != 0) {
+      usage(argv[0]);
+      return -1;
+    }
+  }
 
+  cpu = (cpu_t *)malloc(sizeof(cpu_t));
   if (!cpu) {
     fprintf(stderr, "Cannot allocate CPU\n");
     return -1;
   }
 
-  if (cpu_init(cpu, CLOCK_DELAY, MEMORY_SIZE) != 0) {
+  if (cpu_init(cpu, MEMORY_SIZE) != 0) {
     fprintf(stderr, "Cannot initialise CPU\n");
     free(cpu);
     return -1;
   }
 
-  instruction_map_init();
-
   fprintf(stdout, "Memory size: %04x\n", memory_get_size(cpu));
 
-  if (memory_load(cpu, test_program, test_program_size) != 0) {
+  if (!block_cache)
+    block_cache_destroy(cpu);
+  if (eager_flags)
+    cpu->lazy_flags = false;
+  if (idle_detect)
+    cpu->idle_detect = true;
+  clock_set_frequency(cpu, frequency);
+  clock_set_speed(cpu, speed);
+  clock_set_turbo(cpu, turbo);
+  if (jit && jit_init(cpu) != 0)
+    fprintf(stderr, "Running without the JIT\n");
+
+  if ((ram_path && map_image_file(cpu, ram_path, MEMORY_RAM) != 0) ||
+      (rom_path && map_image_file(cpu, rom_path, MEMORY_ROM) != 0)) {
+    cpu_destroy(cpu);
+    free(cpu);
+    return -1;
+  }
+
+  if (path) {
+    if (load_file_to_memory(cpu, path, address) != 0) {
+      cpu_destroy(cpu);
+      free(cpu);
+      return -1;
+    }
+  } else if (bench) {
+    if (memory_load(cpu, bench_program, bench_program_size) != 0) {
+      fprintf(stderr, "Cannot load benchmark program\n");
+      cpu_destroy(cpu);
+      free(cpu);
+      return -1;
+    }
+  } else if (!rom_path && !ram_path &&
+             memory_load(cpu, test_program, test_program_size) != 0) {
     fprintf(stderr, "Cannot load test program\n");
     cpu_destroy(cpu);
     free(cpu);
     return -1;
   }
 
-  debugger_prompt(cpu);
+  if (headless)
+    status = headless_run(cpu, address, max_instructions, meter);
+  else
+    debugger_prompt(cpu);
 
   cpu_destroy(cpu);
   free(cpu);
 
-  return 0;
+  return status;
 }
@@ -17,42 +17,257 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
+#include "block.h"
 #include "cpu.h"
 #include "memory.h"
 
-int memory_init(cpu_t *cpu, uint16_t memory_size) {
+// Point a page's read and write pointers at the right bytes for its flags.
+// MMIO and watched pages, and every page while observing, get NULL so every
+// access to them takes the checking path. RAM holding cached code does the
+// same for writes only, as does RAM not written since the dirty bitmap was
+// cleared. A ROM or unmapped page writes into the sink.
+static void memory_page_update(cpu_t *cpu, uint32_t page) {
+  z80_memory_t *memory = &cpu->memory;
+  uint8_t flags = memory->flags[page];
+
+  if ((flags & (MEMORY_MMIO | MEMORY_WATCH)) || memory->observe) {
+    memory->read[page] = NULL;
+    memory->write[page] = NULL;
+    return;
+  }
+  memory->read[page] = memory->data[page];
+  if (!(flags & MEMORY_RAM))
+    memory->write[page] = memory->sink;
+  else if ((flags & MEMORY_CODE) || !(memory->dirty & (1u << page)))
+    memory->write[page] = NULL;
+  else
+    memory->write[page] = memory->data[page];
+}
+
+static void memory_mark_dirty(cpu_t *cpu, uint32_t page) {
+  if (cpu->memory.dirty & (1u << page))
+    return;
+  cpu->memory.dirty |= 1u << page;
+  memory_page_update(cpu, page);
+}
+
+// Mapped RAM or ROM whose bytes loaders may change. Unmapped pages and
+// read-only file mappings have nothing to write into.
+static inline bool memory_backing_writable(uint8_t flags) {
+  return (flags & (MEMORY_RAM | MEMORY_ROM)) && !(flags & MEMORY_READONLY);
+}
+
+// Point a page at new backing bytes. Cached blocks translated from the old
+// bytes are dropped; a page that keeps its bytes (RAM <-> ROM) keeps them.
+static void memory_page_map(cpu_t *cpu, uint32_t page, uint8_t *data,
+                            uint8_t type) {
+  z80_memory_t *memory = &cpu->memory;
+
+  if (memory->data[page] != data && cpu->blocks) {
+    uint32_t first = (page << MEMORY_PAGE_SHIFT) >> BLOCK_PAGE_SHIFT;
+
+    for (uint32_t code = first;
+         code < first + (MEMORY_PAGE_SIZE >> BLOCK_PAGE_SHIFT); code++) {
+      if (cpu->blocks->code_pages[code])
+        block_cache_invalidate(cpu, (uint16_t)(code << BLOCK_PAGE_SHIFT));
+    }
+  }
+  memory->data[page] = data;
+  memory->flags[page] &= (uint8_t)(MEMORY_MMIO | MEMORY_WATCH | MEMORY_CODE);
+  memory->flags[page] |= type;
+  memory->dirty |= 1u << page;
+  memory_page_update(cpu, page);
+}
+
+int memory_init(cpu_t *cpu, uint32_t memory_size) {
+  z80_memory_t *memory;
+  uint32_t pages;
+
   if (!cpu)
     return -1;
 
-  cpu->memory.size = memory_size;
-  cpu->memory.memory = (char *)malloc(cpu->memory.size);
+  memory = &cpu->memory;
+  memset(memory, 0, sizeof(*memory));
+
+  pages = (uint32_t)(((uint64_t)memory_size + MEMORY_PAGE_MASK) >>
+                     MEMORY_PAGE_SHIFT);
+  if (pages > UINT32_MAX >> MEMORY_PAGE_SHIFT) {
+    fprintf(stderr, "Memory size too large: %x\n", memory_size);
+    return -1;
+  }
+  memory->size = pages << MEMORY_PAGE_SHIFT;
+  memory->pool = (uint8_t *)calloc(pages ? pages : 1, MEMORY_PAGE_SIZE);
+  memory->sink = (uint8_t *)malloc(MEMORY_PAGE_SIZE);
+  memory->open_bus = (uint8_t *)malloc(MEMORY_PAGE_SIZE);
 
-  if (!cpu->memory.memory) {
-    fprintf(stderr, "Cannot allocate memory space: %u\n", cpu->memory.size);
+  if (!memory->pool || !memory->sink || !memory->open_bus) {
+    fprintf(stderr, "Cannot allocate memory space: %u\n", memory->size);
+    memory_destroy(cpu);
     return -1;
   }
+  memset(memory->open_bus, 0xFF, MEMORY_PAGE_SIZE);
+  memory->dirty = (uint32_t)((1ull << MEMORY_PAGES) - 1);
 
-  memset(cpu->memory.memory, 0, cpu->memory.size);
+  // The start of the pool is mapped as RAM from address 0; anything the
+  // pool does not cover is unmapped.
+  for (uint32_t page = 0; page < MEMORY_PAGES; page++) {
+    if (page < pages) {
+      memory->data[page] = memory->pool + (page << MEMORY_PAGE_SHIFT);
+      memory->flags[page] = MEMORY_RAM;
+    } else {
+      memory->data[page] = memory->open_bus;
+      memory->flags[page] = 0;
+    }
+    memory_page_update(cpu, page);
+  }
 
-  fprintf(stdout, "Memory allocated: %x\n", memory_size);
+  fprintf(stdout, "Memory allocated: %x\n", memory->size);
   return 0;
 }
 
 int memory_destroy(cpu_t *cpu) {
   if (!cpu)
     return 0;
-  if (cpu->memory.memory)
-    free(cpu->memory.memory);
-  cpu->memory.memory = NULL;
-  cpu->memory.size = 0;
+  free(cpu->memory.pool);
+  free(cpu->memory.sink);
+  free(cpu->memory.open_bus);
+  for (uint8_t i = 0; i < cpu->memory.image_count; i++)
+    munmap(cpu->memory.images[i].base, cpu->memory.images[i].size);
+  free(cpu->memory.watch);
+  memset(&cpu->memory, 0, sizeof(cpu->memory));
   return 0;
 }
 
-uint16_t memory_get_size(cpu_t *cpu) {
+// Checks a page-aligned window of the 64 KiB address space.
+static bool memory_window_valid(uint16_t address, uint32_t length) {
+  return length > 0 && (address & MEMORY_PAGE_MASK) == 0 &&
+         (length & MEMORY_PAGE_MASK) == 0 &&
+         (uint32_t)address + length <= 0x10000;
+}
+
+// Map length bytes from offset in a region of size bytes at base.
+static int memory_map_region(cpu_t *cpu, uint16_t address, uint32_t length,
+                             uint8_t *base, uint32_t size, uint32_t offset,
+                             uint8_t type) {
+  uint32_t page;
+
+  if (!memory_window_valid(address, length) || (offset & MEMORY_PAGE_MASK) ||
+      offset > size || length > size - offset) {
+    fprintf(stderr, "Cannot map %x bytes at %04X from %x\n", length, address,
+            offset);
+    return -1;
+  }
+
+  page = address >> MEMORY_PAGE_SHIFT;
+  for (uint32_t at = 0; at < length; at += MEMORY_PAGE_SIZE, page++)
+    memory_page_map(cpu, page, base + offset + at, type);
+  return 0;
+}
+
+int memory_map(cpu_t *cpu, uint16_t address, uint32_t length,
+               uint32_t offset, uint8_t type) {
+  if (!cpu || !cpu->memory.pool)
+    return -1;
+  if (type != MEMORY_RAM && type != MEMORY_ROM) {
+    fprintf(stderr, "Cannot map memory type %x\n", type);
+    return -1;
+  }
+  return memory_map_region(cpu, address, length, cpu->memory.pool,
+                           cpu->memory.size, offset, type);
+}
+
+int memory_unmap(cpu_t *cpu, uint16_t address, uint32_t length) {
+  uint32_t page;
+
+  if (!cpu || !cpu->memory.pool)
+    return -1;
+  if (!memory_window_valid(address, length)) {
+    fprintf(stderr, "Cannot unmap %x bytes at %04X\n", length, address);
+    return -1;
+  }
+
+  page = address >> MEMORY_PAGE_SHIFT;
+  for (uint32_t at = 0; at < length; at += MEMORY_PAGE_SIZE, page++)
+    memory_page_map(cpu, page, cpu->memory.open_bus, 0);
+  return 0;
+}
+
+int memory_image_open(cpu_t *cpu, const char *path, uint8_t type) {
+  z80_memory_t *memory;
+  struct stat info;
+  void *base;
+  size_t size;
+  int fd;
+
+  if (!cpu || !path || (type != MEMORY_RAM && type != MEMORY_ROM))
+    return -1;
+
+  memory = &cpu->memory;
+  if (memory->image_count >= MEMORY_IMAGES) {
+    fprintf(stderr, "Too many memory images: %s\n", path);
+    return -1;
+  }
+
+  fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    fprintf(stderr, "Cannot open file: %s\n", path);
+    return -1;
+  }
+  if (fstat(fd, &info) != 0 || info.st_size <= 0 ||
+      (uint64_t)info.st_size > UINT32_MAX - MEMORY_PAGE_MASK) {
+    fprintf(stderr, "Cannot map file: %s\n", path);
+    close(fd);
+    return -1;
+  }
+
+  // Round up to whole pages. The host maps at least a page past the end of
+  // the file, so the tail of the last page reads as zeros.
+  size = ((size_t)info.st_size + MEMORY_PAGE_MASK) & ~(size_t)MEMORY_PAGE_MASK;
+  if (type == MEMORY_ROM)
+    base = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+  else
+    base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    fprintf(stderr, "Cannot map file: %s\n", path);
+    return -1;
+  }
+
+  memory->images[memory->image_count].base = (uint8_t *)base;
+  memory->images[memory->image_count].size = (uint32_t)size;
+  memory->images[memory->image_count].type = type;
+  return memory->image_count++;
+}
+
+uint32_t memory_image_size(cpu_t *cpu, int image) {
+  if (!cpu || image < 0 || image >= cpu->memory.image_count)
+    return 0;
+  return cpu->memory.images[image].size;
+}
+
+int memory_map_image(cpu_t *cpu, int image, uint16_t address,
+                     uint32_t length, uint32_t offset) {
+  memory_image_t *mapped;
+
+  if (!cpu || !cpu->memory.pool || image < 0 ||
+      image >= cpu->memory.image_count)
+    return -1;
+
+  mapped = &cpu->memory.images[image];
+  return memory_map_region(
+      cpu, address, length, mapped->base, mapped->size, offset,
+      mapped->type == MEMORY_ROM ? MEMORY_ROM | MEMORY_READONLY : MEMORY_RAM);
+}
+
+uint32_t memory_get_size(cpu_t *cpu) {
   if (!cpu) {
     fprintf(stderr, "Memory not allocated\n");
     return 0;
@@ -64,36 +279,342 @@ int memory_load(cpu_t *cpu, const uint8_t *buffer, size_t length) {
   return memory_load_at(cpu, buffer, length, 0);
 }
 
+// Loads go straight to the backing bytes, so they can fill ROM. Every byte
+// must land on a RAM or ROM page that is not a read-only file mapping.
 int memory_load_at(cpu_t *cpu, const uint8_t *buffer, size_t length,
                    uint16_t offset) {
-  if (!cpu || !cpu->memory.memory || !buffer)
+  if (!cpu || !cpu->memory.pool || !buffer)
     return -1;
-  if ((size_t)offset + length > cpu->memory.size)
+  if ((size_t)offset + length > 0x10000)
     return -1;
 
-  memcpy(cpu->memory.memory + offset, buffer, length);
+  for (size_t at = offset; at < (size_t)offset + length;
+       at += MEMORY_PAGE_SIZE - (at & MEMORY_PAGE_MASK)) {
+    if (!memory_backing_writable(cpu->memory.flags[at >> MEMORY_PAGE_SHIFT]))
+      return -1;
+  }
+
+  for (size_t done = 0; done < length;) {
+    uint32_t at = (uint32_t)(offset + done);
+    size_t chunk = MEMORY_PAGE_SIZE - (at & MEMORY_PAGE_MASK);
+
+    if (chunk > length - done)
+      chunk = length - done;
+    memcpy(cpu->memory.data[at >> MEMORY_PAGE_SHIFT] + (at & MEMORY_PAGE_MASK),
+           buffer + done, chunk);
+    memory_mark_dirty(cpu, at >> MEMORY_PAGE_SHIFT);
+    done += chunk;
+  }
+  block_cache_flush(cpu);
   return 0;
 }
 
-int memory_set(cpu_t *cpu, uint16_t address, uint8_t value) {
-  if (!cpu)
+static const memory_mmio_t *memory_mmio_find(cpu_t *cpu, uint16_t address) {
+  for (uint32_t i = 0; i < MEMORY_MMIO_REGIONS; i++) {
+    const memory_mmio_t *region = &cpu->memory.mmio[i];
+
+    if (region->used && (uint32_t)(address - region->start) < region->length)
+      return region;
+  }
+  return NULL;
+}
+
+static void memory_watch_record(cpu_t *cpu, uint8_t kind, uint16_t address,
+                                uint8_t old_value, uint8_t new_value) {
+  memory_watch_hit_t *hit = &cpu->memory.watch_hit;
+
+  if (hit->hit)
+    return;
+  hit->hit = true;
+  hit->kind = kind;
+  hit->address = address;
+  hit->old_value = old_value;
+  hit->new_value = new_value;
+}
+
+// Accesses to pages whose pointer is NULL.
+void memory_set_slow(cpu_t *cpu, uint16_t address, uint8_t value) {
+  uint32_t page = address >> MEMORY_PAGE_SHIFT;
+  uint8_t flags = cpu->memory.flags[page];
+
+  cpu->memory.slow_accesses++;
+  if (cpu->memory.observe) {
+    cpu->last_mem_write = address;
+    cpu->last_mem_write_valid = true;
+  }
+  if (flags & MEMORY_WATCH) {
+    uint8_t kinds = cpu->memory.watch[address];
+    uint8_t old_value = cpu->memory.data[page][address & MEMORY_PAGE_MASK];
+
+    if (kinds & MEMORY_WATCH_WRITE)
+      memory_watch_record(cpu, MEMORY_WATCH_WRITE, address, old_value, value);
+    else if ((kinds & MEMORY_WATCH_CHANGE) && (flags & MEMORY_RAM) &&
+             old_value != value)
+      memory_watch_record(cpu, MEMORY_WATCH_CHANGE, address, old_value, value);
+  }
+  if (flags & MEMORY_MMIO) {
+    const memory_mmio_t *region = memory_mmio_find(cpu, address);
+
+    if (region && region->write) {
+      region->write(region->context, address, value);
+      return;
+    }
+  }
+  if (!(flags & MEMORY_RAM))
+    return;
+
+  cpu->memory.data[page][address & MEMORY_PAGE_MASK] = value;
+  memory_mark_dirty(cpu, page);
+  if (cpu->blocks && cpu->blocks->code_pages[address >> BLOCK_PAGE_SHIFT])
+    block_cache_invalidate(cpu, address);
+}
+
+uint8_t memory_get_slow(cpu_t *cpu, uint16_t address) {
+  uint32_t page = address >> MEMORY_PAGE_SHIFT;
+  uint8_t flags = cpu->memory.flags[page];
+  uint8_t value;
+
+  cpu->memory.slow_accesses++;
+  if (cpu->memory.observe) {
+    cpu->last_mem_read = address;
+    cpu->last_mem_read_valid = true;
+  }
+  if (flags & MEMORY_MMIO) {
+    const memory_mmio_t *region = memory_mmio_find(cpu, address);
+
+    value = region && region->read
+                ? region->read(region->context, address)
+                : cpu->memory.data[page][address & MEMORY_PAGE_MASK];
+  } else {
+    value = cpu->memory.data[page][address & MEMORY_PAGE_MASK];
+  }
+  if ((flags & MEMORY_WATCH) &&
+      (cpu->memory.watch[address] & MEMORY_WATCH_READ))
+    memory_watch_record(cpu, MEMORY_WATCH_READ, address, value, value);
+  return value;
+}
+
+void memory_observe(cpu_t *cpu, bool observe) {
+  if (!cpu || !cpu->memory.pool || cpu->memory.observe == observe)
+    return;
+
+  cpu->memory.observe = observe;
+  for (uint32_t page = 0; page < MEMORY_PAGES; page++)
+    memory_page_update(cpu, page);
+}
+
+void memory_code_update(cpu_t *cpu, uint16_t address) {
+  uint32_t page = address >> MEMORY_PAGE_SHIFT;
+  uint32_t first = (page << MEMORY_PAGE_SHIFT) >> BLOCK_PAGE_SHIFT;
+  uint8_t code = 0;
+
+  if (!cpu || !cpu->memory.pool)
+    return;
+
+  for (uint32_t i = first;
+       cpu->blocks && i < first + (MEMORY_PAGE_SIZE >> BLOCK_PAGE_SHIFT); i++) {
+    if (cpu->blocks->code_pages[i]) {
+      code = MEMORY_CODE;
+      break;
+    }
+  }
+  if ((cpu->memory.flags[page] & MEMORY_CODE) == code)
+    return;
+  cpu->memory.flags[page] ^= MEMORY_CODE;
+  memory_page_update(cpu, page);
+}
+
+uint8_t memory_peek(cpu_t *cpu, uint16_t address) {
+  if (!cpu || !cpu->memory.pool)
+    return 0xFF;
+  return cpu->memory.data[address >> MEMORY_PAGE_SHIFT]
+                         [address & MEMORY_PAGE_MASK];
+}
+
+int memory_poke(cpu_t *cpu, uint16_t address, uint8_t value) {
+  uint32_t page = address >> MEMORY_PAGE_SHIFT;
+
+  if (!cpu || !cpu->memory.pool)
     return -1;
-  if (!cpu->memory.memory)
+  if (!memory_backing_writable(cpu->memory.flags[page]))
     return -1;
 
-  cpu->memory.memory[address] = value;
-  cpu->last_mem_write = address;
-  cpu->last_mem_write_valid = true;
+  cpu->memory.data[page][address & MEMORY_PAGE_MASK] = value;
+  memory_mark_dirty(cpu, page);
+  if (cpu->blocks && cpu->blocks->code_pages[address >> BLOCK_PAGE_SHIFT])
+    block_cache_invalidate(cpu, address);
   return 0;
 }
 
-uint8_t memory_get(cpu_t *cpu, uint16_t address) {
+// Mark the mapped pages covering [address, address + length) read-only, or
+// writable again. Partial pages are included whole.
+int memory_set_rom(cpu_t *cpu, uint16_t address, uint32_t length, bool rom) {
+  uint32_t first, last;
+
+  if (!cpu || !cpu->memory.pool || length == 0 ||
+      (uint32_t)address + length > 0x10000)
+    return -1;
+
+  first = address >> MEMORY_PAGE_SHIFT;
+  last = ((uint32_t)address + length - 1) >> MEMORY_PAGE_SHIFT;
+  for (uint32_t page = first; page <= last; page++) {
+    if (!memory_backing_writable(cpu->memory.flags[page]) &&
+        !(rom && (cpu->memory.flags[page] & MEMORY_ROM)))
+      return -1;
+  }
+  for (uint32_t page = first; page <= last; page++) {
+    cpu->memory.flags[page] &= (uint8_t)~(MEMORY_RAM | MEMORY_ROM);
+    cpu->memory.flags[page] |= rom ? MEMORY_ROM : MEMORY_RAM;
+    memory_page_update(cpu, page);
+  }
+  return 0;
+}
+
+uint8_t memory_page_flags(cpu_t *cpu, uint16_t address) {
   if (!cpu)
     return 0;
-  if (!cpu->memory.memory)
+  return cpu->memory.flags[address >> MEMORY_PAGE_SHIFT];
+}
+
+// Flag the pages touched by any registered region as MEMORY_MMIO.
+static void memory_mmio_flag_pages(cpu_t *cpu) {
+  uint8_t mmio[MEMORY_PAGES] = {0};
+
+  for (uint32_t i = 0; i < MEMORY_MMIO_REGIONS; i++) {
+    const memory_mmio_t *region = &cpu->memory.mmio[i];
+
+    if (!region->used)
+      continue;
+    for (uint32_t page = region->start >> MEMORY_PAGE_SHIFT;
+         page <= (region->start + region->length - 1) >> MEMORY_PAGE_SHIFT;
+         page++)
+      mmio[page] = MEMORY_MMIO;
+  }
+  for (uint32_t page = 0; page < MEMORY_PAGES; page++) {
+    if ((cpu->memory.flags[page] & MEMORY_MMIO) == mmio[page])
+      continue;
+    cpu->memory.flags[page] ^= MEMORY_MMIO;
+    memory_page_update(cpu, page);
+  }
+}
+
+int memory_mmio_add(cpu_t *cpu, uint16_t address, uint32_t length,
+                    memory_mmio_read_t read, memory_mmio_write_t write,
+                    void *context) {
+  if (!cpu || length == 0 || (uint32_t)address + length > 0x10000 ||
+      (!read && !write))
+    return -1;
+
+  for (int i = 0; i < MEMORY_MMIO_REGIONS; i++) {
+    memory_mmio_t *region = &cpu->memory.mmio[i];
+
+    if (region->used)
+      continue;
+    region->used = true;
+    region->start = address;
+    region->length = length;
+    region->read = read;
+    region->write = write;
+    region->context = context;
+    memory_mmio_flag_pages(cpu);
+    return i;
+  }
+
+  fprintf(stderr, "Too many MMIO regions\n");
+  return -1;
+}
+
+int memory_mmio_remove(cpu_t *cpu, int region) {
+  if (!cpu || region < 0 || region >= MEMORY_MMIO_REGIONS ||
+      !cpu->memory.mmio[region].used)
+    return -1;
+
+  memset(&cpu->memory.mmio[region], 0, sizeof(cpu->memory.mmio[region]));
+  memory_mmio_flag_pages(cpu);
+  return 0;
+}
+
+// Add (set) or remove kinds on each byte of the range, keeping the per-page
+// counts and MEMORY_WATCH flags in step.
+static int memory_watch_update(cpu_t *cpu, uint16_t address, uint32_t length,
+                               uint8_t kinds, bool set) {
+  z80_memory_t *memory;
+
+  if (!cpu || !cpu->memory.pool || length == 0 ||
+      (uint32_t)address + length > 0x10000)
+    return -1;
+
+  memory = &cpu->memory;
+  kinds &= MEMORY_WATCH_READ | MEMORY_WATCH_WRITE | MEMORY_WATCH_CHANGE;
+  if (!memory->watch) {
+    if (!set)
+      return 0;
+    memory->watch = (uint8_t *)calloc(0x10000, 1);
+    if (!memory->watch) {
+      fprintf(stderr, "Cannot allocate watchpoints\n");
+      return -1;
+    }
+  }
+
+  for (uint32_t at = address; at < (uint32_t)address + length; at++) {
+    uint32_t page = at >> MEMORY_PAGE_SHIFT;
+    uint8_t old_kinds = memory->watch[at];
+
+    memory->watch[at] = set ? (uint8_t)(old_kinds | kinds)
+                            : (uint8_t)(old_kinds & ~kinds);
+    if (!old_kinds == !memory->watch[at])
+      continue;
+    if (memory->watch[at]) {
+      memory->watch_count++;
+      if (memory->watch_pages[page]++ > 0)
+        continue;
+    } else {
+      memory->watch_count--;
+      if (--memory->watch_pages[page] > 0)
+        continue;
+    }
+    memory->flags[page] ^= MEMORY_WATCH;
+    memory_page_update(cpu, page);
+  }
+  return 0;
+}
+
+int memory_watch_set(cpu_t *cpu, uint16_t address, uint32_t length,
+                     uint8_t kinds) {
+  return memory_watch_update(cpu, address, length, kinds, true);
+}
+
+int memory_watch_clear(cpu_t *cpu, uint16_t address, uint32_t length,
+                       uint8_t kinds) {
+  return memory_watch_update(cpu, address, length, kinds, false);
+}
+
+uint8_t memory_watch_get(cpu_t *cpu, uint16_t address) {
+  if (!cpu || !cpu->memory.watch)
     return 0;
+  return cpu->memory.watch[address];
+}
 
-  cpu->last_mem_read = address;
-  cpu->last_mem_read_valid = true;
-  return cpu->memory.memory[address];
+uint32_t memory_dirty_pages(cpu_t *cpu) {
+  if (!cpu)
+    return 0;
+  return cpu->memory.dirty;
+}
+
+bool memory_page_dirty(cpu_t *cpu, uint16_t address) {
+  if (!cpu)
+    return false;
+  return (cpu->memory.dirty >> (address >> MEMORY_PAGE_SHIFT)) & 1;
+}
+
+void memory_dirty_clear(cpu_t *cpu, uint32_t pages) {
+  if (!cpu || !cpu->memory.pool)
+    return;
+
+  for (uint32_t page = 0; page < MEMORY_PAGES; page++) {
+    if (!(pages & cpu->memory.dirty & (1u << page)))
+      continue;
+    cpu->memory.dirty &= ~(1u << page);
+    memory_page_update(cpu, page);
+  }
 }
@@ -1,1816 +0,0 @@
-/*
- * This file is part of raveloxzemu.
- *
- * Copyright (C) 2026 Dave Kelly
- *
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see <https://www.gnu.org/licenses/>.
- */
-
-#include "opcode_table.h"
-
-const opcode_info_t opcode_table[] = {
-  {{0x00, 0x00, 0x00, 0x00}, 1, 0, "NOP"},
-  {{0x01, 0x00, 0x00, 0x00}, 3, 0, "LD BC,nn"},
-  {{0x02, 0x00, 0x00, 0x00}, 1, 0, "LD (BC),A"},
-  {{0x03, 0x00, 0x00, 0x00}, 1, 0, "INC BC"},
-  {{0x04, 0x00, 0x00, 0x00}, 1, 0, "INC B"},
-  {{0x05, 0x00, 0x00, 0x00}, 1, 0, "DEC B"},
-  {{0x06, 0x00, 0x00, 0x00}, 2, 0, "LD B,n"},
-  {{0x07, 0x00, 0x00, 0x00}, 1, 0, "RLCA"},
-  {{0x08, 0x00, 0x00, 0x00}, 1, 0, "EX AF,AF'"},
-  {{0x09, 0x00, 0x00, 0x00}, 1, 0, "ADD HL,BC"},
-  {{0x0A, 0x00, 0x00, 0x00}, 1, 0, "LD A,(BC)"},
-  {{0x0B, 0x00, 0x00, 0x00}, 1, 0, "DEC BC"},
-  {{0x0C, 0x00, 0x00, 0x00}, 1, 0, "INC C"},
-  {{0x0D, 0x00, 0x00, 0x00}, 1, 0, "DEC C"},
-  {{0x0E, 0x00, 0x00, 0x00}, 2, 0, "LD C,n"},
-  {{0x0F, 0x00, 0x00, 0x00}, 1, 0, "RRCA"},
-  {{0x10, 0x00, 0x00, 0x00}, 2, 0, "DJNZ d"},
-  {{0x11, 0x00, 0x00, 0x00}, 3, 0, "LD DE,nn"},
-  {{0x12, 0x00, 0x00, 0x00}, 1, 0, "LD (DE),A"},
-  {{0x13, 0x00, 0x00, 0x00}, 1, 0, "INC DE"},
-  {{0x14, 0x00, 0x00, 0x00}, 1, 0, "INC D"},
-  {{0x15, 0x00, 0x00, 0x00}, 1, 0, "DEC D"},
-  {{0x16, 0x00, 0x00, 0x00}, 2, 0, "LD D,n"},
-  {{0x17, 0x00, 0x00, 0x00}, 1, 0, "RLA"},
-  {{0x18, 0x00, 0x00, 0x00}, 2, 0, "JR d"},
-  {{0x19, 0x00, 0x00, 0x00}, 1, 0, "ADD HL,DE"},
-  {{0x1A, 0x00, 0x00, 0x00}, 1, 0, "LD A,(DE)"},
-  {{0x1B, 0x00, 0x00, 0x00}, 1, 0, "DEC DE"},
-  {{0x1C, 0x00, 0x00, 0x00}, 1, 0, "INC E"},
-  {{0x1D, 0x00, 0x00, 0x00}, 1, 0, "DEC E"},
-  {{0x1E, 0x00, 0x00, 0x00}, 2, 0, "LD E,n"},
-  {{0x1F, 0x00, 0x00, 0x00}, 1, 0, "RRA"},
-  {{0x20, 0x00, 0x00, 0x00}, 2, 0, "JR NZ,d"},
-  {{0x21, 0x00, 0x00, 0x00}, 3, 0, "LD HL,nn"},
-  {{0x22, 0x00, 0x00, 0x00}, 3, 0, "LD (nn),HL"},
-  {{0x23, 0x00, 0x00, 0x00}, 1, 0, "INC HL"},
-  {{0x24, 0x00, 0x00, 0x00}, 1, 0, "INC H"},
-  {{0x25, 0x00, 0x00, 0x00}, 1, 0, "DEC H"},
-  {{0x26, 0x00, 0x00, 0x00}, 2, 0, "LD H,n"},
-  {{0x27, 0x00, 0x00, 0x00}, 1, 0, "DAA"},
-  {{0x28, 0x00, 0x00, 0x00}, 2, 0, "JR Z,d"},
-  {{0x29, 0x00, 0x00, 0x00}, 1, 0, "ADD HL,HL"},
-  {{0x2A, 0x00, 0x00, 0x00}, 3, 0, "LD HL,(nn)"},
-  {{0x2B, 0x00, 0x00, 0x00}, 1, 0, "DEC HL"},
-  {{0x2C, 0x00, 0x00, 0x00}, 1, 0, "INC L"},
-  {{0x2D, 0x00, 0x00, 0x00}, 1, 0, "DEC L"},
-  {{0x2E, 0x00, 0x00, 0x00}, 2, 0, "LD L,n"},
-  {{0x2F, 0x00, 0x00, 0x00}, 1, 0, "CPL"},
-  {{0x30, 0x00, 0x00, 0x00}, 2, 0, "JR NC,d"},
-  {{0x31, 0x00, 0x00, 0x00}, 3, 0, "LD SP,nn"},
-  {{0x32, 0x00, 0x00, 0x00}, 3, 0, "LD (nn),A"},
-  {{0x33, 0x00, 0x00, 0x00}, 1, 0, "INC SP"},
-  {{0x34, 0x00, 0x00, 0x00}, 1, 0, "INC (HL)"},
-  {{0x35, 0x00, 0x00, 0x00}, 1, 0, "DEC (HL)"},
-  {{0x36, 0x00, 0x00, 0x00}, 2, 0, "LD (HL),n"},
-  {{0x37, 0x00, 0x00, 0x00}, 1, 0, "SCF"},
-  {{0x38, 0x00, 0x00, 0x00}, 2, 0, "JR C,d"},
-  {{0x39, 0x00, 0x00, 0x00}, 1, 0, "ADD HL,SP"},
-  {{0x3A, 0x00, 0x00, 0x00}, 3, 0, "LD A,(nn)"},
-  {{0x3B, 0x00, 0x00, 0x00}, 1, 0, "DEC SP"},
-  {{0x3C, 0x00, 0x00, 0x00}, 1, 0, "INC A"},
-  {{0x3D, 0x00, 0x00, 0x00}, 1, 0, "DEC A"},
-  {{0x3E, 0x00, 0x00, 0x00}, 2, 0, "LD A,n"},
-  {{0x3F, 0x00, 0x00, 0x00}, 1, 0, "CCF"},
-  {{0x40, 0x00, 0x00, 0x00}, 1, 0, "LD B,B"},
-  {{0x41, 0x00, 0x00, 0x00}, 1, 0, "LD B,C"},
-  {{0x42, 0x00, 0x00, 0x00}, 1, 0, "LD B,D"},
-  {{0x43, 0x00, 0x00, 0x00}, 1, 0, "LD B,E"},
-  {{0x44, 0x00, 0x00, 0x00}, 1, 0, "LD B,H"},
-  {{0x45, 0x00, 0x00, 0x00}, 1, 0, "LD B,L"},
-  {{0x46, 0x00, 0x00, 0x00}, 1, 0, "LD B,(HL)"},
-  {{0x47, 0x00, 0x00, 0x00}, 1, 0, "LD B,A"},
-  {{0x48, 0x00, 0x00, 0x00}, 1, 0, "LD C,B"},
-  {{0x49, 0x00, 0x00, 0x00}, 1, 0, "LD C,C"},
-  {{0x4A, 0x00, 0x00, 0x00}, 1, 0, "LD C,D"},
-  {{0x4B, 0x00, 0x00, 0x00}, 1, 0, "LD C,E"},
-  {{0x4C, 0x00, 0x00, 0x00}, 1, 0, "LD C,H"},
-  {{0x4D, 0x00, 0x00, 0x00}, 1, 0, "LD C,L"},
-  {{0x4E, 0x00, 0x00, 0x00}, 1, 0, "LD C,(HL)"},
-  {{0x4F, 0x00, 0x00, 0x00}, 1, 0, "LD C,A"},
-  {{0x50, 0x00, 0x00, 0x00}, 1, 0, "LD D,B"},
-  {{0x51, 0x00, 0x00, 0x00}, 1, 0, "LD D,C"},
-  {{0x52, 0x00, 0x00, 0x00}, 1, 0, "LD D,D"},
-  {{0x53, 0x00, 0x00, 0x00}, 1, 0, "LD D,E"},
-  {{0x54, 0x00, 0x00, 0x00}, 1, 0, "LD D,H"},
-  {{0x55, 0x00, 0x00, 0x00}, 1, 0, "LD D,L"},
-  {{0x56, 0x00, 0x00, 0x00}, 1, 0, "LD D,(HL)"},
-  {{0x57, 0x00, 0x00, 0x00}, 1, 0, "LD D,A"},
-  {{0x58, 0x00, 0x00, 0x00}, 1, 0, "LD E,B"},
-  {{0x59, 0x00, 0x00, 0x00}, 1, 0, "LD E,C"},
-  {{0x5A, 0x00, 0x00, 0x00}, 1, 0, "LD E,D"},
-  {{0x5B, 0x00, 0x00, 0x00}, 1, 0, "LD E,E"},
-  {{0x5C, 0x00, 0x00, 0x00}, 1, 0, "LD E,H"},
-  {{0x5D, 0x00, 0x00, 0x00}, 1, 0, "LD E,L"},
-  {{0x5E, 0x00, 0x00, 0x00}, 1, 0, "LD E,(HL)"},
-  {{0x5F, 0x00, 0x00, 0x00}, 1, 0, "LD E,A"},
-  {{0x60, 0x00, 0x00, 0x00}, 1, 0, "LD H,B"},
-  {{0x61, 0x00, 0x00, 0x00}, 1, 0, "LD H,C"},
-  {{0x62, 0x00, 0x00, 0x00}, 1, 0, "LD H,D"},
-  {{0x63, 0x00, 0x00, 0x00}, 1, 0, "LD H,E"},
-  {{0x64, 0x00, 0x00, 0x00}, 1, 0, "LD H,H"},
-  {{0x65, 0x00, 0x00, 0x00}, 1, 0, "LD H,L"},
-  {{0x66, 0x00, 0x00, 0x00}, 1, 0, "LD H,(HL)"},
-  {{0x67, 0x00, 0x00, 0x00}, 1, 0, "LD H,A"},
-  {{0x68, 0x00, 0x00, 0x00}, 1, 0, "LD L,B"},
-  {{0x69, 0x00, 0x00, 0x00}, 1, 0, "LD L,C"},
-  {{0x6A, 0x00, 0x00, 0x00}, 1, 0, "LD L,D"},
-  {{0x6B, 0x00, 0x00, 0x00}, 1, 0, "LD L,E"},
-  {{0x6C, 0x00, 0x00, 0x00}, 1, 0, "LD L,H"},
-  {{0x6D, 0x00, 0x00, 0x00}, 1, 0, "LD L,L"},
-  {{0x6E, 0x00, 0x00, 0x00}, 1, 0, "LD L,(HL)"},
-  {{0x6F, 0x00, 0x00, 0x00}, 1, 0, "LD L,A"},
-  {{0x70, 0x00, 0x00, 0x00}, 1, 0, "LD (HL),B"},
-  {{0x71, 0x00, 0x00, 0x00}, 1, 0, "LD (HL),C"},
-  {{0x72, 0x00, 0x00, 0x00}, 1, 0, "LD (HL),D"},
-  {{0x73, 0x00, 0x00, 0x00}, 1, 0, "LD (HL),E"},
-  {{0x74, 0x00, 0x00, 0x00}, 1, 0, "LD (HL),H"},
-  {{0x75, 0x00, 0x00, 0x00}, 1, 0, "LD (HL),L"},
-  {{0x76, 0x00, 0x00, 0x00}, 1, 0, "HALT"},
-  {{0x77, 0x00, 0x00, 0x00}, 1, 0, "LD (HL),A"},
-  {{0x78, 0x00, 0x00, 0x00}, 1, 0, "LD A,B"},
-  {{0x79, 0x00, 0x00, 0x00}, 1, 0, "LD A,C"},
-  {{0x7A, 0x00, 0x00, 0x00}, 1, 0, "LD A,D"},
-  {{0x7B, 0x00, 0x00, 0x00}, 1, 0, "LD A,E"},
-  {{0x7C, 0x00, 0x00, 0x00}, 1, 0, "LD A,H"},
-  {{0x7D, 0x00, 0x00, 0x00}, 1, 0, "LD A,L"},
-  {{0x7E, 0x00, 0x00, 0x00}, 1, 0, "LD A,(HL)"},
-  {{0x7F, 0x00, 0x00, 0x00}, 1, 0, "LD A,A"},
-  {{0x80, 0x00, 0x00, 0x00}, 1, 0, "ADD A,B"},
-  {{0x81, 0x00, 0x00, 0x00}, 1, 0, "ADD A,C"},
-  {{0x82, 0x00, 0x00, 0x00}, 1, 0, "ADD A,D"},
-  {{0x83, 0x00, 0x00, 0x00}, 1, 0, "ADD A,E"},
-  {{0x84, 0x00, 0x00, 0x00}, 1, 0, "ADD A,H"},
-  {{0x85, 0x00, 0x00, 0x00}, 1, 0, "ADD A,L"},
-  {{0x86, 0x00, 0x00, 0x00}, 1, 0, "ADD A,(HL)"},
-  {{0x87, 0x00, 0x00, 0x00}, 1, 0, "ADD A,A"},
-  {{0x88, 0x00, 0x00, 0x00}, 1, 0, "ADC A,B"},
-  {{0x89, 0x00, 0x00, 0x00}, 1, 0, "ADC A,C"},
-  {{0x8A, 0x00, 0x00, 0x00}, 1, 0, "ADC A,D"},
-  {{0x8B, 0x00, 0x00, 0x00}, 1, 0, "ADC A,E"},
-  {{0x8C, 0x00, 0x00, 0x00}, 1, 0, "ADC A,H"},
-  {{0x8D, 0x00, 0x00, 0x00}, 1, 0, "ADC A,L"},
-  {{0x8E, 0x00, 0x00, 0x00}, 1, 0, "ADC A,(HL)"},
-  {{0x8F, 0x00, 0x00, 0x00}, 1, 0, "ADC A,A"},
-  {{0x90, 0x00, 0x00, 0x00}, 1, 0, "SUB B"},
-  {{0x91, 0x00, 0x00, 0x00}, 1, 0, "SUB C"},
-  {{0x92, 0x00, 0x00, 0x00}, 1, 0, "SUB D"},
-  {{0x93, 0x00, 0x00, 0x00}, 1, 0, "SUB E"},
-  {{0x94, 0x00, 0x00, 0x00}, 1, 0, "SUB H"},
-  {{0x95, 0x00, 0x00, 0x00}, 1, 0, "SUB L"},
-  {{0x96, 0x00, 0x00, 0x00}, 1, 0, "SUB (HL)"},
-  {{0x97, 0x00, 0x00, 0x00}, 1, 0, "SUB A"},
-  {{0x98, 0x00, 0x00, 0x00}, 1, 0, "SBC A,B"},
-  {{0x99, 0x00, 0x00, 0x00}, 1, 0, "SBC A,C"},
-  {{0x9A, 0x00, 0x00, 0x00}, 1, 0, "SBC A,D"},
-  {{0x9B, 0x00, 0x00, 0x00}, 1, 0, "SBC A,E"},
-  {{0x9C, 0x00, 0x00, 0x00}, 1, 0, "SBC A,H"},
-  {{0x9D, 0x00, 0x00, 0x00}, 1, 0, "SBC A,L"},
-  {{0x9E, 0x00, 0x00, 0x00}, 1, 0, "SBC A,(HL)"},
-  {{0x9F, 0x00, 0x00, 0x00}, 1, 0, "SBC A,A"},
-  {{0xA0, 0x00, 0x00, 0x00}, 1, 0, "AND B"},
-  {{0xA1, 0x00, 0x00, 0x00}, 1, 0, "AND C"},
-  {{0xA2, 0x00, 0x00, 0x00}, 1, 0, "AND D"},
-  {{0xA3, 0x00, 0x00, 0x00}, 1, 0, "AND E"},
-  {{0xA4, 0x00, 0x00, 0x00}, 1, 0, "AND H"},
-  {{0xA5, 0x00, 0x00, 0x00}, 1, 0, "AND L"},
-  {{0xA6, 0x00, 0x00, 0x00}, 1, 0, "AND (HL)"},
-  {{0xA7, 0x00, 0x00, 0x00}, 1, 0, "AND A"},
-  {{0xA8, 0x00, 0x00, 0x00}, 1, 0, "XOR B"},
-  {{0xA9, 0x00, 0x00, 0x00}, 1, 0, "XOR C"},
-  {{0xAA, 0x00, 0x00, 0x00}, 1, 0, "XOR D"},
-  {{0xAB, 0x00, 0x00, 0x00}, 1, 0, "XOR E"},
-  {{0xAC, 0x00, 0x00, 0x00}, 1, 0, "XOR H"},
-  {{0xAD, 0x00, 0x00, 0x00}, 1, 0, "XOR L"},
-  {{0xAE, 0x00, 0x00, 0x00}, 1, 0, "XOR (HL)"},
-  {{0xAF, 0x00, 0x00, 0x00}, 1, 0, "XOR A"},
-  {{0xB0, 0x00, 0x00, 0x00}, 1, 0, "OR B"},
-  {{0xB1, 0x00, 0x00, 0x00}, 1, 0, "OR C"},
-  {{0xB2, 0x00, 0x00, 0x00}, 1, 0, "OR D"},
-  {{0xB3, 0x00, 0x00, 0x00}, 1, 0, "OR E"},
-  {{0xB4, 0x00, 0x00, 0x00}, 1, 0, "OR H"},
-  {{0xB5, 0x00, 0x00, 0x00}, 1, 0, "OR L"},
-  {{0xB6, 0x00, 0x00, 0x00}, 1, 0, "OR (HL)"},
-  {{0xB7, 0x00, 0x00, 0x00}, 1, 0, "OR A"},
-  {{0xB8, 0x00, 0x00, 0x00}, 1, 0, "CP B"},
-  {{0xB9, 0x00, 0x00, 0x00}, 1, 0, "CP C"},
-  {{0xBA, 0x00, 0x00, 0x00}, 1, 0, "CP D"},
-  {{0xBB, 0x00, 0x00, 0x00}, 1, 0, "CP E"},
-  {{0xBC, 0x00, 0x00, 0x00}, 1, 0, "CP H"},
-  {{0xBD, 0x00, 0x00, 0x00}, 1, 0, "CP L"},
-  {{0xBE, 0x00, 0x00, 0x00}, 1, 0, "CP (HL)"},
-  {{0xBF, 0x00, 0x00, 0x00}, 1, 0, "CP A"},
-  {{0xC0, 0x00, 0x00, 0x00}, 1, 0, "RET NZ"},
-  {{0xC1, 0x00, 0x00, 0x00}, 1, 0, "POP BC"},
-  {{0xC2, 0x00, 0x00, 0x00}, 3, 0, "JP NZ,nn"},
-  {{0xC3, 0x00, 0x00, 0x00}, 3, 0, "JP nn"},
-  {{0xC4, 0x00, 0x00, 0x00}, 3, 0, "CALL NZ,nn"},
-  {{0xC5, 0x00, 0x00, 0x00}, 1, 0, "PUSH BC"},
-  {{0xC6, 0x00, 0x00, 0x00}, 2, 0, "ADD A,n"},
-  {{0xC7, 0x00, 0x00, 0x00}, 1, 0, "RST 00H"},
-  {{0xC8, 0x00, 0x00, 0x00}, 1, 0, "RET Z"},
-  {{0xC9, 0x00, 0x00, 0x00}, 1, 0, "RET"},
-  {{0xCA, 0x00, 0x00, 0x00}, 3, 0, "JP Z,nn"},
-  {{0xCB, 0x00, 0x00, 0x00}, 1, 0, "PREFIX CB"},
-  {{0xCC, 0x00, 0x00, 0x00}, 3, 0, "CALL Z,nn"},
-  {{0xCD, 0x00, 0x00, 0x00}, 3, 0, "CALL nn"},
-  {{0xCE, 0x00, 0x00, 0x00}, 2, 0, "ADC A,n"},
-  {{0xCF, 0x00, 0x00, 0x00}, 1, 0, "RST 08H"},
-  {{0xD0, 0x00, 0x00, 0x00}, 1, 0, "RET NC"},
-  {{0xD1, 0x00, 0x00, 0x00}, 1, 0, "POP DE"},
-  {{0xD2, 0x00, 0x00, 0x00}, 3, 0, "JP NC,nn"},
-  {{0xD3, 0x00, 0x00, 0x00}, 2, 0, "OUT (n),A"},
-  {{0xD4, 0x00, 0x00, 0x00}, 3, 0, "CALL NC,nn"},
-  {{0xD5, 0x00, 0x00, 0x00}, 1, 0, "PUSH DE"},
-  {{0xD6, 0x00, 0x00, 0x00}, 2, 0, "SUB n"},
-  {{0xD7, 0x00, 0x00, 0x00}, 1, 0, "RST 10H"},
-  {{0xD8, 0x00, 0x00, 0x00}, 1, 0, "RET C"},
-  {{0xD9, 0x00, 0x00, 0x00}, 1, 0, "EXX"},
-  {{0xDA, 0x00, 0x00, 0x00}, 3, 0, "JP C,nn"},
-  {{0xDB, 0x00, 0x00, 0x00}, 2, 0, "IN A,(n)"},
-  {{0xDC, 0x00, 0x00, 0x00}, 3, 0, "CALL C,nn"},
-  {{0xDD, 0x00, 0x00, 0x00}, 1, 0, "PREFIX DD"},
-  {{0xDE, 0x00, 0x00, 0x00}, 2, 0, "SBC A,n"},
-  {{0xDF, 0x00, 0x00, 0x00}, 1, 0, "RST 18H"},
-  {{0xE0, 0x00, 0x00, 0x00}, 1, 0, "RET PO"},
-  {{0xE1, 0x00, 0x00, 0x00}, 1, 0, "POP HL"},
-  {{0xE2, 0x00, 0x00, 0x00}, 3, 0, "JP PO,nn"},
-  {{0xE3, 0x00, 0x00, 0x00}, 1, 0, "EX (SP),HL"},
-  {{0xE4, 0x00, 0x00, 0x00}, 3, 0, "CALL PO,nn"},
-  {{0xE5, 0x00, 0x00, 0x00}, 1, 0, "PUSH HL"},
-  {{0xE6, 0x00, 0x00, 0x00}, 2, 0, "AND n"},
-  {{0xE7, 0x00, 0x00, 0x00}, 1, 0, "RST 20H"},
-  {{0xE8, 0x00, 0x00, 0x00}, 1, 0, "RET PE"},
-  {{0xE9, 0x00, 0x00, 0x00}, 1, 0, "JP (HL)"},
-  {{0xEA, 0x00, 0x00, 0x00}, 3, 0, "JP PE,nn"},
-  {{0xEB, 0x00, 0x00, 0x00}, 1, 0, "EX DE,HL"},
-  {{0xEC, 0x00, 0x00, 0x00}, 3, 0, "CALL PE,nn"},
-  {{0xED, 0x00, 0x00, 0x00}, 1, 0, "PREFIX ED"},
-  {{0xEE, 0x00, 0x00, 0x00}, 2, 0, "XOR n"},
-  {{0xEF, 0x00, 0x00, 0x00}, 1, 0, "RST 28H"},
-  {{0xF0, 0x00, 0x00, 0x00}, 1, 0, "RET P"},
-  {{0xF1, 0x00, 0x00, 0x00}, 1, 0, "POP AF"},
-  {{0xF2, 0x00, 0x00, 0x00}, 3, 0, "JP P,nn"},
-  {{0xF3, 0x00, 0x00, 0x00}, 1, 0, "DI"},
-  {{0xF4, 0x00, 0x00, 0x00}, 3, 0, "CALL P,nn"},
-  {{0xF5, 0x00, 0x00, 0x00}, 1, 0, "PUSH AF"},
-  {{0xF6, 0x00, 0x00, 0x00}, 2, 0, "OR n"},
-  {{0xF7, 0x00, 0x00, 0x00}, 1, 0, "RST 30H"},
-  {{0xF8, 0x00, 0x00, 0x00}, 1, 0, "RET M"},
-  {{0xF9, 0x00, 0x00, 0x00}, 1, 0, "LD SP,HL"},
-  {{0xFA, 0x00, 0x00, 0x00}, 3, 0, "JP M,nn"},
-  {{0xFB, 0x00, 0x00, 0x00}, 1, 0, "EI"},
-  {{0xFC, 0x00, 0x00, 0x00}, 3, 0, "CALL M,nn"},
-  {{0xFD, 0x00, 0x00, 0x00}, 1, 0, "PREFIX FD"},
-  {{0xFE, 0x00, 0x00, 0x00}, 2, 0, "CP n"},
-  {{0xFF, 0x00, 0x00, 0x00}, 1, 0, "RST 38H"},
-  {{0xCB, 0x00, 0x00, 0x00}, 2, 0, "RLC B"},
-  {{0xCB, 0x01, 0x00, 0x00}, 2, 0, "RLC C"},
-  {{0xCB, 0x02, 0x00, 0x00}, 2, 0, "RLC D"},
-  {{0xCB, 0x03, 0x00, 0x00}, 2, 0, "RLC E"},
-  {{0xCB, 0x04, 0x00, 0x00}, 2, 0, "RLC H"},
-  {{0xCB, 0x05, 0x00, 0x00}, 2, 0, "RLC L"},
-  {{0xCB, 0x06, 0x00, 0x00}, 2, 0, "RLC (HL)"},
-  {{0xCB, 0x07, 0x00, 0x00}, 2, 0, "RLC A"},
-  {{0xCB, 0x08, 0x00, 0x00}, 2, 0, "RRC B"},
-  {{0xCB, 0x09, 0x00, 0x00}, 2, 0, "RRC C"},
-  {{0xCB, 0x0A, 0x00, 0x00}, 2, 0, "RRC D"},
-  {{0xCB, 0x0B, 0x00, 0x00}, 2, 0, "RRC E"},
-  {{0xCB, 0x0C, 0x00, 0x00}, 2, 0, "RRC H"},
-  {{0xCB, 0x0D, 0x00, 0x00}, 2, 0, "RRC L"},
-  {{0xCB, 0x0E, 0x00, 0x00}, 2, 0, "RRC (HL)"},
-  {{0xCB, 0x0F, 0x00, 0x00}, 2, 0, "RRC A"},
-  {{0xCB, 0x10, 0x00, 0x00}, 2, 0, "RL B"},
-  {{0xCB, 0x11, 0x00, 0x00}, 2, 0, "RL C"},
-  {{0xCB, 0x12, 0x00, 0x00}, 2, 0, "RL D"},
-  {{0xCB, 0x13, 0x00, 0x00}, 2, 0, "RL E"},
-  {{0xCB, 0x14, 0x00, 0x00}, 2, 0, "RL H"},
-  {{0xCB, 0x15, 0x00, 0x00}, 2, 0, "RL L"},
-  {{0xCB, 0x16, 0x00, 0x00}, 2, 0, "RL (HL)"},
-  {{0xCB, 0x17, 0x00, 0x00}, 2, 0, "RL A"},
-  {{0xCB, 0x18, 0x00, 0x00}, 2, 0, "RR B"},
-  {{0xCB, 0x19, 0x00, 0x00}, 2, 0, "RR C"},
-  {{0xCB, 0x1A, 0x00, 0x00}, 2, 0, "RR D"},
-  {{0xCB, 0x1B, 0x00, 0x00}, 2, 0, "RR E"},
-  {{0xCB, 0x1C, 0x00, 0x00}, 2, 0, "RR H"},
-  {{0xCB, 0x1D, 0x00, 0x00}, 2, 0, "RR L"},
-  {{0xCB, 0x1E, 0x00, 0x00}, 2, 0, "RR (HL)"},
-  {{0xCB, 0x1F, 0x00, 0x00}, 2, 0, "RR A"},
-  {{0xCB, 0x20, 0x00, 0x00}, 2, 0, "SLA B"},
-  {{0xCB, 0x21, 0x00, 0x00}, 2, 0, "SLA C"},
-  {{0xCB, 0x22, 0x00, 0x00}, 2, 0, "SLA D"},
-  {{0xCB, 0x23, 0x00, 0x00}, 2, 0, "SLA E"},
-  {{0xCB, 0x24, 0x00, 0x00}, 2, 0, "SLA H"},
-  {{0xCB, 0x25, 0x00, 0x00}, 2, 0, "SLA L"},
-  {{0xCB, 0x26, 0x00, 0x00}, 2, 0, "SLA (HL)"},
-  {{0xCB, 0x27, 0x00, 0x00}, 2, 0, "SLA A"},
-  {{0xCB, 0x28, 0x00, 0x00}, 2, 0, "SRA B"},
-  {{0xCB, 0x29, 0x00, 0x00}, 2, 0, "SRA C"},
-  {{0xCB, 0x2A, 0x00, 0x00}, 2, 0, "SRA D"},
-  {{0xCB, 0x2B, 0x00, 0x00}, 2, 0, "SRA E"},
-  {{0xCB, 0x2C, 0x00, 0x00}, 2, 0, "SRA H"},
-  {{0xCB, 0x2D, 0x00, 0x00}, 2, 0, "SRA L"},
-  {{0xCB, 0x2E, 0x00, 0x00}, 2, 0, "SRA (HL)"},
-  {{0xCB, 0x2F, 0x00, 0x00}, 2, 0, "SRA A"},
-  {{0xCB, 0x30, 0x00, 0x00}, 2, 0, "SLL B"},
-  {{0xCB, 0x31, 0x00, 0x00}, 2, 0, "SLL C"},
-  {{0xCB, 0x32, 0x00, 0x00}, 2, 0, "SLL D"},
-  {{0xCB, 0x33, 0x00, 0x00}, 2, 0, "SLL E"},
-  {{0xCB, 0x34, 0x00, 0x00}, 2, 0, "SLL H"},
-  {{0xCB, 0x35, 0x00, 0x00}, 2, 0, "SLL L"},
-  {{0xCB, 0x36, 0x00, 0x00}, 2, 0, "SLL (HL)"},
-  {{0xCB, 0x37, 0x00, 0x00}, 2, 0, "SLL A"},
-  {{0xCB, 0x38, 0x00, 0x00}, 2, 0, "SRL B"},
-  {{0xCB, 0x39, 0x00, 0x00}, 2, 0, "SRL C"},
-  {{0xCB, 0x3A, 0x00, 0x00}, 2, 0, "SRL D"},
-  {{0xCB, 0x3B, 0x00, 0x00}, 2, 0, "SRL E"},
-  {{0xCB, 0x3C, 0x00, 0x00}, 2, 0, "SRL H"},
-  {{0xCB, 0x3D, 0x00, 0x00}, 2, 0, "SRL L"},
-  {{0xCB, 0x3E, 0x00, 0x00}, 2, 0, "SRL (HL)"},
-  {{0xCB, 0x3F, 0x00, 0x00}, 2, 0, "SRL A"},
-  {{0xCB, 0x40, 0x00, 0x00}, 2, 0, "BIT 0,B"},
-  {{0xCB, 0x41, 0x00, 0x00}, 2, 0, "BIT 0,C"},
-  {{0xCB, 0x42, 0x00, 0x00}, 2, 0, "BIT 0,D"},
-  {{0xCB, 0x43, 0x00, 0x00}, 2, 0, "BIT 0,E"},
-  {{0xCB, 0x44, 0x00, 0x00}, 2, 0, "BIT 0,H"},
-  {{0xCB, 0x45, 0x00, 0x00}, 2, 0, "BIT 0,L"},
-  {{0xCB, 0x46, 0x00, 0x00}, 2, 0, "BIT 0,(HL)"},
-  {{0xCB, 0x47, 0x00, 0x00}, 2, 0, "BIT 0,A"},
-  {{0xCB, 0x48, 0x00, 0x00}, 2, 0, "BIT 1,B"},
-  {{0xCB, 0x49, 0x00, 0x00}, 2, 0, "BIT 1,C"},
-  {{0xCB, 0x4A, 0x00, 0x00}, 2, 0, "BIT 1,D"},
-  {{0xCB, 0x4B, 0x00, 0x00}, 2, 0, "BIT 1,E"},
-  {{0xCB, 0x4C, 0x00, 0x00}, 2, 0, "BIT 1,H"},
-  {{0xCB, 0x4D, 0x00, 0x00}, 2, 0, "BIT 1,L"},
-  {{0xCB, 0x4E, 0x00, 0x00}, 2, 0, "BIT 1,(HL)"},
-  {{0xCB, 0x4F, 0x00, 0x00}, 2, 0, "BIT 1,A"},
-  {{0xCB, 0x50, 0x00, 0x00}, 2, 0, "BIT 2,B"},
-  {{0xCB, 0x51, 0x00, 0x00}, 2, 0, "BIT 2,C"},
-  {{0xCB, 0x52, 0x00, 0x00}, 2, 0, "BIT 2,D"},
-  {{0xCB, 0x53, 0x00, 0x00}, 2, 0, "BIT 2,E"},
-  {{0xCB, 0x54, 0x00, 0x00}, 2, 0, "BIT 2,H"},
-  {{0xCB, 0x55, 0x00, 0x00}, 2, 0, "BIT 2,L"},
-  {{0xCB, 0x56, 0x00, 0x00}, 2, 0, "BIT 2,(HL)"},
-  {{0xCB, 0x57, 0x00, 0x00}, 2, 0, "BIT 2,A"},
-  {{0xCB, 0x58, 0x00, 0x00}, 2, 0, "BIT 3,B"},
-  {{0xCB, 0x59, 0x00, 0x00}, 2, 0, "BIT 3,C"},
-  {{0xCB, 0x5A, 0x00, 0x00}, 2, 0, "BIT 3,D"},
-  {{0xCB, 0x5B, 0x00, 0x00}, 2, 0, "BIT 3,E"},
-  {{0xCB, 0x5C, 0x00, 0x00}, 2, 0, "BIT 3,H"},
-  {{0xCB, 0x5D, 0x00, 0x00}, 2, 0, "BIT 3,L"},
-  {{0xCB, 0x5E, 0x00, 0x00}, 2, 0, "BIT 3,(HL)"},
-  {{0xCB, 0x5F, 0x00, 0x00}, 2, 0, "BIT 3,A"},
-  {{0xCB, 0x60, 0x00, 0x00}, 2, 0, "BIT 4,B"},
-  {{0xCB, 0x61, 0x00, 0x00}, 2, 0, "BIT 4,C"},
-  {{0xCB, 0x62, 0x00, 0x00}, 2, 0, "BIT 4,D"},
-  {{0xCB, 0x63, 0x00, 0x00}, 2, 0, "BIT 4,E"},
-  {{0xCB, 0x64, 0x00, 0x00}, 2, 0, "BIT 4,H"},
-  {{0xCB, 0x65, 0x00, 0x00}, 2, 0, "BIT 4,L"},
-  {{0xCB, 0x66, 0x00, 0x00}, 2, 0, "BIT 4,(HL)"},
-  {{0xCB, 0x67, 0x00, 0x00}, 2, 0, "BIT 4,A"},
-  {{0xCB, 0x68, 0x00, 0x00}, 2, 0, "BIT 5,B"},
-  {{0xCB, 0x69, 0x00, 0x00}, 2, 0, "BIT 5,C"},
-  {{0xCB, 0x6A, 0x00, 0x00}, 2, 0, "BIT 5,D"},
-  {{0xCB, 0x6B, 0x00, 0x00}, 2, 0, "BIT 5,E"},
-  {{0xCB, 0x6C, 0x00, 0x00}, 2, 0, "BIT 5,H"},
-  {{0xCB, 0x6D, 0x00, 0x00}, 2, 0, "BIT 5,L"},
-  {{0xCB, 0x6E, 0x00, 0x00}, 2, 0, "BIT 5,(HL)"},
-  {{0xCB, 0x6F, 0x00, 0x00}, 2, 0, "BIT 5,A"},
-  {{0xCB, 0x70, 0x00, 0x00}, 2, 0, "BIT 6,B"},
-  {{0xCB, 0x71, 0x00, 0x00}, 2, 0, "BIT 6,C"},
-  {{0xCB, 0x72, 0x00, 0x00}, 2, 0, "BIT 6,D"},
-  {{0xCB, 0x73, 0x00, 0x00}, 2, 0, "BIT 6,E"},
-  {{0xCB, 0x74, 0x00, 0x00}, 2, 0, "BIT 6,H"},
-  {{0xCB, 0x75, 0x00, 0x00}, 2, 0, "BIT 6,L"},
-  {{0xCB, 0x76, 0x00, 0x00}, 2, 0, "BIT 6,(HL)"},
-  {{0xCB, 0x77, 0x00, 0x00}, 2, 0, "BIT 6,A"},
-  {{0xCB, 0x78, 0x00, 0x00}, 2, 0, "BIT 7,B"},
-  {{0xCB, 0x79, 0x00, 0x00}, 2, 0, "BIT 7,C"},
-  {{0xCB, 0x7A, 0x00, 0x00}, 2, 0, "BIT 7,D"},
-  {{0xCB, 0x7B, 0x00, 0x00}, 2, 0, "BIT 7,E"},
-  {{0xCB, 0x7C, 0x00, 0x00}, 2, 0, "BIT 7,H"},
-  {{0xCB, 0x7D, 0x00, 0x00}, 2, 0, "BIT 7,L"},
-  {{0xCB, 0x7E, 0x00, 0x00}, 2, 0, "BIT 7,(HL)"},
-  {{0xCB, 0x7F, 0x00, 0x00}, 2, 0, "BIT 7,A"},
-  {{0xCB, 0x80, 0x00, 0x00}, 2, 0, "RES 0,B"},
-  {{0xCB, 0x81, 0x00, 0x00}, 2, 0, "RES 0,C"},
-  {{0xCB, 0x82, 0x00, 0x00}, 2, 0, "RES 0,D"},
-  {{0xCB, 0x83, 0x00, 0x00}, 2, 0, "RES 0,E"},
-  {{0xCB, 0x84, 0x00, 0x00}, 2, 0, "RES 0,H"},
-  {{0xCB, 0x85, 0x00, 0x00}, 2, 0, "RES 0,L"},
-  {{0xCB, 0x86, 0x00, 0x00}, 2, 0, "RES 0,(HL)"},
-  {{0xCB, 0x87, 0x00, 0x00}, 2, 0, "RES 0,A"},
-  {{0xCB, 0x88, 0x00, 0x00}, 2, 0, "RES 1,B"},
-  {{0xCB, 0x89, 0x00, 0x00}, 2, 0, "RES 1,C"},
-  {{0xCB, 0x8A, 0x00, 0x00}, 2, 0, "RES 1,D"},
-  {{0xCB, 0x8B, 0x00, 0x00}, 2, 0, "RES 1,E"},
-  {{0xCB, 0x8C, 0x00, 0x00}, 2, 0, "RES 1,H"},
-  {{0xCB, 0x8D, 0x00, 0x00}, 2, 0, "RES 1,L"},
-  {{0xCB, 0x8E, 0x00, 0x00}, 2, 0, "RES 1,(HL)"},
-  {{0xCB, 0x8F, 0x00, 0x00}, 2, 0, "RES 1,A"},
-  {{0xCB, 0x90, 0x00, 0x00}, 2, 0, "RES 2,B"},
-  {{0xCB, 0x91, 0x00, 0x00}, 2, 0, "RES 2,C"},
-  {{0xCB, 0x92, 0x00, 0x00}, 2, 0, "RES 2,D"},
-  {{0xCB, 0x93, 0x00, 0x00}, 2, 0, "RES 2,E"},
-  {{0xCB, 0x94, 0x00, 0x00}, 2, 0, "RES 2,H"},
-  {{0xCB, 0x95, 0x00, 0x00}, 2, 0, "RES 2,L"},
-  {{0xCB, 0x96, 0x00, 0x00}, 2, 0, "RES 2,(HL)"},
-  {{0xCB, 0x97, 0x00, 0x00}, 2, 0, "RES 2,A"},
-  {{0xCB, 0x98, 0x00, 0x00}, 2, 0, "RES 3,B"},
-  {{0xCB, 0x99, 0x00, 0x00}, 2, 0, "RES 3,C"},
-  {{0xCB, 0x9A, 0x00, 0x00}, 2, 0, "RES 3,D"},
-  {{0xCB, 0x9B, 0x00, 0x00}, 2, 0, "RES 3,E"},
-  {{0xCB, 0x9C, 0x00, 0x00}, 2, 0, "RES 3,H"},
-  {{0xCB, 0x9D, 0x00, 0x00}, 2, 0, "RES 3,L"},
-  {{0xCB, 0x9E, 0x00, 0x00}, 2, 0, "RES 3,(HL)"},
-  {{0xCB, 0x9F, 0x00, 0x00}, 2, 0, "RES 3,A"},
-  {{0xCB, 0xA0, 0x00, 0x00}, 2, 0, "RES 4,B"},
-  {{0xCB, 0xA1, 0x00, 0x00}, 2, 0, "RES 4,C"},
-  {{0xCB, 0xA2, 0x00, 0x00}, 2, 0, "RES 4,D"},
-  {{0xCB, 0xA3, 0x00, 0x00}, 2, 0, "RES 4,E"},
-  {{0xCB, 0xA4, 0x00, 0x00}, 2, 0, "RES 4,H"},
-  {{0xCB, 0xA5, 0x00, 0x00}, 2, 0, "RES 4,L"},
-  {{0xCB, 0xA6, 0x00, 0x00}, 2, 0, "RES 4,(HL)"},
-  {{0xCB, 0xA7, 0x00, 0x00}, 2, 0, "RES 4,A"},
-  {{0xCB, 0xA8, 0x00, 0x00}, 2, 0, "RES 5,B"},
-  {{0xCB, 0xA9, 0x00, 0x00}, 2, 0, "RES 5,C"},
-  {{0xCB, 0xAA, 0x00, 0x00}, 2, 0, "RES 5,D"},
-  {{0xCB, 0xAB, 0x00, 0x00}, 2, 0, "RES 5,E"},
-  {{0xCB, 0xAC, 0x00, 0x00}, 2, 0, "RES 5,H"},
-  {{0xCB, 0xAD, 0x00, 0x00}, 2, 0, "RES 5,L"},
-  {{0xCB, 0xAE, 0x00, 0x00}, 2, 0, "RES 5,(HL)"},
-  {{0xCB, 0xAF, 0x00, 0x00}, 2, 0, "RES 5,A"},
-  {{0xCB, 0xB0, 0x00, 0x00}, 2, 0, "RES 6,B"},
-  {{0xCB, 0xB1, 0x00, 0x00}, 2, 0, "RES 6,C"},
-  {{0xCB, 0xB2, 0x00, 0x00}, 2, 0, "RES 6,D"},
-  {{0xCB, 0xB3, 0x00, 0x00}, 2, 0, "RES 6,E"},
-  {{0xCB, 0xB4, 0x00, 0x00}, 2, 0, "RES 6,H"},
-  {{0xCB, 0xB5, 0x00, 0x00}, 2, 0, "RES 6,L"},
-  {{0xCB, 0xB6, 0x00, 0x00}, 2, 0, "RES 6,(HL)"},
-  {{0xCB, 0xB7, 0x00, 0x00}, 2, 0, "RES 6,A"},
-  {{0xCB, 0xB8, 0x00, 0x00}, 2, 0, "RES 7,B"},
-  {{0xCB, 0xB9, 0x00, 0x00}, 2, 0, "RES 7,C"},
-  {{0xCB, 0xBA, 0x00, 0x00}, 2, 0, "RES 7,D"},
-  {{0xCB, 0xBB, 0x00, 0x00}, 2, 0, "RES 7,E"},
-  {{0xCB, 0xBC, 0x00, 0x00}, 2, 0, "RES 7,H"},
-  {{0xCB, 0xBD, 0x00, 0x00}, 2, 0, "RES 7,L"},
-  {{0xCB, 0xBE, 0x00, 0x00}, 2, 0, "RES 7,(HL)"},
-  {{0xCB, 0xBF, 0x00, 0x00}, 2, 0, "RES 7,A"},
-  {{0xCB, 0xC0, 0x00, 0x00}, 2, 0, "SET 0,B"},
-  {{0xCB, 0xC1, 0x00, 0x00}, 2, 0, "SET 0,C"},
-  {{0xCB, 0xC2, 0x00, 0x00}, 2, 0, "SET 0,D"},
-  {{0xCB, 0xC3, 0x00, 0x00}, 2, 0, "SET 0,E"},
-  {{0xCB, 0xC4, 0x00, 0x00}, 2, 0, "SET 0,H"},
-  {{0xCB, 0xC5, 0x00, 0x00}, 2, 0, "SET 0,L"},
-  {{0xCB, 0xC6, 0x00, 0x00}, 2, 0, "SET 0,(HL)"},
-  {{0xCB, 0xC7, 0x00, 0x00}, 2, 0, "SET 0,A"},
-  {{0xCB, 0xC8, 0x00, 0x00}, 2, 0, "SET 1,B"},
-  {{0xCB, 0xC9, 0x00, 0x00}, 2, 0, "SET 1,C"},
-  {{0xCB, 0xCA, 0x00, 0x00}, 2, 0, "SET 1,D"},
-  {{0xCB, 0xCB, 0x00, 0x00}, 2, 0, "SET 1,E"},
-  {{0xCB, 0xCC, 0x00, 0x00}, 2, 0, "SET 1,H"},
-  {{0xCB, 0xCD, 0x00, 0x00}, 2, 0, "SET 1,L"},
-  {{0xCB, 0xCE, 0x00, 0x00}, 2, 0, "SET 1,(HL)"},
-  {{0xCB, 0xCF, 0x00, 0x00}, 2, 0, "SET 1,A"},
-  {{0xCB, 0xD0, 0x00, 0x00}, 2, 0, "SET 2,B"},
-  {{0xCB, 0xD1, 0x00, 0x00}, 2, 0, "SET 2,C"},
-  {{0xCB, 0xD2, 0x00, 0x00}, 2, 0, "SET 2,D"},
-  {{0xCB, 0xD3, 0x00, 0x00}, 2, 0, "SET 2,E"},
-  {{0xCB, 0xD4, 0x00, 0x00}, 2, 0, "SET 2,H"},
-  {{0xCB, 0xD5, 0x00, 0x00}, 2, 0, "SET 2,L"},
-  {{0xCB, 0xD6, 0x00, 0x00}, 2, 0, "SET 2,(HL)"},
-  {{0xCB, 0xD7, 0x00, 0x00}, 2, 0, "SET 2,A"},
-  {{0xCB, 0xD8, 0x00, 0x00}, 2, 0, "SET 3,B"},
-  {{0xCB, 0xD9, 0x00, 0x00}, 2, 0, "SET 3,C"},
-  {{0xCB, 0xDA, 0x00, 0x00}, 2, 0, "SET 3,D"},
-  {{0xCB, 0xDB, 0x00, 0x00}, 2, 0, "SET 3,E"},
-  {{0xCB, 0xDC, 0x00, 0x00}, 2, 0, "SET 3,H"},
-  {{0xCB, 0xDD, 0x00, 0x00}, 2, 0, "SET 3,L"},
-  {{0xCB, 0xDE, 0x00, 0x00}, 2, 0, "SET 3,(HL)"},
-  {{0xCB, 0xDF, 0x00, 0x00}, 2, 0, "SET 3,A"},
-  {{0xCB, 0xE0, 0x00, 0x00}, 2, 0, "SET 4,B"},
-  {{0xCB, 0xE1, 0x00, 0x00}, 2, 0, "SET 4,C"},
-  {{0xCB, 0xE2, 0x00, 0x00}, 2, 0, "SET 4,D"},
-  {{0xCB, 0xE3, 0x00, 0x00}, 2, 0, "SET 4,E"},
-  {{0xCB, 0xE4, 0x00, 0x00}, 2, 0, "SET 4,H"},
-  {{0xCB, 0xE5, 0x00, 0x00}, 2, 0, "SET 4,L"},
-  {{0xCB, 0xE6, 0x00, 0x00}, 2, 0, "SET 4,(HL)"},
-  {{0xCB, 0xE7, 0x00, 0x00}, 2, 0, "SET 4,A"},
-  {{0xCB, 0xE8, 0x00, 0x00}, 2, 0, "SET 5,B"},
-  {{0xCB, 0xE9, 0x00, 0x00}, 2, 0, "SET 5,C"},
-  {{0xCB, 0xEA, 0x00, 0x00}, 2, 0, "SET 5,D"},
-  {{0xCB, 0xEB, 0x00, 0x00}, 2, 0, "SET 5,E"},
-  {{0xCB, 0xEC, 0x00, 0x00}, 2, 0, "SET 5,H"},
-  {{0xCB, 0xED, 0x00, 0x00}, 2, 0, "SET 5,L"},
-  {{0xCB, 0xEE, 0x00, 0x00}, 2, 0, "SET 5,(HL)"},
-  {{0xCB, 0xEF, 0x00, 0x00}, 2, 0, "SET 5,A"},
-  {{0xCB, 0xF0, 0x00, 0x00}, 2, 0, "SET 6,B"},
-  {{0xCB, 0xF1, 0x00, 0x00}, 2, 0, "SET 6,C"},
-  {{0xCB, 0xF2, 0x00, 0x00}, 2, 0, "SET 6,D"},
-  {{0xCB, 0xF3, 0x00, 0x00}, 2, 0, "SET 6,E"},
-  {{0xCB, 0xF4, 0x00, 0x00}, 2, 0, "SET 6,H"},
-  {{0xCB, 0xF5, 0x00, 0x00}, 2, 0, "SET 6,L"},
-  {{0xCB, 0xF6, 0x00, 0x00}, 2, 0, "SET 6,(HL)"},
-  {{0xCB, 0xF7, 0x00, 0x00}, 2, 0, "SET 6,A"},
-  {{0xCB, 0xF8, 0x00, 0x00}, 2, 0, "SET 7,B"},
-  {{0xCB, 0xF9, 0x00, 0x00}, 2, 0, "SET 7,C"},
-  {{0xCB, 0xFA, 0x00, 0x00}, 2, 0, "SET 7,D"},
-  {{0xCB, 0xFB, 0x00, 0x00}, 2, 0, "SET 7,E"},
-  {{0xCB, 0xFC, 0x00, 0x00}, 2, 0, "SET 7,H"},
-  {{0xCB, 0xFD, 0x00, 0x00}, 2, 0, "SET 7,L"},
-  {{0xCB, 0xFE, 0x00, 0x00}, 2, 0, "SET 7,(HL)"},
-  {{0xCB, 0xFF, 0x00, 0x00}, 2, 0, "SET 7,A"},
-  {{0xED, 0x00, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x01, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x02, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x03, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x04, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x05, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x06, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x07, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x08, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x09, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x0A, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x0B, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x0C, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x0D, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x0E, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x0F, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x10, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x11, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x12, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x13, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x14, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x15, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x16, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x17, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x18, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x19, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x1A, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x1B, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x1C, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x1D, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x1E, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x1F, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x20, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x21, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x22, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x23, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x24, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x25, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x26, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x27, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x28, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x29, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x2A, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x2B, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x2C, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x2D, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x2E, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x2F, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x30, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x31, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x32, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x33, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x34, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x35, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x36, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x37, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x38, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x39, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x3A, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x3B, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x3C, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x3D, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x3E, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x3F, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x40, 0x00, 0x00}, 2, 0, "IN B,(C)"},
-  {{0xED, 0x41, 0x00, 0x00}, 2, 0, "OUT (C),B"},
-  {{0xED, 0x42, 0x00, 0x00}, 2, 0, "SBC HL,BC"},
-  {{0xED, 0x43, 0x00, 0x00}, 4, 0, "LD (nn),BC"},
-  {{0xED, 0x44, 0x00, 0x00}, 2, 0, "NEG"},
-  {{0xED, 0x45, 0x00, 0x00}, 2, 0, "RETN"},
-  {{0xED, 0x46, 0x00, 0x00}, 2, 0, "IM 0"},
-  {{0xED, 0x47, 0x00, 0x00}, 2, 0, "LD I,A"},
-  {{0xED, 0x48, 0x00, 0x00}, 2, 0, "IN C,(C)"},
-  {{0xED, 0x49, 0x00, 0x00}, 2, 0, "OUT (C),C"},
-  {{0xED, 0x4A, 0x00, 0x00}, 2, 0, "ADC HL,BC"},
-  {{0xED, 0x4B, 0x00, 0x00}, 4, 0, "LD BC,(nn)"},
-  {{0xED, 0x4C, 0x00, 0x00}, 2, 0, "NEG"},
-  {{0xED, 0x4D, 0x00, 0x00}, 2, 0, "RETI"},
-  {{0xED, 0x4E, 0x00, 0x00}, 2, 0, "IM 0"},
-  {{0xED, 0x4F, 0x00, 0x00}, 2, 0, "LD R,A"},
-  {{0xED, 0x50, 0x00, 0x00}, 2, 0, "IN D,(C)"},
-  {{0xED, 0x51, 0x00, 0x00}, 2, 0, "OUT (C),D"},
-  {{0xED, 0x52, 0x00, 0x00}, 2, 0, "SBC HL,DE"},
-  {{0xED, 0x53, 0x00, 0x00}, 4, 0, "LD (nn),DE"},
-  {{0xED, 0x54, 0x00, 0x00}, 2, 0, "NEG"},
-  {{0xED, 0x55, 0x00, 0x00}, 2, 0, "RETN"},
-  {{0xED, 0x56, 0x00, 0x00}, 2, 0, "IM 1"},
-  {{0xED, 0x57, 0x00, 0x00}, 2, 0, "LD A,I"},
-  {{0xED, 0x58, 0x00, 0x00}, 2, 0, "IN E,(C)"},
-  {{0xED, 0x59, 0x00, 0x00}, 2, 0, "OUT (C),E"},
-  {{0xED, 0x5A, 0x00, 0x00}, 2, 0, "ADC HL,DE"},
-  {{0xED, 0x5B, 0x00, 0x00}, 4, 0, "LD DE,(nn)"},
-  {{0xED, 0x5C, 0x00, 0x00}, 2, 0, "NEG"},
-  {{0xED, 0x5D, 0x00, 0x00}, 2, 0, "RETI"},
-  {{0xED, 0x5E, 0x00, 0x00}, 2, 0, "IM 2"},
-  {{0xED, 0x5F, 0x00, 0x00}, 2, 0, "LD A,R"},
-  {{0xED, 0x60, 0x00, 0x00}, 2, 0, "IN H,(C)"},
-  {{0xED, 0x61, 0x00, 0x00}, 2, 0, "OUT (C),H"},
-  {{0xED, 0x62, 0x00, 0x00}, 2, 0, "SBC HL,HL"},
-  {{0xED, 0x63, 0x00, 0x00}, 4, 0, "LD (nn),HL"},
-  {{0xED, 0x64, 0x00, 0x00}, 2, 0, "NEG"},
-  {{0xED, 0x65, 0x00, 0x00}, 2, 0, "RETN"},
-  {{0xED, 0x66, 0x00, 0x00}, 2, 0, "IM 0"},
-  {{0xED, 0x67, 0x00, 0x00}, 2, 0, "RRD"},
-  {{0xED, 0x68, 0x00, 0x00}, 2, 0, "IN L,(C)"},
-  {{0xED, 0x69, 0x00, 0x00}, 2, 0, "OUT (C),L"},
-  {{0xED, 0x6A, 0x00, 0x00}, 2, 0, "ADC HL,HL"},
-  {{0xED, 0x6B, 0x00, 0x00}, 4, 0, "LD HL,(nn)"},
-  {{0xED, 0x6C, 0x00, 0x00}, 2, 0, "NEG"},
-  {{0xED, 0x6D, 0x00, 0x00}, 2, 0, "RETI"},
-  {{0xED, 0x6E, 0x00, 0x00}, 2, 0, "IM 0"},
-  {{0xED, 0x6F, 0x00, 0x00}, 2, 0, "RLD"},
-  {{0xED, 0x70, 0x00, 0x00}, 2, 0, "IN (C)"},
-  {{0xED, 0x71, 0x00, 0x00}, 2, 0, "OUT (C),0"},
-  {{0xED, 0x72, 0x00, 0x00}, 2, 0, "SBC HL,SP"},
-  {{0xED, 0x73, 0x00, 0x00}, 4, 0, "LD (nn),SP"},
-  {{0xED, 0x74, 0x00, 0x00}, 2, 0, "NEG"},
-  {{0xED, 0x75, 0x00, 0x00}, 2, 0, "RETN"},
-  {{0xED, 0x76, 0x00, 0x00}, 2, 0, "IM 1"},
-  {{0xED, 0x77, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x78, 0x00, 0x00}, 2, 0, "IN A,(C)"},
-  {{0xED, 0x79, 0x00, 0x00}, 2, 0, "OUT (C),A"},
-  {{0xED, 0x7A, 0x00, 0x00}, 2, 0, "ADC HL,SP"},
-  {{0xED, 0x7B, 0x00, 0x00}, 4, 0, "LD SP,(nn)"},
-  {{0xED, 0x7C, 0x00, 0x00}, 2, 0, "NEG"},
-  {{0xED, 0x7D, 0x00, 0x00}, 2, 0, "RETI"},
-  {{0xED, 0x7E, 0x00, 0x00}, 2, 0, "IM 2"},
-  {{0xED, 0x7F, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x80, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x81, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x82, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x83, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x84, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x85, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x86, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x87, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x88, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x89, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x8A, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x8B, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x8C, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x8D, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x8E, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x8F, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x90, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x91, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x92, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x93, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x94, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x95, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x96, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x97, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x98, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x99, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x9A, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x9B, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x9C, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x9D, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x9E, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0x9F, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xA0, 0x00, 0x00}, 2, 0, "LDI"},
-  {{0xED, 0xA1, 0x00, 0x00}, 2, 0, "CPI"},
-  {{0xED, 0xA2, 0x00, 0x00}, 2, 0, "INI"},
-  {{0xED, 0xA3, 0x00, 0x00}, 2, 0, "OUTI"},
-  {{0xED, 0xA4, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xA5, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xA6, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xA7, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xA8, 0x00, 0x00}, 2, 0, "LDD"},
-  {{0xED, 0xA9, 0x00, 0x00}, 2, 0, "CPD"},
-  {{0xED, 0xAA, 0x00, 0x00}, 2, 0, "IND"},
-  {{0xED, 0xAB, 0x00, 0x00}, 2, 0, "OUTD"},
-  {{0xED, 0xAC, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xAD, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xAE, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xAF, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xB0, 0x00, 0x00}, 2, 0, "LDIR"},
-  {{0xED, 0xB1, 0x00, 0x00}, 2, 0, "CPIR"},
-  {{0xED, 0xB2, 0x00, 0x00}, 2, 0, "INIR"},
-  {{0xED, 0xB3, 0x00, 0x00}, 2, 0, "OTIR"},
-  {{0xED, 0xB4, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xB5, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xB6, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xB7, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xB8, 0x00, 0x00}, 2, 0, "LDDR"},
-  {{0xED, 0xB9, 0x00, 0x00}, 2, 0, "CPDR"},
-  {{0xED, 0xBA, 0x00, 0x00}, 2, 0, "INDR"},
-  {{0xED, 0xBB, 0x00, 0x00}, 2, 0, "OTDR"},
-  {{0xED, 0xBC, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xBD, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xBE, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xBF, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xC0, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xC1, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xC2, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xC3, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xC4, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xC5, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xC6, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xC7, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xC8, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xC9, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xCA, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xCB, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xCC, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xCD, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xCE, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xCF, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xD0, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xD1, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xD2, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xD3, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xD4, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xD5, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xD6, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xD7, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xD8, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xD9, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xDA, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xDB, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xDC, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xDD, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xDE, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xDF, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xE0, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xE1, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xE2, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xE3, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xE4, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xE5, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xE6, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xE7, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xE8, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xE9, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xEA, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xEB, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xEC, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xED, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xEE, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xEF, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xF0, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xF1, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xF2, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xF3, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xF4, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xF5, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xF6, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xF7, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xF8, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xF9, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xFA, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xFB, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xFC, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xFD, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xFE, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xED, 0xFF, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xDD, 0x00, 0x00, 0x00}, 2, 0, "NOP"},
-  {{0xDD, 0x01, 0x00, 0x00}, 4, 0, "LD BC,nn"},
-  {{0xDD, 0x02, 0x00, 0x00}, 2, 0, "LD (BC),A"},
-  {{0xDD, 0x03, 0x00, 0x00}, 2, 0, "INC BC"},
-  {{0xDD, 0x04, 0x00, 0x00}, 2, 0, "INC B"},
-  {{0xDD, 0x05, 0x00, 0x00}, 2, 0, "DEC B"},
-  {{0xDD, 0x06, 0x00, 0x00}, 3, 0, "LD B,n"},
-  {{0xDD, 0x07, 0x00, 0x00}, 2, 0, "RLCA"},
-  {{0xDD, 0x08, 0x00, 0x00}, 2, 0, "EX AF,AF'"},
-  {{0xDD, 0x09, 0x00, 0x00}, 2, 0, "ADD IX,BC"},
-  {{0xDD, 0x0A, 0x00, 0x00}, 2, 0, "LD A,(BC)"},
-  {{0xDD, 0x0B, 0x00, 0x00}, 2, 0, "DEC BC"},
-  {{0xDD, 0x0C, 0x00, 0x00}, 2, 0, "INC C"},
-  {{0xDD, 0x0D, 0x00, 0x00}, 2, 0, "DEC C"},
-  {{0xDD, 0x0E, 0x00, 0x00}, 3, 0, "LD C,n"},
-  {{0xDD, 0x0F, 0x00, 0x00}, 2, 0, "RRCA"},
-  {{0xDD, 0x10, 0x00, 0x00}, 3, 0, "DJNZ d"},
-  {{0xDD, 0x11, 0x00, 0x00}, 4, 0, "LD DE,nn"},
-  {{0xDD, 0x12, 0x00, 0x00}, 2, 0, "LD (DE),A"},
-  {{0xDD, 0x13, 0x00, 0x00}, 2, 0, "INC DE"},
-  {{0xDD, 0x14, 0x00, 0x00}, 2, 0, "INC D"},
-  {{0xDD, 0x15, 0x00, 0x00}, 2, 0, "DEC D"},
-  {{0xDD, 0x16, 0x00, 0x00}, 3, 0, "LD D,n"},
-  {{0xDD, 0x17, 0x00, 0x00}, 2, 0, "RLA"},
-  {{0xDD, 0x18, 0x00, 0x00}, 3, 0, "JR d"},
-  {{0xDD, 0x19, 0x00, 0x00}, 2, 0, "ADD IX,DE"},
-  {{0xDD, 0x1A, 0x00, 0x00}, 2, 0, "LD A,(DE)"},
-  {{0xDD, 0x1B, 0x00, 0x00}, 2, 0, "DEC DE"},
-  {{0xDD, 0x1C, 0x00, 0x00}, 2, 0, "INC E"},
-  {{0xDD, 0x1D, 0x00, 0x00}, 2, 0, "DEC E"},
-  {{0xDD, 0x1E, 0x00, 0x00}, 3, 0, "LD E,n"},
-  {{0xDD, 0x1F, 0x00, 0x00}, 2, 0, "RRA"},
-  {{0xDD, 0x20, 0x00, 0x00}, 3, 0, "JR NZ,d"},
-  {{0xDD, 0x21, 0x00, 0x00}, 4, 0, "LD IX,nn"},
-  {{0xDD, 0x22, 0x00, 0x00}, 4, 0, "LD (nn),IX"},
-  {{0xDD, 0x23, 0x00, 0x00}, 2, 0, "INC IX"},
-  {{0xDD, 0x24, 0x00, 0x00}, 2, 0, "INC H"},
-  {{0xDD, 0x25, 0x00, 0x00}, 2, 0, "DEC H"},
-  {{0xDD, 0x26, 0x00, 0x00}, 3, 0, "LD H,n"},
-  {{0xDD, 0x27, 0x00, 0x00}, 2, 0, "DAA"},
-  {{0xDD, 0x28, 0x00, 0x00}, 3, 0, "JR Z,d"},
-  {{0xDD, 0x29, 0x00, 0x00}, 2, 0, "ADD IX,IX"},
-  {{0xDD, 0x2A, 0x00, 0x00}, 4, 0, "LD IX,(nn)"},
-  {{0xDD, 0x2B, 0x00, 0x00}, 2, 0, "DEC IX"},
-  {{0xDD, 0x2C, 0x00, 0x00}, 2, 0, "INC L"},
-  {{0xDD, 0x2D, 0x00, 0x00}, 2, 0, "DEC L"},
-  {{0xDD, 0x2E, 0x00, 0x00}, 3, 0, "LD L,n"},
-  {{0xDD, 0x2F, 0x00, 0x00}, 2, 0, "CPL"},
-  {{0xDD, 0x30, 0x00, 0x00}, 3, 0, "JR NC,d"},
-  {{0xDD, 0x31, 0x00, 0x00}, 4, 0, "LD SP,nn"},
-  {{0xDD, 0x32, 0x00, 0x00}, 4, 0, "LD (nn),A"},
-  {{0xDD, 0x33, 0x00, 0x00}, 2, 0, "INC SP"},
-  {{0xDD, 0x34, 0x00, 0x00}, 3, 0, "INC (IX)"},
-  {{0xDD, 0x35, 0x00, 0x00}, 3, 0, "DEC (IX)"},
-  {{0xDD, 0x36, 0x00, 0x00}, 4, 0, "LD (IX),n"},
-  {{0xDD, 0x37, 0x00, 0x00}, 2, 0, "SCF"},
-  {{0xDD, 0x38, 0x00, 0x00}, 3, 0, "JR C,d"},
-  {{0xDD, 0x39, 0x00, 0x00}, 2, 0, "ADD IX,SP"},
-  {{0xDD, 0x3A, 0x00, 0x00}, 4, 0, "LD A,(nn)"},
-  {{0xDD, 0x3B, 0x00, 0x00}, 2, 0, "DEC SP"},
-  {{0xDD, 0x3C, 0x00, 0x00}, 2, 0, "INC A"},
-  {{0xDD, 0x3D, 0x00, 0x00}, 2, 0, "DEC A"},
-  {{0xDD, 0x3E, 0x00, 0x00}, 3, 0, "LD A,n"},
-  {{0xDD, 0x3F, 0x00, 0x00}, 2, 0, "CCF"},
-  {{0xDD, 0x40, 0x00, 0x00}, 2, 0, "LD B,B"},
-  {{0xDD, 0x41, 0x00, 0x00}, 2, 0, "LD B,C"},
-  {{0xDD, 0x42, 0x00, 0x00}, 2, 0, "LD B,D"},
-  {{0xDD, 0x43, 0x00, 0x00}, 2, 0, "LD B,E"},
-  {{0xDD, 0x44, 0x00, 0x00}, 2, 0, "LD B,H"},
-  {{0xDD, 0x45, 0x00, 0x00}, 2, 0, "LD B,L"},
-  {{0xDD, 0x46, 0x00, 0x00}, 3, 0, "LD B,(IX)"},
-  {{0xDD, 0x47, 0x00, 0x00}, 2, 0, "LD B,A"},
-  {{0xDD, 0x48, 0x00, 0x00}, 2, 0, "LD C,B"},
-  {{0xDD, 0x49, 0x00, 0x00}, 2, 0, "LD C,C"},
-  {{0xDD, 0x4A, 0x00, 0x00}, 2, 0, "LD C,D"},
-  {{0xDD, 0x4B, 0x00, 0x00}, 2, 0, "LD C,E"},
-  {{0xDD, 0x4C, 0x00, 0x00}, 2, 0, "LD C,H"},
-  {{0xDD, 0x4D, 0x00, 0x00}, 2, 0, "LD C,L"},
-  {{0xDD, 0x4E, 0x00, 0x00}, 3, 0, "LD C,(IX)"},
-  {{0xDD, 0x4F, 0x00, 0x00}, 2, 0, "LD C,A"},
-  {{0xDD, 0x50, 0x00, 0x00}, 2, 0, "LD D,B"},
-  {{0xDD, 0x51, 0x00, 0x00}, 2, 0, "LD D,C"},
-  {{0xDD, 0x52, 0x00, 0x00}, 2, 0, "LD D,D"},
-  {{0xDD, 0x53, 0x00, 0x00}, 2, 0, "LD D,E"},
-  {{0xDD, 0x54, 0x00, 0x00}, 2, 0, "LD D,H"},
-  {{0xDD, 0x55, 0x00, 0x00}, 2, 0, "LD D,L"},
-  {{0xDD, 0x56, 0x00, 0x00}, 3, 0, "LD D,(IX)"},
-  {{0xDD, 0x57, 0x00, 0x00}, 2, 0, "LD D,A"},
-  {{0xDD, 0x58, 0x00, 0x00}, 2, 0, "LD E,B"},
-  {{0xDD, 0x59, 0x00, 0x00}, 2, 0, "LD E,C"},
-  {{0xDD, 0x5A, 0x00, 0x00}, 2, 0, "LD E,D"},
-  {{0xDD, 0x5B, 0x00, 0x00}, 2, 0, "LD E,E"},
-  {{0xDD, 0x5C, 0x00, 0x00}, 2, 0, "LD E,H"},
-  {{0xDD, 0x5D, 0x00, 0x00}, 2, 0, "LD E,L"},
-  {{0xDD, 0x5E, 0x00, 0x00}, 3, 0, "LD E,(IX)"},
-  {{0xDD, 0x5F, 0x00, 0x00}, 2, 0, "LD E,A"},
-  {{0xDD, 0x60, 0x00, 0x00}, 2, 0, "LD H,B"},
-  {{0xDD, 0x61, 0x00, 0x00}, 2, 0, "LD H,C"},
-  {{0xDD, 0x62, 0x00, 0x00}, 2, 0, "LD H,D"},
-  {{0xDD, 0x63, 0x00, 0x00}, 2, 0, "LD H,E"},
-  {{0xDD, 0x64, 0x00, 0x00}, 2, 0, "LD H,H"},
-  {{0xDD, 0x65, 0x00, 0x00}, 2, 0, "LD H,L"},
-  {{0xDD, 0x66, 0x00, 0x00}, 3, 0, "LD H,(IX)"},
-  {{0xDD, 0x67, 0x00, 0x00}, 2, 0, "LD H,A"},
-  {{0xDD, 0x68, 0x00, 0x00}, 2, 0, "LD L,B"},
-  {{0xDD, 0x69, 0x00, 0x00}, 2, 0, "LD L,C"},
-  {{0xDD, 0x6A, 0x00, 0x00}, 2, 0, "LD L,D"},
-  {{0xDD, 0x6B, 0x00, 0x00}, 2, 0, "LD L,E"},
-  {{0xDD, 0x6C, 0x00, 0x00}, 2, 0, "LD L,H"},
-  {{0xDD, 0x6D, 0x00, 0x00}, 2, 0, "LD L,L"},
-  {{0xDD, 0x6E, 0x00, 0x00}, 3, 0, "LD L,(IX)"},
-  {{0xDD, 0x6F, 0x00, 0x00}, 2, 0, "LD L,A"},
-  {{0xDD, 0x70, 0x00, 0x00}, 3, 0, "LD (IX),B"},
-  {{0xDD, 0x71, 0x00, 0x00}, 3, 0, "LD (IX),C"},
-  {{0xDD, 0x72, 0x00, 0x00}, 3, 0, "LD (IX),D"},
-  {{0xDD, 0x73, 0x00, 0x00}, 3, 0, "LD (IX),E"},
-  {{0xDD, 0x74, 0x00, 0x00}, 3, 0, "LD (IX),H"},
-  {{0xDD, 0x75, 0x00, 0x00}, 3, 0, "LD (IX),L"},
-  {{0xDD, 0x76, 0x00, 0x00}, 2, 0, "HALT"},
-  {{0xDD, 0x77, 0x00, 0x00}, 3, 0, "LD (IX),A"},
-  {{0xDD, 0x78, 0x00, 0x00}, 2, 0, "LD A,B"},
-  {{0xDD, 0x79, 0x00, 0x00}, 2, 0, "LD A,C"},
-  {{0xDD, 0x7A, 0x00, 0x00}, 2, 0, "LD A,D"},
-  {{0xDD, 0x7B, 0x00, 0x00}, 2, 0, "LD A,E"},
-  {{0xDD, 0x7C, 0x00, 0x00}, 2, 0, "LD A,H"},
-  {{0xDD, 0x7D, 0x00, 0x00}, 2, 0, "LD A,L"},
-  {{0xDD, 0x7E, 0x00, 0x00}, 3, 0, "LD A,(IX)"},
-  {{0xDD, 0x7F, 0x00, 0x00}, 2, 0, "LD A,A"},
-  {{0xDD, 0x80, 0x00, 0x00}, 2, 0, "ADD A,B"},
-  {{0xDD, 0x81, 0x00, 0x00}, 2, 0, "ADD A,C"},
-  {{0xDD, 0x82, 0x00, 0x00}, 2, 0, "ADD A,D"},
-  {{0xDD, 0x83, 0x00, 0x00}, 2, 0, "ADD A,E"},
-  {{0xDD, 0x84, 0x00, 0x00}, 2, 0, "ADD A,H"},
-  {{0xDD, 0x85, 0x00, 0x00}, 2, 0, "ADD A,L"},
-  {{0xDD, 0x86, 0x00, 0x00}, 3, 0, "ADD A,(IX)"},
-  {{0xDD, 0x87, 0x00, 0x00}, 2, 0, "ADD A,A"},
-  {{0xDD, 0x88, 0x00, 0x00}, 2, 0, "ADC A,B"},
-  {{0xDD, 0x89, 0x00, 0x00}, 2, 0, "ADC A,C"},
-  {{0xDD, 0x8A, 0x00, 0x00}, 2, 0, "ADC A,D"},
-  {{0xDD, 0x8B, 0x00, 0x00}, 2, 0, "ADC A,E"},
-  {{0xDD, 0x8C, 0x00, 0x00}, 2, 0, "ADC A,H"},
-  {{0xDD, 0x8D, 0x00, 0x00}, 2, 0, "ADC A,L"},
-  {{0xDD, 0x8E, 0x00, 0x00}, 3, 0, "ADC A,(IX)"},
-  {{0xDD, 0x8F, 0x00, 0x00}, 2, 0, "ADC A,A"},
-  {{0xDD, 0x90, 0x00, 0x00}, 2, 0, "SUB B"},
-  {{0xDD, 0x91, 0x00, 0x00}, 2, 0, "SUB C"},
-  {{0xDD, 0x92, 0x00, 0x00}, 2, 0, "SUB D"},
-  {{0xDD, 0x93, 0x00, 0x00}, 2, 0, "SUB E"},
-  {{0xDD, 0x94, 0x00, 0x00}, 2, 0, "SUB H"},
-  {{0xDD, 0x95, 0x00, 0x00}, 2, 0, "SUB L"},
-  {{0xDD, 0x96, 0x00, 0x00}, 3, 0, "SUB (IX)"},
-  {{0xDD, 0x97, 0x00, 0x00}, 2, 0, "SUB A"},
-  {{0xDD, 0x98, 0x00, 0x00}, 2, 0, "SBC A,B"},
-  {{0xDD, 0x99, 0x00, 0x00}, 2, 0, "SBC A,C"},
-  {{0xDD, 0x9A, 0x00, 0x00}, 2, 0, "SBC A,D"},
-  {{0xDD, 0x9B, 0x00, 0x00}, 2, 0, "SBC A,E"},
-  {{0xDD, 0x9C, 0x00, 0x00}, 2, 0, "SBC A,H"},
-  {{0xDD, 0x9D, 0x00, 0x00}, 2, 0, "SBC A,L"},
-  {{0xDD, 0x9E, 0x00, 0x00}, 3, 0, "SBC A,(IX)"},
-  {{0xDD, 0x9F, 0x00, 0x00}, 2, 0, "SBC A,A"},
-  {{0xDD, 0xA0, 0x00, 0x00}, 2, 0, "AND B"},
-  {{0xDD, 0xA1, 0x00, 0x00}, 2, 0, "AND C"},
-  {{0xDD, 0xA2, 0x00, 0x00}, 2, 0, "AND D"},
-  {{0xDD, 0xA3, 0x00, 0x00}, 2, 0, "AND E"},
-  {{0xDD, 0xA4, 0x00, 0x00}, 2, 0, "AND H"},
-  {{0xDD, 0xA5, 0x00, 0x00}, 2, 0, "AND L"},
-  {{0xDD, 0xA6, 0x00, 0x00}, 3, 0, "AND (IX)"},
-  {{0xDD, 0xA7, 0x00, 0x00}, 2, 0, "AND A"},
-  {{0xDD, 0xA8, 0x00, 0x00}, 2, 0, "XOR B"},
-  {{0xDD, 0xA9, 0x00, 0x00}, 2, 0, "XOR C"},
-  {{0xDD, 0xAA, 0x00, 0x00}, 2, 0, "XOR D"},
-  {{0xDD, 0xAB, 0x00, 0x00}, 2, 0, "XOR E"},
-  {{0xDD, 0xAC, 0x00, 0x00}, 2, 0, "XOR H"},
-  {{0xDD, 0xAD, 0x00, 0x00}, 2, 0, "XOR L"},
-  {{0xDD, 0xAE, 0x00, 0x00}, 3, 0, "XOR (IX)"},
-  {{0xDD, 0xAF, 0x00, 0x00}, 2, 0, "XOR A"},
-  {{0xDD, 0xB0, 0x00, 0x00}, 2, 0, "OR B"},
-  {{0xDD, 0xB1, 0x00, 0x00}, 2, 0, "OR C"},
-  {{0xDD, 0xB2, 0x00, 0x00}, 2, 0, "OR D"},
-  {{0xDD, 0xB3, 0x00, 0x00}, 2, 0, "OR E"},
-  {{0xDD, 0xB4, 0x00, 0x00}, 2, 0, "OR H"},
-  {{0xDD, 0xB5, 0x00, 0x00}, 2, 0, "OR L"},
-  {{0xDD, 0xB6, 0x00, 0x00}, 3, 0, "OR (IX)"},
-  {{0xDD, 0xB7, 0x00, 0x00}, 2, 0, "OR A"},
-  {{0xDD, 0xB8, 0x00, 0x00}, 2, 0, "CP B"},
-  {{0xDD, 0xB9, 0x00, 0x00}, 2, 0, "CP C"},
-  {{0xDD, 0xBA, 0x00, 0x00}, 2, 0, "CP D"},
-  {{0xDD, 0xBB, 0x00, 0x00}, 2, 0, "CP E"},
-  {{0xDD, 0xBC, 0x00, 0x00}, 2, 0, "CP H"},
-  {{0xDD, 0xBD, 0x00, 0x00}, 2, 0, "CP L"},
-  {{0xDD, 0xBE, 0x00, 0x00}, 3, 0, "CP (IX)"},
-  {{0xDD, 0xBF, 0x00, 0x00}, 2, 0, "CP A"},
-  {{0xDD, 0xC0, 0x00, 0x00}, 2, 0, "RET NZ"},
-  {{0xDD, 0xC1, 0x00, 0x00}, 2, 0, "POP BC"},
-  {{0xDD, 0xC2, 0x00, 0x00}, 4, 0, "JP NZ,nn"},
-  {{0xDD, 0xC3, 0x00, 0x00}, 4, 0, "JP nn"},
-  {{0xDD, 0xC4, 0x00, 0x00}, 4, 0, "CALL NZ,nn"},
-  {{0xDD, 0xC5, 0x00, 0x00}, 2, 0, "PUSH BC"},
-  {{0xDD, 0xC6, 0x00, 0x00}, 3, 0, "ADD A,n"},
-  {{0xDD, 0xC7, 0x00, 0x00}, 2, 0, "RST 00H"},
-  {{0xDD, 0xC8, 0x00, 0x00}, 2, 0, "RET Z"},
-  {{0xDD, 0xC9, 0x00, 0x00}, 2, 0, "RET"},
-  {{0xDD, 0xCA, 0x00, 0x00}, 4, 0, "JP Z,nn"},
-  {{0xDD, 0xCB, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xDD, 0xCC, 0x00, 0x00}, 4, 0, "CALL Z,nn"},
-  {{0xDD, 0xCD, 0x00, 0x00}, 4, 0, "CALL nn"},
-  {{0xDD, 0xCE, 0x00, 0x00}, 3, 0, "ADC A,n"},
-  {{0xDD, 0xCF, 0x00, 0x00}, 2, 0, "RST 08H"},
-  {{0xDD, 0xD0, 0x00, 0x00}, 2, 0, "RET NC"},
-  {{0xDD, 0xD1, 0x00, 0x00}, 2, 0, "POP DE"},
-  {{0xDD, 0xD2, 0x00, 0x00}, 4, 0, "JP NC,nn"},
-  {{0xDD, 0xD3, 0x00, 0x00}, 3, 0, "OUT (n),A"},
-  {{0xDD, 0xD4, 0x00, 0x00}, 4, 0, "CALL NC,nn"},
-  {{0xDD, 0xD5, 0x00, 0x00}, 2, 0, "PUSH DE"},
-  {{0xDD, 0xD6, 0x00, 0x00}, 3, 0, "SUB n"},
-  {{0xDD, 0xD7, 0x00, 0x00}, 2, 0, "RST 10H"},
-  {{0xDD, 0xD8, 0x00, 0x00}, 2, 0, "RET C"},
-  {{0xDD, 0xD9, 0x00, 0x00}, 2, 0, "EXX"},
-  {{0xDD, 0xDA, 0x00, 0x00}, 4, 0, "JP C,nn"},
-  {{0xDD, 0xDB, 0x00, 0x00}, 3, 0, "IN A,(n)"},
-  {{0xDD, 0xDC, 0x00, 0x00}, 4, 0, "CALL C,nn"},
-  {{0xDD, 0xDD, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xDD, 0xDE, 0x00, 0x00}, 3, 0, "SBC A,n"},
-  {{0xDD, 0xDF, 0x00, 0x00}, 2, 0, "RST 18H"},
-  {{0xDD, 0xE0, 0x00, 0x00}, 2, 0, "RET PO"},
-  {{0xDD, 0xE1, 0x00, 0x00}, 2, 0, "POP IX"},
-  {{0xDD, 0xE2, 0x00, 0x00}, 4, 0, "JP PO,nn"},
-  {{0xDD, 0xE3, 0x00, 0x00}, 2, 0, "EX (SP),IX"},
-  {{0xDD, 0xE4, 0x00, 0x00}, 4, 0, "CALL PO,nn"},
-  {{0xDD, 0xE5, 0x00, 0x00}, 2, 0, "PUSH IX"},
-  {{0xDD, 0xE6, 0x00, 0x00}, 3, 0, "AND n"},
-  {{0xDD, 0xE7, 0x00, 0x00}, 2, 0, "RST 20H"},
-  {{0xDD, 0xE8, 0x00, 0x00}, 2, 0, "RET PE"},
-  {{0xDD, 0xE9, 0x00, 0x00}, 3, 0, "JP (IX)"},
-  {{0xDD, 0xEA, 0x00, 0x00}, 4, 0, "JP PE,nn"},
-  {{0xDD, 0xEB, 0x00, 0x00}, 2, 0, "EX DE,IX"},
-  {{0xDD, 0xEC, 0x00, 0x00}, 4, 0, "CALL PE,nn"},
-  {{0xDD, 0xED, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xDD, 0xEE, 0x00, 0x00}, 3, 0, "XOR n"},
-  {{0xDD, 0xEF, 0x00, 0x00}, 2, 0, "RST 28H"},
-  {{0xDD, 0xF0, 0x00, 0x00}, 2, 0, "RET P"},
-  {{0xDD, 0xF1, 0x00, 0x00}, 2, 0, "POP AF"},
-  {{0xDD, 0xF2, 0x00, 0x00}, 4, 0, "JP P,nn"},
-  {{0xDD, 0xF3, 0x00, 0x00}, 2, 0, "DI"},
-  {{0xDD, 0xF4, 0x00, 0x00}, 4, 0, "CALL P,nn"},
-  {{0xDD, 0xF5, 0x00, 0x00}, 2, 0, "PUSH AF"},
-  {{0xDD, 0xF6, 0x00, 0x00}, 3, 0, "OR n"},
-  {{0xDD, 0xF7, 0x00, 0x00}, 2, 0, "RST 30H"},
-  {{0xDD, 0xF8, 0x00, 0x00}, 2, 0, "RET M"},
-  {{0xDD, 0xF9, 0x00, 0x00}, 2, 0, "LD SP,IX"},
-  {{0xDD, 0xFA, 0x00, 0x00}, 4, 0, "JP M,nn"},
-  {{0xDD, 0xFB, 0x00, 0x00}, 2, 0, "EI"},
-  {{0xDD, 0xFC, 0x00, 0x00}, 4, 0, "CALL M,nn"},
-  {{0xDD, 0xFD, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xDD, 0xFE, 0x00, 0x00}, 3, 0, "CP n"},
-  {{0xDD, 0xFF, 0x00, 0x00}, 2, 0, "RST 38H"},
-  {{0xFD, 0x00, 0x00, 0x00}, 2, 0, "NOP"},
-  {{0xFD, 0x01, 0x00, 0x00}, 4, 0, "LD BC,nn"},
-  {{0xFD, 0x02, 0x00, 0x00}, 2, 0, "LD (BC),A"},
-  {{0xFD, 0x03, 0x00, 0x00}, 2, 0, "INC BC"},
-  {{0xFD, 0x04, 0x00, 0x00}, 2, 0, "INC B"},
-  {{0xFD, 0x05, 0x00, 0x00}, 2, 0, "DEC B"},
-  {{0xFD, 0x06, 0x00, 0x00}, 3, 0, "LD B,n"},
-  {{0xFD, 0x07, 0x00, 0x00}, 2, 0, "RLCA"},
-  {{0xFD, 0x08, 0x00, 0x00}, 2, 0, "EX AF,AF'"},
-  {{0xFD, 0x09, 0x00, 0x00}, 2, 0, "ADD IY,BC"},
-  {{0xFD, 0x0A, 0x00, 0x00}, 2, 0, "LD A,(BC)"},
-  {{0xFD, 0x0B, 0x00, 0x00}, 2, 0, "DEC BC"},
-  {{0xFD, 0x0C, 0x00, 0x00}, 2, 0, "INC C"},
-  {{0xFD, 0x0D, 0x00, 0x00}, 2, 0, "DEC C"},
-  {{0xFD, 0x0E, 0x00, 0x00}, 3, 0, "LD C,n"},
-  {{0xFD, 0x0F, 0x00, 0x00}, 2, 0, "RRCA"},
-  {{0xFD, 0x10, 0x00, 0x00}, 3, 0, "DJNZ d"},
-  {{0xFD, 0x11, 0x00, 0x00}, 4, 0, "LD DE,nn"},
-  {{0xFD, 0x12, 0x00, 0x00}, 2, 0, "LD (DE),A"},
-  {{0xFD, 0x13, 0x00, 0x00}, 2, 0, "INC DE"},
-  {{0xFD, 0x14, 0x00, 0x00}, 2, 0, "INC D"},
-  {{0xFD, 0x15, 0x00, 0x00}, 2, 0, "DEC D"},
-  {{0xFD, 0x16, 0x00, 0x00}, 3, 0, "LD D,n"},
-  {{0xFD, 0x17, 0x00, 0x00}, 2, 0, "RLA"},
-  {{0xFD, 0x18, 0x00, 0x00}, 3, 0, "JR d"},
-  {{0xFD, 0x19, 0x00, 0x00}, 2, 0, "ADD IY,DE"},
-  {{0xFD, 0x1A, 0x00, 0x00}, 2, 0, "LD A,(DE)"},
-  {{0xFD, 0x1B, 0x00, 0x00}, 2, 0, "DEC DE"},
-  {{0xFD, 0x1C, 0x00, 0x00}, 2, 0, "INC E"},
-  {{0xFD, 0x1D, 0x00, 0x00}, 2, 0, "DEC E"},
-  {{0xFD, 0x1E, 0x00, 0x00}, 3, 0, "LD E,n"},
-  {{0xFD, 0x1F, 0x00, 0x00}, 2, 0, "RRA"},
-  {{0xFD, 0x20, 0x00, 0x00}, 3, 0, "JR NZ,d"},
-  {{0xFD, 0x21, 0x00, 0x00}, 4, 0, "LD IY,nn"},
-  {{0xFD, 0x22, 0x00, 0x00}, 4, 0, "LD (nn),IY"},
-  {{0xFD, 0x23, 0x00, 0x00}, 2, 0, "INC IY"},
-  {{0xFD, 0x24, 0x00, 0x00}, 2, 0, "INC H"},
-  {{0xFD, 0x25, 0x00, 0x00}, 2, 0, "DEC H"},
-  {{0xFD, 0x26, 0x00, 0x00}, 3, 0, "LD H,n"},
-  {{0xFD, 0x27, 0x00, 0x00}, 2, 0, "DAA"},
-  {{0xFD, 0x28, 0x00, 0x00}, 3, 0, "JR Z,d"},
-  {{0xFD, 0x29, 0x00, 0x00}, 2, 0, "ADD IY,IY"},
-  {{0xFD, 0x2A, 0x00, 0x00}, 4, 0, "LD IY,(nn)"},
-  {{0xFD, 0x2B, 0x00, 0x00}, 2, 0, "DEC IY"},
-  {{0xFD, 0x2C, 0x00, 0x00}, 2, 0, "INC L"},
-  {{0xFD, 0x2D, 0x00, 0x00}, 2, 0, "DEC L"},
-  {{0xFD, 0x2E, 0x00, 0x00}, 3, 0, "LD L,n"},
-  {{0xFD, 0x2F, 0x00, 0x00}, 2, 0, "CPL"},
-  {{0xFD, 0x30, 0x00, 0x00}, 3, 0, "JR NC,d"},
-  {{0xFD, 0x31, 0x00, 0x00}, 4, 0, "LD SP,nn"},
-  {{0xFD, 0x32, 0x00, 0x00}, 4, 0, "LD (nn),A"},
-  {{0xFD, 0x33, 0x00, 0x00}, 2, 0, "INC SP"},
-  {{0xFD, 0x34, 0x00, 0x00}, 3, 0, "INC (IY)"},
-  {{0xFD, 0x35, 0x00, 0x00}, 3, 0, "DEC (IY)"},
-  {{0xFD, 0x36, 0x00, 0x00}, 4, 0, "LD (IY),n"},
-  {{0xFD, 0x37, 0x00, 0x00}, 2, 0, "SCF"},
-  {{0xFD, 0x38, 0x00, 0x00}, 3, 0, "JR C,d"},
-  {{0xFD, 0x39, 0x00, 0x00}, 2, 0, "ADD IY,SP"},
-  {{0xFD, 0x3A, 0x00, 0x00}, 4, 0, "LD A,(nn)"},
-  {{0xFD, 0x3B, 0x00, 0x00}, 2, 0, "DEC SP"},
-  {{0xFD, 0x3C, 0x00, 0x00}, 2, 0, "INC A"},
-  {{0xFD, 0x3D, 0x00, 0x00}, 2, 0, "DEC A"},
-  {{0xFD, 0x3E, 0x00, 0x00}, 3, 0, "LD A,n"},
-  {{0xFD, 0x3F, 0x00, 0x00}, 2, 0, "CCF"},
-  {{0xFD, 0x40, 0x00, 0x00}, 2, 0, "LD B,B"},
-  {{0xFD, 0x41, 0x00, 0x00}, 2, 0, "LD B,C"},
-  {{0xFD, 0x42, 0x00, 0x00}, 2, 0, "LD B,D"},
-  {{0xFD, 0x43, 0x00, 0x00}, 2, 0, "LD B,E"},
-  {{0xFD, 0x44, 0x00, 0x00}, 2, 0, "LD B,H"},
-  {{0xFD, 0x45, 0x00, 0x00}, 2, 0, "LD B,L"},
-  {{0xFD, 0x46, 0x00, 0x00}, 3, 0, "LD B,(IY)"},
-  {{0xFD, 0x47, 0x00, 0x00}, 2, 0, "LD B,A"},
-  {{0xFD, 0x48, 0x00, 0x00}, 2, 0, "LD C,B"},
-  {{0xFD, 0x49, 0x00, 0x00}, 2, 0, "LD C,C"},
-  {{0xFD, 0x4A, 0x00, 0x00}, 2, 0, "LD C,D"},
-  {{0xFD, 0x4B, 0x00, 0x00}, 2, 0, "LD C,E"},
-  {{0xFD, 0x4C, 0x00, 0x00}, 2, 0, "LD C,H"},
-  {{0xFD, 0x4D, 0x00, 0x00}, 2, 0, "LD C,L"},
-  {{0xFD, 0x4E, 0x00, 0x00}, 3, 0, "LD C,(IY)"},
-  {{0xFD, 0x4F, 0x00, 0x00}, 2, 0, "LD C,A"},
-  {{0xFD, 0x50, 0x00, 0x00}, 2, 0, "LD D,B"},
-  {{0xFD, 0x51, 0x00, 0x00}, 2, 0, "LD D,C"},
-  {{0xFD, 0x52, 0x00, 0x00}, 2, 0, "LD D,D"},
-  {{0xFD, 0x53, 0x00, 0x00}, 2, 0, "LD D,E"},
-  {{0xFD, 0x54, 0x00, 0x00}, 2, 0, "LD D,H"},
-  {{0xFD, 0x55, 0x00, 0x00}, 2, 0, "LD D,L"},
-  {{0xFD, 0x56, 0x00, 0x00}, 3, 0, "LD D,(IY)"},
-  {{0xFD, 0x57, 0x00, 0x00}, 2, 0, "LD D,A"},
-  {{0xFD, 0x58, 0x00, 0x00}, 2, 0, "LD E,B"},
-  {{0xFD, 0x59, 0x00, 0x00}, 2, 0, "LD E,C"},
-  {{0xFD, 0x5A, 0x00, 0x00}, 2, 0, "LD E,D"},
-  {{0xFD, 0x5B, 0x00, 0x00}, 2, 0, "LD E,E"},
-  {{0xFD, 0x5C, 0x00, 0x00}, 2, 0, "LD E,H"},
-  {{0xFD, 0x5D, 0x00, 0x00}, 2, 0, "LD E,L"},
-  {{0xFD, 0x5E, 0x00, 0x00}, 3, 0, "LD E,(IY)"},
-  {{0xFD, 0x5F, 0x00, 0x00}, 2, 0, "LD E,A"},
-  {{0xFD, 0x60, 0x00, 0x00}, 2, 0, "LD H,B"},
-  {{0xFD, 0x61, 0x00, 0x00}, 2, 0, "LD H,C"},
-  {{0xFD, 0x62, 0x00, 0x00}, 2, 0, "LD H,D"},
-  {{0xFD, 0x63, 0x00, 0x00}, 2, 0, "LD H,E"},
-  {{0xFD, 0x64, 0x00, 0x00}, 2, 0, "LD H,H"},
-  {{0xFD, 0x65, 0x00, 0x00}, 2, 0, "LD H,L"},
-  {{0xFD, 0x66, 0x00, 0x00}, 3, 0, "LD H,(IY)"},
-  {{0xFD, 0x67, 0x00, 0x00}, 2, 0, "LD H,A"},
-  {{0xFD, 0x68, 0x00, 0x00}, 2, 0, "LD L,B"},
-  {{0xFD, 0x69, 0x00, 0x00}, 2, 0, "LD L,C"},
-  {{0xFD, 0x6A, 0x00, 0x00}, 2, 0, "LD L,D"},
-  {{0xFD, 0x6B, 0x00, 0x00}, 2, 0, "LD L,E"},
-  {{0xFD, 0x6C, 0x00, 0x00}, 2, 0, "LD L,H"},
-  {{0xFD, 0x6D, 0x00, 0x00}, 2, 0, "LD L,L"},
-  {{0xFD, 0x6E, 0x00, 0x00}, 3, 0, "LD L,(IY)"},
-  {{0xFD, 0x6F, 0x00, 0x00}, 2, 0, "LD L,A"},
-  {{0xFD, 0x70, 0x00, 0x00}, 3, 0, "LD (IY),B"},
-  {{0xFD, 0x71, 0x00, 0x00}, 3, 0, "LD (IY),C"},
-  {{0xFD, 0x72, 0x00, 0x00}, 3, 0, "LD (IY),D"},
-  {{0xFD, 0x73, 0x00, 0x00}, 3, 0, "LD (IY),E"},
-  {{0xFD, 0x74, 0x00, 0x00}, 3, 0, "LD (IY),H"},
-  {{0xFD, 0x75, 0x00, 0x00}, 3, 0, "LD (IY),L"},
-  {{0xFD, 0x76, 0x00, 0x00}, 2, 0, "HALT"},
-  {{0xFD, 0x77, 0x00, 0x00}, 3, 0, "LD (IY),A"},
-  {{0xFD, 0x78, 0x00, 0x00}, 2, 0, "LD A,B"},
-  {{0xFD, 0x79, 0x00, 0x00}, 2, 0, "LD A,C"},
-  {{0xFD, 0x7A, 0x00, 0x00}, 2, 0, "LD A,D"},
-  {{0xFD, 0x7B, 0x00, 0x00}, 2, 0, "LD A,E"},
-  {{0xFD, 0x7C, 0x00, 0x00}, 2, 0, "LD A,H"},
-  {{0xFD, 0x7D, 0x00, 0x00}, 2, 0, "LD A,L"},
-  {{0xFD, 0x7E, 0x00, 0x00}, 3, 0, "LD A,(IY)"},
-  {{0xFD, 0x7F, 0x00, 0x00}, 2, 0, "LD A,A"},
-  {{0xFD, 0x80, 0x00, 0x00}, 2, 0, "ADD A,B"},
-  {{0xFD, 0x81, 0x00, 0x00}, 2, 0, "ADD A,C"},
-  {{0xFD, 0x82, 0x00, 0x00}, 2, 0, "ADD A,D"},
-  {{0xFD, 0x83, 0x00, 0x00}, 2, 0, "ADD A,E"},
-  {{0xFD, 0x84, 0x00, 0x00}, 2, 0, "ADD A,H"},
-  {{0xFD, 0x85, 0x00, 0x00}, 2, 0, "ADD A,L"},
-  {{0xFD, 0x86, 0x00, 0x00}, 3, 0, "ADD A,(IY)"},
-  {{0xFD, 0x87, 0x00, 0x00}, 2, 0, "ADD A,A"},
-  {{0xFD, 0x88, 0x00, 0x00}, 2, 0, "ADC A,B"},
-  {{0xFD, 0x89, 0x00, 0x00}, 2, 0, "ADC A,C"},
-  {{0xFD, 0x8A, 0x00, 0x00}, 2, 0, "ADC A,D"},
-  {{0xFD, 0x8B, 0x00, 0x00}, 2, 0, "ADC A,E"},
-  {{0xFD, 0x8C, 0x00, 0x00}, 2, 0, "ADC A,H"},
-  {{0xFD, 0x8D, 0x00, 0x00}, 2, 0, "ADC A,L"},
-  {{0xFD, 0x8E, 0x00, 0x00}, 3, 0, "ADC A,(IY)"},
-  {{0xFD, 0x8F, 0x00, 0x00}, 2, 0, "ADC A,A"},
-  {{0xFD, 0x90, 0x00, 0x00}, 2, 0, "SUB B"},
-  {{0xFD, 0x91, 0x00, 0x00}, 2, 0, "SUB C"},
-  {{0xFD, 0x92, 0x00, 0x00}, 2, 0, "SUB D"},
-  {{0xFD, 0x93, 0x00, 0x00}, 2, 0, "SUB E"},
-  {{0xFD, 0x94, 0x00, 0x00}, 2, 0, "SUB H"},
-  {{0xFD, 0x95, 0x00, 0x00}, 2, 0, "SUB L"},
-  {{0xFD, 0x96, 0x00, 0x00}, 3, 0, "SUB (IY)"},
-  {{0xFD, 0x97, 0x00, 0x00}, 2, 0, "SUB A"},
-  {{0xFD, 0x98, 0x00, 0x00}, 2, 0, "SBC A,B"},
-  {{0xFD, 0x99, 0x00, 0x00}, 2, 0, "SBC A,C"},
-  {{0xFD, 0x9A, 0x00, 0x00}, 2, 0, "SBC A,D"},
-  {{0xFD, 0x9B, 0x00, 0x00}, 2, 0, "SBC A,E"},
-  {{0xFD, 0x9C, 0x00, 0x00}, 2, 0, "SBC A,H"},
-  {{0xFD, 0x9D, 0x00, 0x00}, 2, 0, "SBC A,L"},
-  {{0xFD, 0x9E, 0x00, 0x00}, 3, 0, "SBC A,(IY)"},
-  {{0xFD, 0x9F, 0x00, 0x00}, 2, 0, "SBC A,A"},
-  {{0xFD, 0xA0, 0x00, 0x00}, 2, 0, "AND B"},
-  {{0xFD, 0xA1, 0x00, 0x00}, 2, 0, "AND C"},
-  {{0xFD, 0xA2, 0x00, 0x00}, 2, 0, "AND D"},
-  {{0xFD, 0xA3, 0x00, 0x00}, 2, 0, "AND E"},
-  {{0xFD, 0xA4, 0x00, 0x00}, 2, 0, "AND H"},
-  {{0xFD, 0xA5, 0x00, 0x00}, 2, 0, "AND L"},
-  {{0xFD, 0xA6, 0x00, 0x00}, 3, 0, "AND (IY)"},
-  {{0xFD, 0xA7, 0x00, 0x00}, 2, 0, "AND A"},
-  {{0xFD, 0xA8, 0x00, 0x00}, 2, 0, "XOR B"},
-  {{0xFD, 0xA9, 0x00, 0x00}, 2, 0, "XOR C"},
-  {{0xFD, 0xAA, 0x00, 0x00}, 2, 0, "XOR D"},
-  {{0xFD, 0xAB, 0x00, 0x00}, 2, 0, "XOR E"},
-  {{0xFD, 0xAC, 0x00, 0x00}, 2, 0, "XOR H"},
-  {{0xFD, 0xAD, 0x00, 0x00}, 2, 0, "XOR L"},
-  {{0xFD, 0xAE, 0x00, 0x00}, 3, 0, "XOR (IY)"},
-  {{0xFD, 0xAF, 0x00, 0x00}, 2, 0, "XOR A"},
-  {{0xFD, 0xB0, 0x00, 0x00}, 2, 0, "OR B"},
-  {{0xFD, 0xB1, 0x00, 0x00}, 2, 0, "OR C"},
-  {{0xFD, 0xB2, 0x00, 0x00}, 2, 0, "OR D"},
-  {{0xFD, 0xB3, 0x00, 0x00}, 2, 0, "OR E"},
-  {{0xFD, 0xB4, 0x00, 0x00}, 2, 0, "OR H"},
-  {{0xFD, 0xB5, 0x00, 0x00}, 2, 0, "OR L"},
-  {{0xFD, 0xB6, 0x00, 0x00}, 3, 0, "OR (IY)"},
-  {{0xFD, 0xB7, 0x00, 0x00}, 2, 0, "OR A"},
-  {{0xFD, 0xB8, 0x00, 0x00}, 2, 0, "CP B"},
-  {{0xFD, 0xB9, 0x00, 0x00}, 2, 0, "CP C"},
-  {{0xFD, 0xBA, 0x00, 0x00}, 2, 0, "CP D"},
-  {{0xFD, 0xBB, 0x00, 0x00}, 2, 0, "CP E"},
-  {{0xFD, 0xBC, 0x00, 0x00}, 2, 0, "CP H"},
-  {{0xFD, 0xBD, 0x00, 0x00}, 2, 0, "CP L"},
-  {{0xFD, 0xBE, 0x00, 0x00}, 3, 0, "CP (IY)"},
-  {{0xFD, 0xBF, 0x00, 0x00}, 2, 0, "CP A"},
-  {{0xFD, 0xC0, 0x00, 0x00}, 2, 0, "RET NZ"},
-  {{0xFD, 0xC1, 0x00, 0x00}, 2, 0, "POP BC"},
-  {{0xFD, 0xC2, 0x00, 0x00}, 4, 0, "JP NZ,nn"},
-  {{0xFD, 0xC3, 0x00, 0x00}, 4, 0, "JP nn"},
-  {{0xFD, 0xC4, 0x00, 0x00}, 4, 0, "CALL NZ,nn"},
-  {{0xFD, 0xC5, 0x00, 0x00}, 2, 0, "PUSH BC"},
-  {{0xFD, 0xC6, 0x00, 0x00}, 3, 0, "ADD A,n"},
-  {{0xFD, 0xC7, 0x00, 0x00}, 2, 0, "RST 00H"},
-  {{0xFD, 0xC8, 0x00, 0x00}, 2, 0, "RET Z"},
-  {{0xFD, 0xC9, 0x00, 0x00}, 2, 0, "RET"},
-  {{0xFD, 0xCA, 0x00, 0x00}, 4, 0, "JP Z,nn"},
-  {{0xFD, 0xCB, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xFD, 0xCC, 0x00, 0x00}, 4, 0, "CALL Z,nn"},
-  {{0xFD, 0xCD, 0x00, 0x00}, 4, 0, "CALL nn"},
-  {{0xFD, 0xCE, 0x00, 0x00}, 3, 0, "ADC A,n"},
-  {{0xFD, 0xCF, 0x00, 0x00}, 2, 0, "RST 08H"},
-  {{0xFD, 0xD0, 0x00, 0x00}, 2, 0, "RET NC"},
-  {{0xFD, 0xD1, 0x00, 0x00}, 2, 0, "POP DE"},
-  {{0xFD, 0xD2, 0x00, 0x00}, 4, 0, "JP NC,nn"},
-  {{0xFD, 0xD3, 0x00, 0x00}, 3, 0, "OUT (n),A"},
-  {{0xFD, 0xD4, 0x00, 0x00}, 4, 0, "CALL NC,nn"},
-  {{0xFD, 0xD5, 0x00, 0x00}, 2, 0, "PUSH DE"},
-  {{0xFD, 0xD6, 0x00, 0x00}, 3, 0, "SUB n"},
-  {{0xFD, 0xD7, 0x00, 0x00}, 2, 0, "RST 10H"},
-  {{0xFD, 0xD8, 0x00, 0x00}, 2, 0, "RET C"},
-  {{0xFD, 0xD9, 0x00, 0x00}, 2, 0, "EXX"},
-  {{0xFD, 0xDA, 0x00, 0x00}, 4, 0, "JP C,nn"},
-  {{0xFD, 0xDB, 0x00, 0x00}, 3, 0, "IN A,(n)"},
-  {{0xFD, 0xDC, 0x00, 0x00}, 4, 0, "CALL C,nn"},
-  {{0xFD, 0xDD, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xFD, 0xDE, 0x00, 0x00}, 3, 0, "SBC A,n"},
-  {{0xFD, 0xDF, 0x00, 0x00}, 2, 0, "RST 18H"},
-  {{0xFD, 0xE0, 0x00, 0x00}, 2, 0, "RET PO"},
-  {{0xFD, 0xE1, 0x00, 0x00}, 2, 0, "POP IY"},
-  {{0xFD, 0xE2, 0x00, 0x00}, 4, 0, "JP PO,nn"},
-  {{0xFD, 0xE3, 0x00, 0x00}, 2, 0, "EX (SP),IY"},
-  {{0xFD, 0xE4, 0x00, 0x00}, 4, 0, "CALL PO,nn"},
-  {{0xFD, 0xE5, 0x00, 0x00}, 2, 0, "PUSH IY"},
-  {{0xFD, 0xE6, 0x00, 0x00}, 3, 0, "AND n"},
-  {{0xFD, 0xE7, 0x00, 0x00}, 2, 0, "RST 20H"},
-  {{0xFD, 0xE8, 0x00, 0x00}, 2, 0, "RET PE"},
-  {{0xFD, 0xE9, 0x00, 0x00}, 3, 0, "JP (IY)"},
-  {{0xFD, 0xEA, 0x00, 0x00}, 4, 0, "JP PE,nn"},
-  {{0xFD, 0xEB, 0x00, 0x00}, 2, 0, "EX DE,IY"},
-  {{0xFD, 0xEC, 0x00, 0x00}, 4, 0, "CALL PE,nn"},
-  {{0xFD, 0xED, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xFD, 0xEE, 0x00, 0x00}, 3, 0, "XOR n"},
-  {{0xFD, 0xEF, 0x00, 0x00}, 2, 0, "RST 28H"},
-  {{0xFD, 0xF0, 0x00, 0x00}, 2, 0, "RET P"},
-  {{0xFD, 0xF1, 0x00, 0x00}, 2, 0, "POP AF"},
-  {{0xFD, 0xF2, 0x00, 0x00}, 4, 0, "JP P,nn"},
-  {{0xFD, 0xF3, 0x00, 0x00}, 2, 0, "DI"},
-  {{0xFD, 0xF4, 0x00, 0x00}, 4, 0, "CALL P,nn"},
-  {{0xFD, 0xF5, 0x00, 0x00}, 2, 0, "PUSH AF"},
-  {{0xFD, 0xF6, 0x00, 0x00}, 3, 0, "OR n"},
-  {{0xFD, 0xF7, 0x00, 0x00}, 2, 0, "RST 30H"},
-  {{0xFD, 0xF8, 0x00, 0x00}, 2, 0, "RET M"},
-  {{0xFD, 0xF9, 0x00, 0x00}, 2, 0, "LD SP,IY"},
-  {{0xFD, 0xFA, 0x00, 0x00}, 4, 0, "JP M,nn"},
-  {{0xFD, 0xFB, 0x00, 0x00}, 2, 0, "EI"},
-  {{0xFD, 0xFC, 0x00, 0x00}, 4, 0, "CALL M,nn"},
-  {{0xFD, 0xFD, 0x00, 0x00}, 2, 0, "UNDEFINED"},
-  {{0xFD, 0xFE, 0x00, 0x00}, 3, 0, "CP n"},
-  {{0xFD, 0xFF, 0x00, 0x00}, 2, 0, "RST 38H"},
-  {{0xDD, 0xCB, 0x00, 0x00}, 4, 1, "RLC (IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0x01}, 4, 1, "RLC (IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0x02}, 4, 1, "RLC (IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0x03}, 4, 1, "RLC (IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0x04}, 4, 1, "RLC (IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0x05}, 4, 1, "RLC (IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0x06}, 4, 1, "RLC (IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x07}, 4, 1, "RLC (IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0x08}, 4, 1, "RRC (IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0x09}, 4, 1, "RRC (IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0x0A}, 4, 1, "RRC (IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0x0B}, 4, 1, "RRC (IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0x0C}, 4, 1, "RRC (IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0x0D}, 4, 1, "RRC (IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0x0E}, 4, 1, "RRC (IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x0F}, 4, 1, "RRC (IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0x10}, 4, 1, "RL (IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0x11}, 4, 1, "RL (IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0x12}, 4, 1, "RL (IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0x13}, 4, 1, "RL (IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0x14}, 4, 1, "RL (IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0x15}, 4, 1, "RL (IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0x16}, 4, 1, "RL (IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x17}, 4, 1, "RL (IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0x18}, 4, 1, "RR (IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0x19}, 4, 1, "RR (IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0x1A}, 4, 1, "RR (IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0x1B}, 4, 1, "RR (IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0x1C}, 4, 1, "RR (IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0x1D}, 4, 1, "RR (IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0x1E}, 4, 1, "RR (IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x1F}, 4, 1, "RR (IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0x20}, 4, 1, "SLA (IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0x21}, 4, 1, "SLA (IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0x22}, 4, 1, "SLA (IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0x23}, 4, 1, "SLA (IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0x24}, 4, 1, "SLA (IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0x25}, 4, 1, "SLA (IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0x26}, 4, 1, "SLA (IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x27}, 4, 1, "SLA (IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0x28}, 4, 1, "SRA (IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0x29}, 4, 1, "SRA (IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0x2A}, 4, 1, "SRA (IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0x2B}, 4, 1, "SRA (IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0x2C}, 4, 1, "SRA (IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0x2D}, 4, 1, "SRA (IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0x2E}, 4, 1, "SRA (IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x2F}, 4, 1, "SRA (IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0x30}, 4, 1, "SLL (IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0x31}, 4, 1, "SLL (IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0x32}, 4, 1, "SLL (IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0x33}, 4, 1, "SLL (IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0x34}, 4, 1, "SLL (IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0x35}, 4, 1, "SLL (IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0x36}, 4, 1, "SLL (IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x37}, 4, 1, "SLL (IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0x38}, 4, 1, "SRL (IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0x39}, 4, 1, "SRL (IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0x3A}, 4, 1, "SRL (IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0x3B}, 4, 1, "SRL (IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0x3C}, 4, 1, "SRL (IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0x3D}, 4, 1, "SRL (IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0x3E}, 4, 1, "SRL (IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x3F}, 4, 1, "SRL (IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0x40}, 4, 1, "BIT 0,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x41}, 4, 1, "BIT 0,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x42}, 4, 1, "BIT 0,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x43}, 4, 1, "BIT 0,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x44}, 4, 1, "BIT 0,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x45}, 4, 1, "BIT 0,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x46}, 4, 1, "BIT 0,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x47}, 4, 1, "BIT 0,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x48}, 4, 1, "BIT 1,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x49}, 4, 1, "BIT 1,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x4A}, 4, 1, "BIT 1,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x4B}, 4, 1, "BIT 1,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x4C}, 4, 1, "BIT 1,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x4D}, 4, 1, "BIT 1,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x4E}, 4, 1, "BIT 1,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x4F}, 4, 1, "BIT 1,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x50}, 4, 1, "BIT 2,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x51}, 4, 1, "BIT 2,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x52}, 4, 1, "BIT 2,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x53}, 4, 1, "BIT 2,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x54}, 4, 1, "BIT 2,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x55}, 4, 1, "BIT 2,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x56}, 4, 1, "BIT 2,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x57}, 4, 1, "BIT 2,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x58}, 4, 1, "BIT 3,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x59}, 4, 1, "BIT 3,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x5A}, 4, 1, "BIT 3,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x5B}, 4, 1, "BIT 3,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x5C}, 4, 1, "BIT 3,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x5D}, 4, 1, "BIT 3,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x5E}, 4, 1, "BIT 3,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x5F}, 4, 1, "BIT 3,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x60}, 4, 1, "BIT 4,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x61}, 4, 1, "BIT 4,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x62}, 4, 1, "BIT 4,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x63}, 4, 1, "BIT 4,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x64}, 4, 1, "BIT 4,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x65}, 4, 1, "BIT 4,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x66}, 4, 1, "BIT 4,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x67}, 4, 1, "BIT 4,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x68}, 4, 1, "BIT 5,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x69}, 4, 1, "BIT 5,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x6A}, 4, 1, "BIT 5,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x6B}, 4, 1, "BIT 5,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x6C}, 4, 1, "BIT 5,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x6D}, 4, 1, "BIT 5,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x6E}, 4, 1, "BIT 5,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x6F}, 4, 1, "BIT 5,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x70}, 4, 1, "BIT 6,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x71}, 4, 1, "BIT 6,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x72}, 4, 1, "BIT 6,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x73}, 4, 1, "BIT 6,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x74}, 4, 1, "BIT 6,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x75}, 4, 1, "BIT 6,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x76}, 4, 1, "BIT 6,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x77}, 4, 1, "BIT 6,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x78}, 4, 1, "BIT 7,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x79}, 4, 1, "BIT 7,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x7A}, 4, 1, "BIT 7,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x7B}, 4, 1, "BIT 7,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x7C}, 4, 1, "BIT 7,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x7D}, 4, 1, "BIT 7,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x7E}, 4, 1, "BIT 7,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x7F}, 4, 1, "BIT 7,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x80}, 4, 1, "RES 0,(IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0x81}, 4, 1, "RES 0,(IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0x82}, 4, 1, "RES 0,(IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0x83}, 4, 1, "RES 0,(IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0x84}, 4, 1, "RES 0,(IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0x85}, 4, 1, "RES 0,(IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0x86}, 4, 1, "RES 0,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x87}, 4, 1, "RES 0,(IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0x88}, 4, 1, "RES 1,(IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0x89}, 4, 1, "RES 1,(IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0x8A}, 4, 1, "RES 1,(IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0x8B}, 4, 1, "RES 1,(IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0x8C}, 4, 1, "RES 1,(IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0x8D}, 4, 1, "RES 1,(IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0x8E}, 4, 1, "RES 1,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x8F}, 4, 1, "RES 1,(IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0x90}, 4, 1, "RES 2,(IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0x91}, 4, 1, "RES 2,(IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0x92}, 4, 1, "RES 2,(IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0x93}, 4, 1, "RES 2,(IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0x94}, 4, 1, "RES 2,(IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0x95}, 4, 1, "RES 2,(IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0x96}, 4, 1, "RES 2,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x97}, 4, 1, "RES 2,(IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0x98}, 4, 1, "RES 3,(IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0x99}, 4, 1, "RES 3,(IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0x9A}, 4, 1, "RES 3,(IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0x9B}, 4, 1, "RES 3,(IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0x9C}, 4, 1, "RES 3,(IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0x9D}, 4, 1, "RES 3,(IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0x9E}, 4, 1, "RES 3,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0x9F}, 4, 1, "RES 3,(IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0xA0}, 4, 1, "RES 4,(IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0xA1}, 4, 1, "RES 4,(IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0xA2}, 4, 1, "RES 4,(IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0xA3}, 4, 1, "RES 4,(IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0xA4}, 4, 1, "RES 4,(IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0xA5}, 4, 1, "RES 4,(IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0xA6}, 4, 1, "RES 4,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0xA7}, 4, 1, "RES 4,(IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0xA8}, 4, 1, "RES 5,(IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0xA9}, 4, 1, "RES 5,(IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0xAA}, 4, 1, "RES 5,(IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0xAB}, 4, 1, "RES 5,(IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0xAC}, 4, 1, "RES 5,(IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0xAD}, 4, 1, "RES 5,(IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0xAE}, 4, 1, "RES 5,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0xAF}, 4, 1, "RES 5,(IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0xB0}, 4, 1, "RES 6,(IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0xB1}, 4, 1, "RES 6,(IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0xB2}, 4, 1, "RES 6,(IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0xB3}, 4, 1, "RES 6,(IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0xB4}, 4, 1, "RES 6,(IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0xB5}, 4, 1, "RES 6,(IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0xB6}, 4, 1, "RES 6,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0xB7}, 4, 1, "RES 6,(IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0xB8}, 4, 1, "RES 7,(IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0xB9}, 4, 1, "RES 7,(IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0xBA}, 4, 1, "RES 7,(IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0xBB}, 4, 1, "RES 7,(IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0xBC}, 4, 1, "RES 7,(IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0xBD}, 4, 1, "RES 7,(IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0xBE}, 4, 1, "RES 7,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0xBF}, 4, 1, "RES 7,(IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0xC0}, 4, 1, "SET 0,(IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0xC1}, 4, 1, "SET 0,(IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0xC2}, 4, 1, "SET 0,(IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0xC3}, 4, 1, "SET 0,(IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0xC4}, 4, 1, "SET 0,(IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0xC5}, 4, 1, "SET 0,(IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0xC6}, 4, 1, "SET 0,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0xC7}, 4, 1, "SET 0,(IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0xC8}, 4, 1, "SET 1,(IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0xC9}, 4, 1, "SET 1,(IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0xCA}, 4, 1, "SET 1,(IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0xCB}, 4, 1, "SET 1,(IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0xCC}, 4, 1, "SET 1,(IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0xCD}, 4, 1, "SET 1,(IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0xCE}, 4, 1, "SET 1,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0xCF}, 4, 1, "SET 1,(IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0xD0}, 4, 1, "SET 2,(IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0xD1}, 4, 1, "SET 2,(IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0xD2}, 4, 1, "SET 2,(IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0xD3}, 4, 1, "SET 2,(IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0xD4}, 4, 1, "SET 2,(IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0xD5}, 4, 1, "SET 2,(IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0xD6}, 4, 1, "SET 2,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0xD7}, 4, 1, "SET 2,(IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0xD8}, 4, 1, "SET 3,(IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0xD9}, 4, 1, "SET 3,(IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0xDA}, 4, 1, "SET 3,(IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0xDB}, 4, 1, "SET 3,(IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0xDC}, 4, 1, "SET 3,(IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0xDD}, 4, 1, "SET 3,(IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0xDE}, 4, 1, "SET 3,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0xDF}, 4, 1, "SET 3,(IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0xE0}, 4, 1, "SET 4,(IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0xE1}, 4, 1, "SET 4,(IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0xE2}, 4, 1, "SET 4,(IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0xE3}, 4, 1, "SET 4,(IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0xE4}, 4, 1, "SET 4,(IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0xE5}, 4, 1, "SET 4,(IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0xE6}, 4, 1, "SET 4,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0xE7}, 4, 1, "SET 4,(IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0xE8}, 4, 1, "SET 5,(IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0xE9}, 4, 1, "SET 5,(IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0xEA}, 4, 1, "SET 5,(IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0xEB}, 4, 1, "SET 5,(IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0xEC}, 4, 1, "SET 5,(IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0xED}, 4, 1, "SET 5,(IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0xEE}, 4, 1, "SET 5,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0xEF}, 4, 1, "SET 5,(IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0xF0}, 4, 1, "SET 6,(IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0xF1}, 4, 1, "SET 6,(IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0xF2}, 4, 1, "SET 6,(IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0xF3}, 4, 1, "SET 6,(IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0xF4}, 4, 1, "SET 6,(IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0xF5}, 4, 1, "SET 6,(IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0xF6}, 4, 1, "SET 6,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0xF7}, 4, 1, "SET 6,(IX+d) -> A"},
-  {{0xDD, 0xCB, 0x00, 0xF8}, 4, 1, "SET 7,(IX+d) -> B"},
-  {{0xDD, 0xCB, 0x00, 0xF9}, 4, 1, "SET 7,(IX+d) -> C"},
-  {{0xDD, 0xCB, 0x00, 0xFA}, 4, 1, "SET 7,(IX+d) -> D"},
-  {{0xDD, 0xCB, 0x00, 0xFB}, 4, 1, "SET 7,(IX+d) -> E"},
-  {{0xDD, 0xCB, 0x00, 0xFC}, 4, 1, "SET 7,(IX+d) -> H"},
-  {{0xDD, 0xCB, 0x00, 0xFD}, 4, 1, "SET 7,(IX+d) -> L"},
-  {{0xDD, 0xCB, 0x00, 0xFE}, 4, 1, "SET 7,(IX+d)"},
-  {{0xDD, 0xCB, 0x00, 0xFF}, 4, 1, "SET 7,(IX+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0x00}, 4, 1, "RLC (IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0x01}, 4, 1, "RLC (IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0x02}, 4, 1, "RLC (IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0x03}, 4, 1, "RLC (IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0x04}, 4, 1, "RLC (IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0x05}, 4, 1, "RLC (IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0x06}, 4, 1, "RLC (IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x07}, 4, 1, "RLC (IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0x08}, 4, 1, "RRC (IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0x09}, 4, 1, "RRC (IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0x0A}, 4, 1, "RRC (IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0x0B}, 4, 1, "RRC (IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0x0C}, 4, 1, "RRC (IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0x0D}, 4, 1, "RRC (IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0x0E}, 4, 1, "RRC (IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x0F}, 4, 1, "RRC (IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0x10}, 4, 1, "RL (IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0x11}, 4, 1, "RL (IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0x12}, 4, 1, "RL (IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0x13}, 4, 1, "RL (IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0x14}, 4, 1, "RL (IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0x15}, 4, 1, "RL (IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0x16}, 4, 1, "RL (IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x17}, 4, 1, "RL (IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0x18}, 4, 1, "RR (IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0x19}, 4, 1, "RR (IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0x1A}, 4, 1, "RR (IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0x1B}, 4, 1, "RR (IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0x1C}, 4, 1, "RR (IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0x1D}, 4, 1, "RR (IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0x1E}, 4, 1, "RR (IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x1F}, 4, 1, "RR (IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0x20}, 4, 1, "SLA (IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0x21}, 4, 1, "SLA (IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0x22}, 4, 1, "SLA (IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0x23}, 4, 1, "SLA (IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0x24}, 4, 1, "SLA (IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0x25}, 4, 1, "SLA (IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0x26}, 4, 1, "SLA (IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x27}, 4, 1, "SLA (IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0x28}, 4, 1, "SRA (IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0x29}, 4, 1, "SRA (IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0x2A}, 4, 1, "SRA (IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0x2B}, 4, 1, "SRA (IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0x2C}, 4, 1, "SRA (IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0x2D}, 4, 1, "SRA (IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0x2E}, 4, 1, "SRA (IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x2F}, 4, 1, "SRA (IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0x30}, 4, 1, "SLL (IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0x31}, 4, 1, "SLL (IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0x32}, 4, 1, "SLL (IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0x33}, 4, 1, "SLL (IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0x34}, 4, 1, "SLL (IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0x35}, 4, 1, "SLL (IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0x36}, 4, 1, "SLL (IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x37}, 4, 1, "SLL (IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0x38}, 4, 1, "SRL (IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0x39}, 4, 1, "SRL (IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0x3A}, 4, 1, "SRL (IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0x3B}, 4, 1, "SRL (IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0x3C}, 4, 1, "SRL (IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0x3D}, 4, 1, "SRL (IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0x3E}, 4, 1, "SRL (IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x3F}, 4, 1, "SRL (IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0x40}, 4, 1, "BIT 0,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x41}, 4, 1, "BIT 0,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x42}, 4, 1, "BIT 0,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x43}, 4, 1, "BIT 0,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x44}, 4, 1, "BIT 0,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x45}, 4, 1, "BIT 0,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x46}, 4, 1, "BIT 0,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x47}, 4, 1, "BIT 0,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x48}, 4, 1, "BIT 1,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x49}, 4, 1, "BIT 1,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x4A}, 4, 1, "BIT 1,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x4B}, 4, 1, "BIT 1,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x4C}, 4, 1, "BIT 1,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x4D}, 4, 1, "BIT 1,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x4E}, 4, 1, "BIT 1,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x4F}, 4, 1, "BIT 1,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x50}, 4, 1, "BIT 2,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x51}, 4, 1, "BIT 2,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x52}, 4, 1, "BIT 2,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x53}, 4, 1, "BIT 2,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x54}, 4, 1, "BIT 2,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x55}, 4, 1, "BIT 2,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x56}, 4, 1, "BIT 2,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x57}, 4, 1, "BIT 2,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x58}, 4, 1, "BIT 3,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x59}, 4, 1, "BIT 3,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x5A}, 4, 1, "BIT 3,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x5B}, 4, 1, "BIT 3,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x5C}, 4, 1, "BIT 3,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x5D}, 4, 1, "BIT 3,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x5E}, 4, 1, "BIT 3,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x5F}, 4, 1, "BIT 3,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x60}, 4, 1, "BIT 4,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x61}, 4, 1, "BIT 4,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x62}, 4, 1, "BIT 4,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x63}, 4, 1, "BIT 4,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x64}, 4, 1, "BIT 4,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x65}, 4, 1, "BIT 4,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x66}, 4, 1, "BIT 4,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x67}, 4, 1, "BIT 4,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x68}, 4, 1, "BIT 5,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x69}, 4, 1, "BIT 5,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x6A}, 4, 1, "BIT 5,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x6B}, 4, 1, "BIT 5,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x6C}, 4, 1, "BIT 5,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x6D}, 4, 1, "BIT 5,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x6E}, 4, 1, "BIT 5,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x6F}, 4, 1, "BIT 5,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x70}, 4, 1, "BIT 6,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x71}, 4, 1, "BIT 6,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x72}, 4, 1, "BIT 6,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x73}, 4, 1, "BIT 6,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x74}, 4, 1, "BIT 6,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x75}, 4, 1, "BIT 6,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x76}, 4, 1, "BIT 6,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x77}, 4, 1, "BIT 6,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x78}, 4, 1, "BIT 7,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x79}, 4, 1, "BIT 7,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x7A}, 4, 1, "BIT 7,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x7B}, 4, 1, "BIT 7,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x7C}, 4, 1, "BIT 7,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x7D}, 4, 1, "BIT 7,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x7E}, 4, 1, "BIT 7,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x7F}, 4, 1, "BIT 7,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x80}, 4, 1, "RES 0,(IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0x81}, 4, 1, "RES 0,(IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0x82}, 4, 1, "RES 0,(IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0x83}, 4, 1, "RES 0,(IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0x84}, 4, 1, "RES 0,(IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0x85}, 4, 1, "RES 0,(IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0x86}, 4, 1, "RES 0,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x87}, 4, 1, "RES 0,(IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0x88}, 4, 1, "RES 1,(IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0x89}, 4, 1, "RES 1,(IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0x8A}, 4, 1, "RES 1,(IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0x8B}, 4, 1, "RES 1,(IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0x8C}, 4, 1, "RES 1,(IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0x8D}, 4, 1, "RES 1,(IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0x8E}, 4, 1, "RES 1,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x8F}, 4, 1, "RES 1,(IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0x90}, 4, 1, "RES 2,(IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0x91}, 4, 1, "RES 2,(IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0x92}, 4, 1, "RES 2,(IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0x93}, 4, 1, "RES 2,(IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0x94}, 4, 1, "RES 2,(IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0x95}, 4, 1, "RES 2,(IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0x96}, 4, 1, "RES 2,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x97}, 4, 1, "RES 2,(IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0x98}, 4, 1, "RES 3,(IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0x99}, 4, 1, "RES 3,(IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0x9A}, 4, 1, "RES 3,(IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0x9B}, 4, 1, "RES 3,(IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0x9C}, 4, 1, "RES 3,(IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0x9D}, 4, 1, "RES 3,(IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0x9E}, 4, 1, "RES 3,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0x9F}, 4, 1, "RES 3,(IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0xA0}, 4, 1, "RES 4,(IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0xA1}, 4, 1, "RES 4,(IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0xA2}, 4, 1, "RES 4,(IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0xA3}, 4, 1, "RES 4,(IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0xA4}, 4, 1, "RES 4,(IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0xA5}, 4, 1, "RES 4,(IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0xA6}, 4, 1, "RES 4,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0xA7}, 4, 1, "RES 4,(IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0xA8}, 4, 1, "RES 5,(IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0xA9}, 4, 1, "RES 5,(IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0xAA}, 4, 1, "RES 5,(IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0xAB}, 4, 1, "RES 5,(IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0xAC}, 4, 1, "RES 5,(IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0xAD}, 4, 1, "RES 5,(IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0xAE}, 4, 1, "RES 5,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0xAF}, 4, 1, "RES 5,(IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0xB0}, 4, 1, "RES 6,(IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0xB1}, 4, 1, "RES 6,(IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0xB2}, 4, 1, "RES 6,(IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0xB3}, 4, 1, "RES 6,(IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0xB4}, 4, 1, "RES 6,(IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0xB5}, 4, 1, "RES 6,(IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0xB6}, 4, 1, "RES 6,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0xB7}, 4, 1, "RES 6,(IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0xB8}, 4, 1, "RES 7,(IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0xB9}, 4, 1, "RES 7,(IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0xBA}, 4, 1, "RES 7,(IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0xBB}, 4, 1, "RES 7,(IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0xBC}, 4, 1, "RES 7,(IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0xBD}, 4, 1, "RES 7,(IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0xBE}, 4, 1, "RES 7,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0xBF}, 4, 1, "RES 7,(IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0xC0}, 4, 1, "SET 0,(IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0xC1}, 4, 1, "SET 0,(IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0xC2}, 4, 1, "SET 0,(IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0xC3}, 4, 1, "SET 0,(IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0xC4}, 4, 1, "SET 0,(IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0xC5}, 4, 1, "SET 0,(IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0xC6}, 4, 1, "SET 0,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0xC7}, 4, 1, "SET 0,(IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0xC8}, 4, 1, "SET 1,(IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0xC9}, 4, 1, "SET 1,(IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0xCA}, 4, 1, "SET 1,(IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0xCB}, 4, 1, "SET 1,(IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0xCC}, 4, 1, "SET 1,(IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0xCD}, 4, 1, "SET 1,(IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0xCE}, 4, 1, "SET 1,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0xCF}, 4, 1, "SET 1,(IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0xD0}, 4, 1, "SET 2,(IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0xD1}, 4, 1, "SET 2,(IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0xD2}, 4, 1, "SET 2,(IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0xD3}, 4, 1, "SET 2,(IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0xD4}, 4, 1, "SET 2,(IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0xD5}, 4, 1, "SET 2,(IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0xD6}, 4, 1, "SET 2,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0xD7}, 4, 1, "SET 2,(IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0xD8}, 4, 1, "SET 3,(IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0xD9}, 4, 1, "SET 3,(IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0xDA}, 4, 1, "SET 3,(IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0xDB}, 4, 1, "SET 3,(IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0xDC}, 4, 1, "SET 3,(IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0xDD}, 4, 1, "SET 3,(IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0xDE}, 4, 1, "SET 3,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0xDF}, 4, 1, "SET 3,(IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0xE0}, 4, 1, "SET 4,(IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0xE1}, 4, 1, "SET 4,(IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0xE2}, 4, 1, "SET 4,(IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0xE3}, 4, 1, "SET 4,(IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0xE4}, 4, 1, "SET 4,(IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0xE5}, 4, 1, "SET 4,(IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0xE6}, 4, 1, "SET 4,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0xE7}, 4, 1, "SET 4,(IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0xE8}, 4, 1, "SET 5,(IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0xE9}, 4, 1, "SET 5,(IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0xEA}, 4, 1, "SET 5,(IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0xEB}, 4, 1, "SET 5,(IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0xEC}, 4, 1, "SET 5,(IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0xED}, 4, 1, "SET 5,(IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0xEE}, 4, 1, "SET 5,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0xEF}, 4, 1, "SET 5,(IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0xF0}, 4, 1, "SET 6,(IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0xF1}, 4, 1, "SET 6,(IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0xF2}, 4, 1, "SET 6,(IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0xF3}, 4, 1, "SET 6,(IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0xF4}, 4, 1, "SET 6,(IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0xF5}, 4, 1, "SET 6,(IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0xF6}, 4, 1, "SET 6,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0xF7}, 4, 1, "SET 6,(IY+d) -> A"},
-  {{0xFD, 0xCB, 0x00, 0xF8}, 4, 1, "SET 7,(IY+d) -> B"},
-  {{0xFD, 0xCB, 0x00, 0xF9}, 4, 1, "SET 7,(IY+d) -> C"},
-  {{0xFD, 0xCB, 0x00, 0xFA}, 4, 1, "SET 7,(IY+d) -> D"},
-  {{0xFD, 0xCB, 0x00, 0xFB}, 4, 1, "SET 7,(IY+d) -> E"},
-  {{0xFD, 0xCB, 0x00, 0xFC}, 4, 1, "SET 7,(IY+d) -> H"},
-  {{0xFD, 0xCB, 0x00, 0xFD}, 4, 1, "SET 7,(IY+d) -> L"},
-  {{0xFD, 0xCB, 0x00, 0xFE}, 4, 1, "SET 7,(IY+d)"},
-  {{0xFD, 0xCB, 0x00, 0xFF}, 4, 1, "SET 7,(IY+d) -> A"},
-};
-const size_t opcode_table_size = sizeof(opcode_table) / sizeof(opcode_table[0]);
@@ -24,20 +24,21 @@
 #include <string.h>
 
 #include "cpu.h"
+#include "disasm.h"
+#include "flags.h"
 #include "memory.h"
 #include "register.h"
 
+// Indexed by the 3-bit register field of an opcode; 6 encodes (HL).
 static const uint8_t _reg_map[] = {REG_B, REG_C, REG_D, REG_E,
-                                   REG_H, REG_L, REG_A};
+                                   REG_H, REG_L, 0xFF,  REG_A};
 
 int register_init(cpu_t *cpu) {
-  size_t register_size = sizeof(z80_register_t) * REG_COUNT;
-
   if (!cpu)
     return -1;
 
-  memset(cpu->registers, 0, register_size);
-  memset(cpu->alt_registers, 0, register_size);
+  memset(&cpu->registers, 0, sizeof(cpu->registers));
+  memset(&cpu->alt_registers, 0, sizeof(cpu->alt_registers));
 
   return 0;
 }
@@ -46,8 +47,8 @@ int register_destroy(cpu_t *cpu) {
   if (!cpu)
     return 0;
 
-  memset(cpu->registers, 0, sizeof(cpu->registers));
-  memset(cpu->alt_registers, 0, sizeof(cpu->alt_registers));
+  memset(&cpu->registers, 0, sizeof(cpu->registers));
+  memset(&cpu->alt_registers, 0, sizeof(cpu->alt_registers));
   return 0;
 }
 
@@ -77,12 +78,16 @@ int register_value_set(cpu_t *cpu, uint8_t index, uint16_t value) {
   if (real_index >= REG_COUNT)
     return -1;
 
+  // A direct write to F replaces anything still pending.
+  if (real_index == REG_AF && !(index & HIGH_BYTE))
+    cpu->flags.kind = FLAGS_NONE;
+
   if (index & HIGH_BYTE) {
-    cpu->registers[real_index].bytes.high = value;
+    cpu->registers.pairs[real_index].bytes.high = value;
   } else if (index & LOW_BYTE) {
-    cpu->registers[real_index].bytes.low = value;
+    cpu->registers.pairs[real_index].bytes.low = value;
   } else {
-    cpu->registers[real_index].word = value;
+    cpu->registers.pairs[real_index].word = value;
   }
   return 0;
 }
@@ -114,12 +119,15 @@ uint16_t register_value_get(cpu_t *cpu, uint8_t index) {
   if (real_index >= REG_COUNT)
     return return_value;
 
+  if (real_index == REG_AF && !(index & HIGH_BYTE))
+    flags_materialize(cpu);
+
   if (index & HIGH_BYTE) {
-    return_value = cpu->registers[real_index].bytes.high;
+    return_value = cpu->registers.pairs[real_index].bytes.high;
   } else if (index & LOW_BYTE) {
-    return_value = cpu->registers[real_index].bytes.low;
+    return_value = cpu->registers.pairs[real_index].bytes.low;
   } else {
-    return_value = cpu->registers[real_index].word;
+    return_value = cpu->registers.pairs[real_index].word;
   }
   return return_value;
 }
@@ -134,11 +142,11 @@ void register_inc(cpu_t *cpu, uint8_t index) {
     return;
 
   if (index & HIGH_BYTE) {
-    cpu->registers[real_index].bytes.high++;
+    cpu->registers.pairs[real_index].bytes.high++;
   } else if (index & LOW_BYTE) {
-    cpu->registers[real_index].bytes.low++;
+    cpu->registers.pairs[real_index].bytes.low++;
   } else {
-    cpu->registers[real_index].word++;
+    cpu->registers.pairs[real_index].word++;
   }
   return;
 }
@@ -153,11 +161,11 @@ void register_dec(cpu_t *cpu, uint8_t index) {
     return;
 
   if (index & HIGH_BYTE) {
-    cpu->registers[real_index].bytes.high--;
+    cpu->registers.pairs[real_index].bytes.high--;
   } else if (index & LOW_BYTE) {
-    cpu->registers[real_index].bytes.low--;
+    cpu->registers.pairs[real_index].bytes.low--;
   } else {
-    cpu->registers[real_index].word--;
+    cpu->registers.pairs[real_index].word--;
   }
   return;
 }
@@ -177,12 +185,12 @@ static void _dump_memory_window(cpu_t *cpu, uint16_t address) {
     fprintf(stdout, "  %04X  ", row_addr);
     for (uint16_t col = 0; col < 16; col++) {
       uint16_t addr = (uint16_t)(row_addr + col);
-      fprintf(stdout, "%02X ", (uint8_t)cpu->memory.memory[addr]);
+      fprintf(stdout, "%02X ", memory_peek(cpu, addr));
     }
     fprintf(stdout, " |");
     for (uint16_t col = 0; col < 16; col++) {
       uint16_t addr = (uint16_t)(row_addr + col);
-      uint8_t value = (uint8_t)cpu->memory.memory[addr];
+      uint8_t value = memory_peek(cpu, addr);
       fputc(isprint(value) ? value : '.', stdout);
     }
     fprintf(stdout, "|\n");
@@ -195,9 +203,11 @@ void register_swap_single(cpu_t *cpu, uint8_t reg) {
   if (!cpu)
     return;
 
-  temp = cpu->registers[reg];
-  cpu->registers[reg] = cpu->alt_registers[reg];
-  cpu->alt_registers[reg] = temp;
+  if (reg == REG_AF)
+    flags_materialize(cpu);
+  temp = cpu->registers.pairs[reg];
+  cpu->registers.pairs[reg] = cpu->alt_registers.pairs[reg];
+  cpu->alt_registers.pairs[reg] = temp;
 }
 
 void register_exx(cpu_t *cpu) {
@@ -215,9 +225,9 @@ void register_ex_de_hl(cpu_t *cpu) {
   if (!cpu)
     return;
 
-  temp = cpu->registers[REG_DE];
-  cpu->registers[REG_DE] = cpu->registers[REG_HL];
-  cpu->registers[REG_HL] = temp;
+  temp = cpu->registers.pairs[REG_DE];
+  cpu->registers.pairs[REG_DE] = cpu->registers.pairs[REG_HL];
+  cpu->registers.pairs[REG_HL] = temp;
 }
 
 void register_ex_af_af_alt(cpu_t *cpu) {
@@ -226,9 +236,10 @@ void register_ex_af_af_alt(cpu_t *cpu) {
   if (!cpu)
     return;
 
-  temp = cpu->registers[REG_AF];
-  cpu->registers[REG_AF] = cpu->alt_registers[REG_AF];
-  cpu->alt_registers[REG_AF] = temp;
+  flags_materialize(cpu);
+  temp = cpu->registers.pairs[REG_AF];
+  cpu->registers.pairs[REG_AF] = cpu->alt_registers.pairs[REG_AF];
+  cpu->alt_registers.pairs[REG_AF] = temp;
 }
 
 static void register_ex_sp_rr(cpu_t *cpu, uint8_t reg) {
@@ -250,35 +261,38 @@ void register_ex_sp_ix(cpu_t *cpu) { register_ex_sp_rr(cpu, REG_IX); }
 void register_ex_sp_iy(cpu_t *cpu) { register_ex_sp_rr(cpu, REG_IY); }
 
 void register_display(cpu_t *cpu) {
+  char text[64];
+
   if (!cpu)
     return;
 
+  flags_materialize(cpu);
   fprintf(stdout, "\033[2J\033[H");
   fprintf(stdout, "\033[1;36mZ80 CPU State\033[0m\n");
   fprintf(stdout, "AF:%04X  BC:%04X  DE:%04X  HL:%04X  IX:%04X  IY:%04X\n",
-          _register_value_get(cpu->registers, REG_AF),
-          _register_value_get(cpu->registers, REG_BC),
-          _register_value_get(cpu->registers, REG_DE),
-          _register_value_get(cpu->registers, REG_HL),
-          _register_value_get(cpu->registers, REG_IX),
-          _register_value_get(cpu->registers, REG_IY));
+          _register_value_get(cpu->registers.pairs, REG_AF),
+          _register_value_get(cpu->registers.pairs, REG_BC),
+          _register_value_get(cpu->registers.pairs, REG_DE),
+          _register_value_get(cpu->registers.pairs, REG_HL),
+          _register_value_get(cpu->registers.pairs, REG_IX),
+          _register_value_get(cpu->registers.pairs, REG_IY));
   fprintf(stdout, "SP:%04X  PC:%04X  IR:%04X  ",
-          _register_value_get(cpu->registers, REG_SP),
-          _register_value_get(cpu->registers, REG_PC),
-          _register_value_get(cpu->registers, REG_IR));
-  _flag_display(_register_value_get(cpu->registers, REG_F) & 0xFF);
+          _register_value_get(cpu->registers.pairs, REG_SP),
+          _register_value_get(cpu->registers.pairs, REG_PC),
+          _register_value_get(cpu->registers.pairs, REG_IR));
+  _flag_display(_register_value_get(cpu->registers.pairs, REG_F) & 0xFF);
   fprintf(stdout, "\n\n");
 
   fprintf(stdout, "\033[1;34mAlt Registers\033[0m\n");
   fprintf(stdout, "AF':%04X  BC':%04X  DE':%04X  HL':%04X\n\n",
-          _register_value_get(cpu->alt_registers, REG_AF),
-          _register_value_get(cpu->alt_registers, REG_BC),
-          _register_value_get(cpu->alt_registers, REG_DE),
-          _register_value_get(cpu->alt_registers, REG_HL));
+          _register_value_get(cpu->alt_registers.pairs, REG_AF),
+          _register_value_get(cpu->alt_registers.pairs, REG_BC),
+          _register_value_get(cpu->alt_registers.pairs, REG_DE),
+          _register_value_get(cpu->alt_registers.pairs, REG_HL));
 
   fprintf(stdout, "\033[1;33mInstruction\033[0m\n");
-  if (cpu->last_instruction[0] != '\0') {
-    fprintf(stdout, "  %s\n\n", cpu->last_instruction);
+  if (disasm_last(cpu, text, sizeof(text)) >= 0) {
+    fprintf(stdout, "  %04X  %s\n\n", cpu->last_instruction.address, text);
   } else {
     fprintf(stdout, "  (none)\n\n");
   }
@@ -307,13 +321,13 @@ void register_bit_set(cpu_t *cpu, uint8_t index, uint8_t bit) {
   register_value_set(cpu, index, new_value);
 }
 void register_bit_unset(cpu_t *cpu, uint8_t index, uint8_t bit) {
-  uint8_t current_value = register_value_get(cpu, REG_F) & 0x00FF;
+  uint8_t current_value = register_value_get(cpu, index) & 0x00FF;
   uint8_t new_value = current_value & ~(1 << bit);
   register_value_set(cpu, index, new_value);
 }
 
 uint8_t register_bit_get(cpu_t *cpu, uint8_t index, uint8_t bit) {
-  uint8_t current_value = register_value_get(cpu, REG_F) & 0x00FF;
+  uint8_t current_value = register_value_get(cpu, index) & 0x00FF;
   return ((current_value & (1 << bit)) > 0);
 }
 
@@ -322,7 +336,7 @@ void register_flag_set(cpu_t *cpu, uint8_t flag) {
 }
 
 void register_flag_unset(cpu_t *cpu, uint8_t flag) {
-  register_bit_set(cpu, REG_F, flag);
+  register_bit_unset(cpu, REG_F, flag);
 }
 
 uint8_t register_map(uint8_t index) {
@@ -0,0 +1,183 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cpu.h"
+#include "scheduler.h"
+
+#define SCHEDULER_INITIAL_CAPACITY 16
+
+static int event_before(const scheduler_event_t *a,
+                        const scheduler_event_t *b) {
+  return a->when < b->when || (a->when == b->when && a->seq < b->seq);
+}
+
+static void heap_swap(scheduler_event_t *events, uint32_t i, uint32_t j) {
+  scheduler_event_t tmp = events[i];
+
+  events[i] = events[j];
+  events[j] = tmp;
+}
+
+static void heap_up(z80_scheduler_t *scheduler, uint32_t i) {
+  while (i > 0) {
+    uint32_t parent = (i - 1) / 2;
+
+    if (!event_before(&scheduler->events[i], &scheduler->events[parent]))
+      break;
+    heap_swap(scheduler->events, i, parent);
+    i = parent;
+  }
+}
+
+static void heap_down(z80_scheduler_t *scheduler, uint32_t i) {
+  while (1) {
+    uint32_t left = 2 * i + 1;
+    uint32_t right = left + 1;
+    uint32_t first = i;
+
+    if (left < scheduler->count &&
+        event_before(&scheduler->events[left], &scheduler->events[first]))
+      first = left;
+    if (right < scheduler->count &&
+        event_before(&scheduler->events[right], &scheduler->events[first]))
+      first = right;
+    if (first == i)
+      break;
+    heap_swap(scheduler->events, i, first);
+    i = first;
+  }
+}
+
+static void heap_remove(z80_scheduler_t *scheduler, uint32_t i) {
+  scheduler->count--;
+  if (i != scheduler->count) {
+    scheduler->events[i] = scheduler->events[scheduler->count];
+    heap_up(scheduler, i);
+    heap_down(scheduler, i);
+  }
+}
+
+int scheduler_init(cpu_t *cpu) {
+  if (!cpu)
+    return -1;
+
+  memset(&cpu->scheduler, 0, sizeof(cpu->scheduler));
+  cpu->scheduler.next_event = SCHEDULER_NONE;
+  cpu->scheduler.next_id = 1;
+  return 0;
+}
+
+void scheduler_destroy(cpu_t *cpu) {
+  if (!cpu)
+    return;
+
+  free(cpu->scheduler.events);
+  cpu->scheduler.events = NULL;
+  cpu->scheduler.count = 0;
+  cpu->scheduler.capacity = 0;
+  cpu->scheduler.next_event = SCHEDULER_NONE;
+}
+
+// Schedule callback at an absolute T-state. Returns an id for
+// scheduler_cancel, or -1. An event already due fires after the current
+// instruction.
+int scheduler_at(cpu_t *cpu, uint64_t when, scheduler_callback_t callback,
+                 void *context) {
+  z80_scheduler_t *scheduler = NULL;
+  scheduler_event_t *event = NULL;
+  int id = 0;
+
+  if (!cpu || !callback)
+    return -1;
+
+  scheduler = &cpu->scheduler;
+  if (scheduler->count == scheduler->capacity) {
+    uint32_t capacity = scheduler->capacity ? scheduler->capacity * 2
+                                            : SCHEDULER_INITIAL_CAPACITY;
+    scheduler_event_t *events = (scheduler_event_t *)realloc(
+        scheduler->events, capacity * sizeof(scheduler_event_t));
+
+    if (!events) {
+      fprintf(stderr, "Cannot allocate scheduler events\n");
+      return -1;
+    }
+    scheduler->events = events;
+    scheduler->capacity = capacity;
+  }
+
+  event = &scheduler->events[scheduler->count];
+  event->when = when;
+  event->seq = scheduler->seq++;
+  event->id = id = scheduler->next_id;
+  event->callback = callback;
+  event->context = context;
+  scheduler->next_id =
+      scheduler->next_id == INT32_MAX ? 1 : scheduler->next_id + 1;
+
+  heap_up(scheduler, scheduler->count++);
+  if (when < scheduler->next_event)
+    scheduler->next_event = when;
+  return id;
+}
+
+int scheduler_after(cpu_t *cpu, uint64_t tstates,
+                    scheduler_callback_t callback, void *context) {
+  if (!cpu)
+    return -1;
+
+  return scheduler_at(cpu, cpu->clock.cycles + tstates, callback, context);
+}
+
+// A cancelled event may leave next_event early; that only costs one
+// cpu_service call that finds nothing due.
+int scheduler_cancel(cpu_t *cpu, int id) {
+  if (!cpu || id <= 0)
+    return -1;
+
+  for (uint32_t i = 0; i < cpu->scheduler.count; i++) {
+    if (cpu->scheduler.events[i].id == id) {
+      heap_remove(&cpu->scheduler, i);
+      return 0;
+    }
+  }
+  return -1;
+}
+
+uint64_t scheduler_next(cpu_t *cpu) {
+  return cpu->scheduler.count ? cpu->scheduler.events[0].when : SCHEDULER_NONE;
+}
+
+// Run every event that is due, earliest first. Each event leaves the heap
+// before its callback runs, so the callback can reschedule itself.
+void scheduler_dispatch(cpu_t *cpu) {
+  z80_scheduler_t *scheduler = &cpu->scheduler;
+
+  while (scheduler->count > 0 &&
+         scheduler->events[0].when <= cpu->clock.cycles) {
+    scheduler_event_t event = scheduler->events[0];
+
+    heap_remove(scheduler, 0);
+    scheduler->dispatched++;
+    event.callback(cpu, event.context, event.when);
+  }
+}
@@ -231,3 +231,33 @@ const uint8_t test_program[] = {
 };
 
 const size_t test_program_size = sizeof(test_program);
+
+// Dispatch benchmark: 64 x 256 x 256 passes over a 12-instruction inner loop
+// mixing loads, ALU, stack and call/return (about 50M instructions).
+const uint8_t bench_program[] = {
+    0x31, 0x00, 0xF0, // 0000 LD SP,0xF000
+    0x21, 0x00, 0x80, // 0003 LD HL,0x8000
+    0x16, 0x40,       // 0006 LD D,0x40
+    0x0E, 0x00,       // 0008 LD C,0x00
+    0x06, 0x00,       // 000A LD B,0x00
+    0x7E,             // 000C LD A,(HL)
+    0x80,             // 000D ADD A,B
+    0x77,             // 000E LD (HL),A
+    0x2C,             // 000F INC L
+    0xC5,             // 0010 PUSH BC
+    0xCD, 0x20, 0x00, // 0011 CALL 0x0020
+    0xC1,             // 0014 POP BC
+    0x05,             // 0015 DEC B
+    0x20, 0xF4,       // 0016 JR NZ,0x000C
+    0x0D,             // 0018 DEC C
+    0x20, 0xEF,       // 0019 JR NZ,0x000A
+    0x15,             // 001B DEC D
+    0x20, 0xEA,       // 001C JR NZ,0x0008
+    0x76,             // 001E HALT
+    0x00,             // 001F NOP
+    0xAF,             // 0020 XOR A
+    0x3C,             // 0021 INC A
+    0xC9              // 0022 RET
+};
+
+const size_t bench_program_size = sizeof(bench_program);
@@ -0,0 +1,308 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Self-check: block instructions that overwrite their own code. Each case
+// loads HL, DE and BC, runs one of LDIR/LDDR/INIR/INDR and halts, with the
+// copy or the port input landing on or around the block instruction itself.
+// The same case runs one instruction at a time with cpu_step, under cpu_run
+// without the block cache, under cpu_run with it, and with the JIT when the
+// host has one. Exit reason, registers, instruction and T-state counts, port
+// output and all of memory must agree across the runs.
+//
+// A fixed case checks the result itself as well: an LDIR whose first store
+// replaces its own ED prefix has to stop there and run the new bytes.
+//
+// Usage: block_check [cases]
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "block.h"
+#include "cpu.h"
+#include "flags.h"
+#include "jit.h"
+#include "register.h"
+
+#define CODE_ADDRESS 0x4000
+#define BLOCK_OFFSET 9 // LD HL,nn; LD DE,nn; LD BC,nn come first
+#define NEAR 16        // How far from the block instruction stores start
+#define BUDGET 2000
+
+typedef enum {
+  MODE_STEP,
+  MODE_RUN,
+  MODE_BLOCKS,
+  MODE_JIT,
+  MODE_COUNT
+} run_mode_t;
+
+static const char *mode_names[MODE_COUNT] = {"cpu_step", "cpu_run",
+                                             "block cache", "JIT"};
+
+// Port input is a fixed sequence and port output is folded into a hash, so
+// runs that perform the same I/O in the same order see and leave the same.
+typedef struct {
+  uint32_t input;
+  uint32_t output;
+} port_state_t;
+
+typedef struct {
+  cpu_exit_t reason;
+  z80_register_file_t registers;
+  z80_register_file_t alt_registers;
+  uint64_t instructions;
+  uint64_t cycles;
+  uint32_t output;
+  uint32_t memory;
+} outcome_t;
+
+static uint32_t next_random(uint32_t *state) {
+  uint32_t x = *state;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return x;
+}
+
+static uint8_t port_read(void *context, uint16_t port) {
+  port_state_t *ports = (port_state_t *)context;
+
+  (void)port;
+  return (uint8_t)(next_random(&ports->input) >> 24);
+}
+
+static void port_write(void *context, uint16_t port, uint8_t value) {
+  port_state_t *ports = (port_state_t *)context;
+
+  ports->output = (ports->output ^ ((uint32_t)port << 8 | value)) * 16777619u;
+}
+
+static uint32_t memory_hash(cpu_t *cpu) {
+  uint32_t hash = 2166136261u;
+
+  for (uint32_t address = 0; address < 0x10000; address++)
+    hash = (hash ^ memory_peek(cpu, (uint16_t)address)) * 16777619u;
+  return hash;
+}
+
+// Run image from PC = CODE_ADDRESS in the given mode.
+static int run_case(const uint8_t *image, run_mode_t mode,
+                    outcome_t *outcome) {
+  cpu_t *cpu = (cpu_t *)calloc(1, sizeof(cpu_t));
+  port_state_t ports = {0x13579BDFu, 2166136261u};
+  int status = -1;
+
+  if (!cpu || cpu_init(cpu, 0x10000) != 0)
+    goto done;
+  cpu->idle_detect = false;
+  // Load with the cache off so the load does not flush anything.
+  block_cache_destroy(cpu);
+  if (memory_load_at(cpu, image, 0x10000, 0) != 0)
+    goto done;
+  if (mode >= MODE_BLOCKS && block_cache_init(cpu) != 0)
+    goto done;
+  if (mode == MODE_JIT && jit_init(cpu) != 0)
+    goto done;
+  cpu_io_attach(cpu, port_read, port_write, &ports);
+  register_value_set(cpu, REG_PC, CODE_ADDRESS);
+
+  if (mode == MODE_STEP) {
+    outcome->reason = CPU_EXIT_BUDGET;
+    while (cpu->instructions < BUDGET) {
+      cpu_exit_t reason = cpu_step(cpu);
+
+      if (reason != CPU_EXIT_NONE) {
+        outcome->reason = reason;
+        break;
+      }
+    }
+  } else {
+    outcome->reason = cpu_run(cpu, BUDGET);
+  }
+
+  flags_materialize(cpu);
+  outcome->registers = cpu->registers;
+  outcome->alt_registers = cpu->alt_registers;
+  outcome->instructions = cpu->instructions;
+  outcome->cycles = cpu->clock.cycles;
+  outcome->output = ports.output;
+  outcome->memory = memory_hash(cpu);
+  status = 0;
+
+done:
+  if (cpu)
+    cpu_destroy(cpu);
+  free(cpu);
+  return status;
+}
+
+static bool outcome_matches(const outcome_t *a, const outcome_t *b) {
+  return a->reason == b->reason &&
+         memcmp(&a->registers, &b->registers, sizeof(a->registers)) == 0 &&
+         memcmp(&a->alt_registers, &b->alt_registers,
+                sizeof(a->alt_registers)) == 0 &&
+         a->instructions == b->instructions && a->cycles == b->cycles &&
+         a->output == b->output && a->memory == b->memory;
+}
+
+static void outcome_print(const char *name, const outcome_t *outcome) {
+  fprintf(stderr,
+          "  %-11s %s PC=%04X AF=%04X BC=%04X DE=%04X HL=%04X"
+          " %" PRIu64 " instructions %" PRIu64 " T-states memory %08X\n",
+          name, cpu_exit_name(outcome->reason), outcome->registers.pc,
+          outcome->registers.af, outcome->registers.bc, outcome->registers.de,
+          outcome->registers.hl, outcome->instructions, outcome->cycles,
+          outcome->memory);
+}
+
+// Run image in every mode and compare each run with cpu_step's.
+static int check_case(const char *name, const uint8_t *image, bool jit,
+                      outcome_t *reference) {
+  outcome_t outcomes[MODE_COUNT];
+  run_mode_t last = jit ? MODE_JIT : MODE_BLOCKS;
+
+  for (run_mode_t mode = MODE_STEP; mode <= last; mode++) {
+    if (run_case(image, mode, &outcomes[mode]) != 0) {
+      fprintf(stderr, "%s: cannot run with %s\n", name, mode_names[mode]);
+      return -1;
+    }
+    if (!outcome_matches(&outcomes[MODE_STEP], &outcomes[mode])) {
+      fprintf(stderr, "%s: %s differs from cpu_step\n", name,
+              mode_names[mode]);
+      outcome_print(mode_names[MODE_STEP], &outcomes[MODE_STEP]);
+      outcome_print(mode_names[mode], &outcomes[mode]);
+      return -1;
+    }
+  }
+  if (reference)
+    *reference = outcomes[MODE_STEP];
+  return 0;
+}
+
+// LD HL,hl; LD DE,de; LD BC,bc; ED op; HALT at CODE_ADDRESS.
+static void image_code(uint8_t *image, uint16_t hl, uint16_t de, uint16_t bc,
+                       uint8_t op) {
+  const uint8_t code[] = {0x21, (uint8_t)hl, (uint8_t)(hl >> 8),
+                          0x11, (uint8_t)de, (uint8_t)(de >> 8),
+                          0x01, (uint8_t)bc, (uint8_t)(bc >> 8),
+                          0xED, op,          0x76};
+
+  memcpy(image + CODE_ADDRESS, code, sizeof(code));
+}
+
+// LDIR copies NOP NOP NOP HALT onto itself. The first store turns the ED
+// prefix into a NOP, so the run has to go NOP, OR B (the old B0 operand),
+// HALT. Copying all four bytes in one go would reach the HALT a byte later.
+static int check_ldir_own_opcode(bool jit) {
+  static uint8_t image[0x10000];
+  const uint16_t block = CODE_ADDRESS + BLOCK_OFFSET;
+  const uint8_t source[] = {0x00, 0x00, 0x00, 0x76};
+  outcome_t outcome;
+
+  memset(image, 0x76, sizeof(image));
+  image_code(image, 0x8000, block, sizeof(source), 0xB0);
+  memcpy(image + 0x8000, source, sizeof(source));
+  if (check_case("LDIR onto its own opcode", image, jit, &outcome) != 0)
+    return -1;
+
+  if (outcome.reason != CPU_EXIT_HALT ||
+      outcome.registers.pc != block + 3 ||
+      outcome.registers.bc != sizeof(source) - 1 ||
+      outcome.registers.de != block + 1 || outcome.registers.hl != 0x8001 ||
+      outcome.instructions != 7) {
+    fprintf(stderr, "LDIR onto its own opcode did not stop there\n");
+    outcome_print("result", &outcome);
+    return -1;
+  }
+  return 0;
+}
+
+// Random memory, and a block instruction whose stores start within NEAR
+// bytes of itself.
+static void image_random(uint8_t *image, uint32_t *state) {
+  static const uint8_t ops[] = {0xB0, 0xB8, 0xB2, 0xBA};
+  const uint16_t block = CODE_ADDRESS + BLOCK_OFFSET;
+  uint32_t r = 0;
+  uint16_t near = 0;
+  uint16_t far = 0;
+  uint16_t bc = 0;
+  uint8_t op = 0;
+
+  for (uint32_t address = 0; address < 0x10000; address += 4) {
+    r = next_random(state);
+    memcpy(image + address, &r, sizeof(r));
+  }
+
+  r = next_random(state);
+  op = ops[r & 3];
+  near = (uint16_t)(block - NEAR + (r >> 2) % (2 * NEAR));
+  far = (uint16_t)(r >> 16);
+  bc = (uint16_t)(1 + (next_random(state) >> 8) % 32);
+  if (op == 0xB2 || op == 0xBA) {
+    // INIR/INDR store at HL and count in B.
+    image_code(image, near, far, (uint16_t)(bc << 8 | (r >> 8 & 0xFF)), op);
+  } else {
+    image_code(image, far, near, bc, op);
+  }
+}
+
+int main(int argc, char *argv[]) {
+  static uint8_t image[0x10000];
+  uint64_t cases = 500;
+  uint32_t state = 0x1F2E3D4Cu;
+  bool jit = false;
+  cpu_t probe;
+
+  if (argc > 1) {
+    char *end = NULL;
+
+    cases = strtoull(argv[1], &end, 10);
+    if (*end != '\0' || cases == 0) {
+      fprintf(stderr, "Usage: %s [cases]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  // Compare against the JIT only where it can be switched on.
+  memset(&probe, 0, sizeof(probe));
+  if (cpu_init(&probe, 0x10000) == 0) {
+    jit = jit_init(&probe) == 0;
+    cpu_destroy(&probe);
+  }
+
+  if (check_ldir_own_opcode(jit) != 0)
+    return 1;
+
+  for (uint64_t i = 0; i < cases; i++) {
+    char name[32];
+
+    image_random(image, &state);
+    snprintf(name, sizeof(name), "case %" PRIu64, i);
+    if (check_case(name, image, jit, NULL) != 0)
+      return 1;
+  }
+
+  fprintf(stdout, "%" PRIu64 " cases, all runs agree%s\n", cases + 1,
+          jit ? " (JIT included)" : "");
+  return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Microbenchmark: flags from the generated lookup tables versus the
+// reference formulas, per ALU group. Both sides consume the same
+// pseudo-random operand stream and must agree on every result.
+//
+// Usage: flag_bench [iterations]
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "clock.h"
+#include "flag_formulas.h"
+#include "flag_tables.h"
+
+#define GROUP_COUNT 5
+
+typedef enum { GROUP_ADD, GROUP_ADC, GROUP_SUB, GROUP_SBC, GROUP_SZP } group_t;
+
+static const char *group_names[GROUP_COUNT] = {"ADD", "ADC", "SUB/CP", "SBC",
+                                               "AND/OR/XOR/rot"};
+
+static uint32_t next_random(uint32_t *state) {
+  uint32_t x = *state;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return x;
+}
+
+static uint8_t computed(group_t group, uint8_t a, uint8_t value,
+                        uint8_t carry) {
+  switch (group) {
+  case GROUP_ADD:
+    return formula_add(a, value, 0);
+  case GROUP_ADC:
+    return formula_add(a, value, carry);
+  case GROUP_SUB:
+    return formula_sub(a, value, 0);
+  case GROUP_SBC:
+    return formula_sub(a, value, carry);
+  default:
+    return formula_szp((uint8_t)(a & value));
+  }
+}
+
+static uint8_t table(group_t group, uint8_t a, uint8_t value, uint8_t carry) {
+  switch (group) {
+  case GROUP_ADD:
+    return flags_add[FLAG_TABLE_INDEX(a, value, 0)];
+  case GROUP_ADC:
+    return flags_add[FLAG_TABLE_INDEX(a, value, carry)];
+  case GROUP_SUB:
+    return flags_sub[FLAG_TABLE_INDEX(a, value, 0)];
+  case GROUP_SBC:
+    return flags_sub[FLAG_TABLE_INDEX(a, value, carry)];
+  default:
+    return flags_szp[(uint8_t)(a & value)];
+  }
+}
+
+static uint64_t run(group_t group, uint64_t iterations, int use_table,
+                    uint32_t *checksum) {
+  uint32_t state = 0x12345678u;
+  uint32_t sum = 0;
+  uint64_t start = clock_host_ns();
+
+  for (uint64_t i = 0; i < iterations; i++) {
+    uint32_t r = next_random(&state);
+    uint8_t a = (uint8_t)r;
+    uint8_t value = (uint8_t)(r >> 8);
+    uint8_t carry = (uint8_t)((r >> 16) & 1);
+
+    sum = sum * 31 + (use_table ? table(group, a, value, carry)
+                                : computed(group, a, value, carry));
+  }
+
+  *checksum = sum;
+  return clock_host_ns() - start;
+}
+
+int main(int argc, char *argv[]) {
+  uint64_t iterations = 50000000;
+  int status = 0;
+
+  if (argc > 1) {
+    char *end = NULL;
+
+    iterations = strtoull(argv[1], &end, 10);
+    if (*end != '\0' || iterations == 0) {
+      fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  fprintf(stdout, "%-16s %12s %12s %8s\n", "group", "computed ns",
+          "table ns", "speedup");
+  for (int g = 0; g < GROUP_COUNT; g++) {
+    uint32_t computed_sum = 0;
+    uint32_t table_sum = 0;
+    uint64_t computed_ns = run((group_t)g, iterations, 0, &computed_sum);
+    uint64_t table_ns = run((group_t)g, iterations, 1, &table_sum);
+
+    if (computed_sum != table_sum) {
+      fprintf(stderr, "%s: table and formula disagree\n", group_names[g]);
+      status = 1;
+    }
+    fprintf(stdout, "%-16s %12.3f %12.3f %7.2fx\n", group_names[g],
+            (double)computed_ns / (double)iterations,
+            (double)table_ns / (double)iterations,
+            table_ns ? (double)computed_ns / (double)table_ns : 0.0);
+  }
+
+  return status;
+}
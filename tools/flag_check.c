@@ -0,0 +1,263 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Self-check: lazy and eager flags must agree bit for bit. Two CPUs, one
+// with lazy_flags on and one with it off, run the same pseudo-random ALU
+// instructions one at a time from the same starting state. After every
+// instruction the registers (F included), the alternate set and the memory
+// the instruction could have written are compared. The lazy CPU's pending
+// flags are put back after each comparison, so chains of deferred updates
+// are exercised as they would be in a real run.
+//
+// Usage: flag_check [instructions]
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "block.h"
+#include "cpu.h"
+#include "flags.h"
+#include "register.h"
+
+#define SEQUENCE_LENGTH 64
+#define CODE_ADDRESS 0x0000
+#define WINDOW 4
+
+static uint32_t next_random(uint32_t *state) {
+  uint32_t x = *state;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return x;
+}
+
+// Unprefixed opcodes that set or read flags and never branch.
+static const uint8_t main_ops[] = {
+    0x04, 0x05, 0x0C, 0x0D, 0x14, 0x15, 0x1C, 0x1D, 0x24, 0x25, 0x2C,
+    0x2D, 0x34, 0x35, 0x3C, 0x3D, 0x07, 0x0F, 0x17, 0x1F, 0x27, 0x2F,
+    0x37, 0x3F, 0x09, 0x19, 0x29, 0x39, 0x08, 0xD9, 0xF5, 0xF1};
+static const uint8_t main_n_ops[] = {0xC6, 0xCE, 0xD6, 0xDE, 0xE6, 0xEE,
+                                     0xF6, 0xFE, 0x06, 0x0E, 0x16, 0x1E,
+                                     0x26, 0x2E, 0x36, 0x3E};
+static const uint8_t ed_ops[] = {0x44, 0x42, 0x4A, 0x52, 0x5A, 0x62, 0x6A,
+                                 0x72, 0x7A, 0x67, 0x6F, 0xA0, 0xA1, 0xA8,
+                                 0xA9, 0x57, 0x5F};
+static const uint8_t index_d_ops[] = {0x86, 0x8E, 0x96, 0x9E, 0xA6,
+                                      0xAE, 0xB6, 0xBE, 0x34, 0x35};
+static const uint8_t index_ops[] = {0x09, 0x19, 0x29, 0x39};
+
+#define COUNT(array) (sizeof(array) / sizeof((array)[0]))
+
+// Write one random instruction into code and return its length.
+static uint8_t random_instruction(uint32_t *state, uint8_t *code) {
+  uint32_t r = next_random(state);
+  uint8_t index = (r & 0x100) ? 0xFD : 0xDD;
+
+  switch ((r >> 9) % 8) {
+  case 0:
+  case 1:
+    code[0] = (uint8_t)(0x80 + (r & 0x3F));
+    return 1;
+  case 2:
+    code[0] = main_ops[(r & 0xFF) % COUNT(main_ops)];
+    return 1;
+  case 3:
+    code[0] = main_n_ops[(r & 0xFF) % COUNT(main_n_ops)];
+    code[1] = (uint8_t)(r >> 16);
+    return 2;
+  case 4:
+    code[0] = 0xCB;
+    code[1] = (uint8_t)r;
+    return 2;
+  case 5:
+    code[0] = 0xED;
+    code[1] = ed_ops[(r & 0xFF) % COUNT(ed_ops)];
+    return 2;
+  case 6:
+    code[0] = index;
+    if (r & 0x10000) {
+      code[1] = index_ops[(r & 0xFF) % COUNT(index_ops)];
+      return 2;
+    }
+    code[1] = index_d_ops[(r & 0xFF) % COUNT(index_d_ops)];
+    code[2] = (uint8_t)(r >> 20);
+    return 3;
+  default:
+    code[0] = index;
+    code[1] = 0xCB;
+    code[2] = (uint8_t)(r >> 20);
+    code[3] = (uint8_t)r;
+    return 4;
+  }
+}
+
+// Two CPUs with the same random memory, differing only in lazy_flags.
+static int cpu_pair_init(cpu_t *lazy, cpu_t *eager, uint32_t *state) {
+  uint8_t page[256];
+
+  if (cpu_init(lazy, 0x10000) != 0 || cpu_init(eager, 0x10000) != 0)
+    return -1;
+  lazy->lazy_flags = true;
+  eager->lazy_flags = false;
+  // cpu_step never uses the block cache, and without it loading the next
+  // instruction does not flush anything.
+  block_cache_destroy(lazy);
+  block_cache_destroy(eager);
+
+  for (uint32_t address = 0; address < 0x10000; address += sizeof(page)) {
+    for (uint32_t i = 0; i < sizeof(page); i++)
+      page[i] = (uint8_t)next_random(state);
+    memory_load_at(lazy, page, sizeof(page), (uint16_t)address);
+    memory_load_at(eager, page, sizeof(page), (uint16_t)address);
+  }
+  return 0;
+}
+
+// Start a new sequence from the same random registers on both CPUs.
+static void cpu_pair_seed(cpu_t *lazy, cpu_t *eager, uint32_t *state) {
+  for (uint8_t reg = REG_AF; reg <= REG_SP; reg++) {
+    uint16_t value = (uint16_t)next_random(state);
+
+    register_value_set(lazy, reg, value);
+    register_value_set(eager, reg, value);
+  }
+  lazy->alt_registers = lazy->registers;
+  eager->alt_registers = eager->registers;
+}
+
+static bool window_matches(cpu_t *lazy, cpu_t *eager, uint16_t address) {
+  for (uint16_t i = 0; i < WINDOW; i++) {
+    uint16_t at = (uint16_t)(address - WINDOW / 2 + i);
+
+    if (memory_peek(lazy, at) != memory_peek(eager, at))
+      return false;
+  }
+  return true;
+}
+
+// Compare the two CPUs without disturbing the lazy one's pending flags.
+static bool cpu_pair_matches(cpu_t *lazy, cpu_t *eager,
+                             const uint16_t *addresses, int count) {
+  flags_pending_t pending = lazy->flags;
+  uint8_t f = lazy->registers.f;
+  bool same = false;
+
+  flags_materialize(lazy);
+  same = memcmp(&lazy->registers, &eager->registers,
+                sizeof(lazy->registers)) == 0 &&
+         memcmp(&lazy->alt_registers, &eager->alt_registers,
+                sizeof(lazy->alt_registers)) == 0;
+  lazy->flags = pending;
+  lazy->registers.f = f;
+
+  for (int i = 0; same && i < count; i++)
+    same = window_matches(lazy, eager, addresses[i]);
+  return same;
+}
+
+static void report(cpu_t *lazy, cpu_t *eager, uint64_t step,
+                   const uint8_t *code, uint8_t length) {
+  fprintf(stderr, "Mismatch at instruction %" PRIu64 ":", step);
+  for (uint8_t i = 0; i < length; i++)
+    fprintf(stderr, " %02X", code[i]);
+  flags_materialize(lazy);
+  fprintf(stderr, "\n  lazy  AF=%04X BC=%04X DE=%04X HL=%04X\n",
+          lazy->registers.af, lazy->registers.bc, lazy->registers.de,
+          lazy->registers.hl);
+  fprintf(stderr, "  eager AF=%04X BC=%04X DE=%04X HL=%04X\n",
+          eager->registers.af, eager->registers.bc, eager->registers.de,
+          eager->registers.hl);
+}
+
+int main(int argc, char *argv[]) {
+  uint64_t instructions = 1000000;
+  uint32_t state = 0x2468ACE1u;
+  cpu_t *lazy = NULL;
+  cpu_t *eager = NULL;
+  int status = 1;
+
+  if (argc > 1) {
+    char *end = NULL;
+
+    instructions = strtoull(argv[1], &end, 10);
+    if (*end != '\0' || instructions == 0) {
+      fprintf(stderr, "Usage: %s [instructions]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  lazy = (cpu_t *)calloc(1, sizeof(cpu_t));
+  eager = (cpu_t *)calloc(1, sizeof(cpu_t));
+  if (!lazy || !eager || cpu_pair_init(lazy, eager, &state) != 0) {
+    fprintf(stderr, "Cannot initialise CPUs\n");
+    goto done;
+  }
+
+  for (uint64_t step = 0; step < instructions; step++) {
+    uint8_t code[4] = {0};
+    uint8_t length = 0;
+    uint8_t d = 0;
+    uint16_t addresses[5];
+    cpu_exit_t lazy_reason;
+    cpu_exit_t eager_reason;
+
+    if (step % SEQUENCE_LENGTH == 0)
+      cpu_pair_seed(lazy, eager, &state);
+
+    // Each instruction runs from the same address, so nothing it writes
+    // can turn the sequence into a branch.
+    length = random_instruction(&state, code);
+    memory_load_at(lazy, code, length, CODE_ADDRESS);
+    memory_load_at(eager, code, length, CODE_ADDRESS);
+    register_value_set(lazy, REG_PC, CODE_ADDRESS);
+    register_value_set(eager, REG_PC, CODE_ADDRESS);
+
+    d = length > 2 ? code[2] : 0;
+    addresses[0] = eager->registers.hl;
+    addresses[1] = (uint16_t)(eager->registers.ix + (int8_t)d);
+    addresses[2] = (uint16_t)(eager->registers.iy + (int8_t)d);
+    addresses[3] = eager->registers.sp;
+    addresses[4] = eager->registers.de;
+
+    lazy_reason = cpu_step(lazy);
+    eager_reason = cpu_step(eager);
+    if (lazy_reason != eager_reason ||
+        !cpu_pair_matches(lazy, eager, addresses, 5)) {
+      report(lazy, eager, step, code, length);
+      goto done;
+    }
+  }
+
+  fprintf(stdout, "%" PRIu64 " instructions, lazy and eager flags agree\n",
+          instructions);
+  status = 0;
+
+done:
+  if (lazy)
+    cpu_destroy(lazy);
+  if (eager)
+    cpu_destroy(eager);
+  free(lazy);
+  free(eager);
+  return status;
+}
@@ -0,0 +1,65 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef FLAG_FORMULAS_H
+#define FLAG_FORMULAS_H
+
+#include <stdint.h>
+
+#include "register.h"
+
+// Reference flag computations. gen_flag_tables evaluates these for every
+// input to build the lookup tables; flag_bench times them against the tables.
+
+#define FORMULA_BIT(flag, condition)                                           \
+  ((condition) ? (uint8_t)(1u << (flag)) : 0)
+
+static inline uint8_t formula_szp(uint8_t result) {
+  uint8_t parity = result;
+
+  parity ^= parity >> 4;
+  parity ^= parity >> 2;
+  parity ^= parity >> 1;
+  return FORMULA_BIT(FLAG_S, result & 0x80) | FORMULA_BIT(FLAG_Z, result == 0) |
+         FORMULA_BIT(FLAG_PV, (parity & 1) == 0);
+}
+
+// ADD/ADC: S Z H PV N C
+static inline uint8_t formula_add(uint8_t a, uint8_t value, uint8_t carry) {
+  uint16_t sum = (uint16_t)(a + value + carry);
+  uint8_t result = (uint8_t)sum;
+
+  return FORMULA_BIT(FLAG_S, result & 0x80) | FORMULA_BIT(FLAG_Z, result == 0) |
+         FORMULA_BIT(FLAG_H, ((a & 0x0F) + (value & 0x0F) + carry) > 0x0F) |
+         FORMULA_BIT(FLAG_PV, (~(a ^ value) & (a ^ result) & 0x80) != 0) |
+         FORMULA_BIT(FLAG_C, sum > 0xFF);
+}
+
+// SUB/SBC/CP: S Z H PV N C
+static inline uint8_t formula_sub(uint8_t a, uint8_t value, uint8_t carry) {
+  int16_t diff = (int16_t)(a - value - carry);
+  uint8_t result = (uint8_t)diff;
+
+  return FORMULA_BIT(FLAG_S, result & 0x80) | FORMULA_BIT(FLAG_Z, result == 0) |
+         FORMULA_BIT(FLAG_H, (a & 0x0F) < ((value & 0x0F) + carry)) |
+         FORMULA_BIT(FLAG_PV, ((a ^ value) & (a ^ result) & 0x80) != 0) |
+         FORMULA_BIT(FLAG_N, 1) | FORMULA_BIT(FLAG_C, diff < 0);
+}
+
+#endif
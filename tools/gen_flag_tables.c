@@ -0,0 +1,78 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Build-time generator for the flag lookup tables declared in
+// include/flag_tables.h.
+//
+// Usage: gen_flag_tables <output.c>
+
+#include <stdio.h>
+
+#include "flag_formulas.h"
+
+static void write_table(FILE *out, const char *name, unsigned size,
+                        uint8_t (*entry)(unsigned index)) {
+  fprintf(out, "const uint8_t %s[%u] = {\n", name, size);
+  for (unsigned i = 0; i < size; i++) {
+    fprintf(out, "%s%u,%s", (i % 16) ? "" : "  ", entry(i),
+            (i % 16 == 15) ? "\n" : "");
+  }
+  fprintf(out, "};\n\n");
+}
+
+static uint8_t szp_entry(unsigned index) {
+  return formula_szp((uint8_t)index);
+}
+
+static uint8_t add_entry(unsigned index) {
+  return formula_add((uint8_t)(index >> 8), (uint8_t)index,
+                     (uint8_t)(index >> 16));
+}
+
+static uint8_t sub_entry(unsigned index) {
+  return formula_sub((uint8_t)(index >> 8), (uint8_t)index,
+                     (uint8_t)(index >> 16));
+}
+
+int main(int argc, char *argv[]) {
+  FILE *out = NULL;
+
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s <output.c>\n", argv[0]);
+    return 1;
+  }
+
+  out = fopen(argv[1], "w");
+  if (!out) {
+    fprintf(stderr, "Cannot open file: %s\n", argv[1]);
+    return 1;
+  }
+
+  fprintf(out, "// Generated by tools/gen_flag_tables.c. Do not edit.\n\n");
+  fprintf(out, "#include \"flag_tables.h\"\n\n");
+  write_table(out, "flags_szp", 0x100, szp_entry);
+  write_table(out, "flags_add", 0x20000, add_entry);
+  write_table(out, "flags_sub", 0x20000, sub_entry);
+
+  if (fclose(out) != 0) {
+    fprintf(stderr, "Cannot write file: %s\n", argv[1]);
+    return 1;
+  }
+  return 0;
+}
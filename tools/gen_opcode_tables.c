@@ -0,0 +1,415 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Build-time generator for the instruction dispatch tables included by
+// src/instruction.c and the disassembly table in opcode_table.c. Both come
+// from src/op_codes.txt, so lengths, timings and labels cannot drift apart.
+//
+// Usage: gen_opcode_tables <op_codes.txt> <instruction_tables.h>
+//                          <opcode_table.c>
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Keep in step with the OPERAND_* bits in include/instruction.h.
+#define OPERAND_D 0x01
+#define OPERAND_N 0x02
+#define OPERAND_NN 0x04
+#define OPERAND_UNINDEXED 0x08
+
+#define LINE_MAX_LENGTH 256
+#define FIELD_COUNT 7
+#define ROW_MAX 2048
+
+enum { SPACE_MAIN, SPACE_CB, SPACE_ED, SPACE_DD, SPACE_FD, SPACE_DDCB,
+       SPACE_FDCB, SPACE_COUNT };
+
+typedef struct {
+  unsigned line;
+  uint8_t bytes[4];
+  int space;
+  uint8_t key; // Opcode byte that selects the table entry
+  unsigned length;
+  char label[64];
+  char handler[48];
+  unsigned tstates;       // Not taken, or last iteration
+  unsigned tstates_taken; // Taken, or repeating
+  unsigned operands;
+  bool displacement;
+} row_t;
+
+static row_t rows[ROW_MAX];
+static size_t row_count = 0;
+static const row_t *by_space[SPACE_COUNT][256];
+
+// Split a CSV line in place. Fields may be double-quoted to hold commas.
+static int split_fields(char *line, char *fields[], int max) {
+  int count = 0;
+  char *p = line;
+
+  while (count < max) {
+    while (*p == ' ')
+      p++;
+    if (*p == '"') {
+      fields[count++] = ++p;
+      while (*p && *p != '"')
+        p++;
+      if (*p)
+        *p++ = '\0';
+    } else {
+      fields[count++] = p;
+      while (*p && *p != ',' && *p != '\n' && *p != '\r')
+        p++;
+    }
+    if (*p != ',') {
+      *p = '\0';
+      break;
+    }
+    *p++ = '\0';
+  }
+  return count;
+}
+
+static bool has_word(const char *label, const char *word, bool after_plus,
+                     bool *found_after_plus) {
+  size_t length = strlen(word);
+
+  for (const char *p = label; *p;) {
+    const char *start = p;
+
+    if (!isalpha((unsigned char)*p)) {
+      p++;
+      continue;
+    }
+    while (isalpha((unsigned char)*p))
+      p++;
+    if ((size_t)(p - start) == length && strncmp(start, word, length) == 0) {
+      bool plus = start > label && start[-1] == '+';
+
+      if (found_after_plus)
+        *found_after_plus = plus;
+      if (plus == after_plus)
+        return true;
+    }
+  }
+  return false;
+}
+
+// The operand bytes follow from the label: "+d" is an index displacement, a
+// bare "d" a relative jump offset (fetched like an immediate byte).
+static unsigned derive_operands(const row_t *row) {
+  unsigned operands = 0;
+
+  if (row->space == SPACE_DDCB || row->space == SPACE_FDCB ||
+      row->space == SPACE_CB)
+    return 0;
+  if (has_word(row->label, "d", true, NULL))
+    operands |= OPERAND_D;
+  if (has_word(row->label, "d", false, NULL) ||
+      has_word(row->label, "n", false, NULL))
+    operands |= OPERAND_N;
+  if (has_word(row->label, "nn", false, NULL))
+    operands |= OPERAND_NN;
+  if ((row->space == SPACE_DD || row->space == SPACE_FD) &&
+      !strstr(row->label, "IX") && !strstr(row->label, "IY"))
+    operands |= OPERAND_UNINDEXED;
+  return operands;
+}
+
+static unsigned operand_bytes(unsigned operands) {
+  return ((operands & OPERAND_D) ? 1 : 0) + ((operands & OPERAND_N) ? 1 : 0) +
+         ((operands & OPERAND_NN) ? 2 : 0);
+}
+
+static int parse_row(row_t *row, char *fields[], const char *path) {
+  char *bytes = fields[0];
+  char *token = NULL;
+  unsigned count = 0;
+  char *slash = NULL;
+
+  // "0xDD 0xCB d 0x06": the displacement sits between the prefixes and the
+  // opcode and has no byte value of its own.
+  for (token = strtok(bytes, " "); token; token = strtok(NULL, " ")) {
+    if (count >= 4)
+      break;
+    if (strcmp(token, "d") == 0) {
+      row->bytes[count++] = 0x00;
+      continue;
+    }
+    row->bytes[count++] = (uint8_t)strtoul(token, NULL, 16);
+  }
+  if (count == 0) {
+    fprintf(stderr, "%s:%u: missing opcode\n", path, row->line);
+    return -1;
+  }
+
+  row->key = row->bytes[0];
+  row->space = SPACE_MAIN;
+  if (count == 2 && row->bytes[0] == 0xCB) {
+    row->space = SPACE_CB;
+    row->key = row->bytes[1];
+  } else if (count == 2 && row->bytes[0] == 0xED) {
+    row->space = SPACE_ED;
+    row->key = row->bytes[1];
+  } else if (count == 2 && (row->bytes[0] == 0xDD || row->bytes[0] == 0xFD)) {
+    row->space = row->bytes[0] == 0xDD ? SPACE_DD : SPACE_FD;
+    row->key = row->bytes[1];
+  } else if (count == 4) {
+    row->space = row->bytes[0] == 0xDD ? SPACE_DDCB : SPACE_FDCB;
+    row->key = row->bytes[3];
+  } else if (count != 1) {
+    fprintf(stderr, "%s:%u: unexpected opcode bytes\n", path, row->line);
+    return -1;
+  }
+
+  row->length = (unsigned)strtoul(fields[2], NULL, 10);
+  snprintf(row->label, sizeof(row->label), "%s", fields[1]);
+  snprintf(row->handler, sizeof(row->handler), "%s", fields[6]);
+
+  row->tstates_taken = (unsigned)strtoul(fields[5], &slash, 10);
+  row->tstates = row->tstates_taken;
+  if (*slash == '/')
+    row->tstates = (unsigned)strtoul(slash + 1, NULL, 10);
+  if (row->tstates > 255 || row->tstates_taken > 255) {
+    fprintf(stderr, "%s:%u: T-states out of range\n", path, row->line);
+    return -1;
+  }
+
+  row->operands = derive_operands(row);
+  row->displacement = row->space == SPACE_DDCB ||
+                      row->space == SPACE_FDCB ||
+                      (row->operands & OPERAND_D);
+
+  // Bare prefixes and undefined opcodes keep the file's length as it is.
+  if (row->handler[0]) {
+    unsigned prefix = row->space == SPACE_MAIN ? 1 : 2;
+    unsigned expected = (row->space == SPACE_DDCB || row->space == SPACE_FDCB)
+                            ? 4
+                            : prefix + operand_bytes(row->operands);
+
+    if (expected != row->length) {
+      fprintf(stderr, "%s:%u: %s is %u bytes, operands need %u\n", path,
+              row->line, row->label, row->length, expected);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static int read_rows(const char *path) {
+  char line[LINE_MAX_LENGTH];
+  unsigned number = 0;
+  FILE *in = fopen(path, "r");
+
+  if (!in) {
+    fprintf(stderr, "Cannot open file: %s\n", path);
+    return -1;
+  }
+
+  while (fgets(line, sizeof(line), in)) {
+    char *fields[FIELD_COUNT] = {NULL};
+    char *p = line;
+    row_t *row = NULL;
+
+    number++;
+    while (*p == ' ')
+      p++;
+    if (*p == '#' || *p == '\n' || *p == '\0')
+      continue;
+
+    if (row_count >= ROW_MAX) {
+      fprintf(stderr, "%s:%u: too many rows\n", path, number);
+      fclose(in);
+      return -1;
+    }
+    if (split_fields(p, fields, FIELD_COUNT) != FIELD_COUNT) {
+      fprintf(stderr, "%s:%u: expected %d fields\n", path, number,
+              FIELD_COUNT);
+      fclose(in);
+      return -1;
+    }
+
+    row = &rows[row_count];
+    memset(row, 0, sizeof(*row));
+    row->line = number;
+    if (parse_row(row, fields, path) != 0) {
+      fclose(in);
+      return -1;
+    }
+    if (by_space[row->space][row->key] && row->handler[0]) {
+      fprintf(stderr, "%s:%u: duplicate opcode\n", path, number);
+      fclose(in);
+      return -1;
+    }
+    if (!by_space[row->space][row->key] || row->handler[0])
+      by_space[row->space][row->key] = row;
+    row_count++;
+  }
+
+  fclose(in);
+  return 0;
+}
+
+// DD and FD (and DDCB and FDCB) share a dispatch table, so their rows must
+// agree on everything but the index register.
+static int check_shared(const char *path, int first, int second) {
+  for (unsigned i = 0; i < 256; i++) {
+    const row_t *a = by_space[first][i];
+    const row_t *b = by_space[second][i];
+
+    if (!a || !b)
+      continue;
+    if (strcmp(a->handler, b->handler) != 0 || a->operands != b->operands ||
+        a->tstates != b->tstates || a->tstates_taken != b->tstates_taken) {
+      fprintf(stderr, "%s:%u: differs from line %u\n", path, b->line,
+              a->line);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static void write_operands(FILE *out, unsigned operands) {
+  static const struct {
+    unsigned bit;
+    const char *name;
+  } names[] = {{OPERAND_D, "OPERAND_D"},
+               {OPERAND_N, "OPERAND_N"},
+               {OPERAND_NN, "OPERAND_NN"},
+               {OPERAND_UNINDEXED, "OPERAND_UNINDEXED"}};
+  bool first = true;
+
+  if (!operands) {
+    fprintf(out, "OPERAND_NONE");
+    return;
+  }
+  for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+    if (operands & names[i].bit) {
+      fprintf(out, "%s%s", first ? "" : " | ", names[i].name);
+      first = false;
+    }
+  }
+}
+
+static void write_dispatch(FILE *out, const char *name, const char *comment,
+                           int space) {
+  fprintf(out, "// %s\n", comment);
+  fprintf(out, "static const instruction_entry_t %s[256] = {\n", name);
+  for (unsigned i = 0; i < 256; i++) {
+    const row_t *row = by_space[space][i];
+
+    if (!row || !row->handler[0])
+      continue;
+    fprintf(out, "    [0x%02X] = {%s, ", i, row->handler);
+    write_operands(out, row->operands);
+    fprintf(out, ", %u, %u}, // %s\n", row->tstates, row->tstates_taken,
+            row->label);
+  }
+  fprintf(out, "};\n\n");
+}
+
+static int write_instruction_tables(const char *path) {
+  FILE *out = fopen(path, "w");
+
+  if (!out) {
+    fprintf(stderr, "Cannot open file: %s\n", path);
+    return -1;
+  }
+
+  fprintf(out, "// Generated by tools/gen_opcode_tables.c from "
+               "src/op_codes.txt. Do not edit.\n");
+  fprintf(out, "// Included by src/instruction.c after the op_* "
+               "handlers.\n\n");
+  write_dispatch(out, "instruction_table_main", "Unprefixed opcodes.",
+                 SPACE_MAIN);
+  write_dispatch(out, "instruction_table_cb",
+                 "CB-prefixed rotate/shift/bit/res/set.", SPACE_CB);
+  write_dispatch(out, "instruction_table_ed", "ED-prefixed opcodes.",
+                 SPACE_ED);
+  write_dispatch(out, "instruction_table_index",
+                 "DD/FD-prefixed opcodes; operands.index_reg selects IX or "
+                 "IY.",
+                 SPACE_DD);
+  write_dispatch(out, "instruction_table_index_cb",
+                 "DDCB/FDCB-prefixed opcodes; the displacement precedes the "
+                 "opcode byte.",
+                 SPACE_DDCB);
+
+  if (fclose(out) != 0) {
+    fprintf(stderr, "Cannot write file: %s\n", path);
+    return -1;
+  }
+  return 0;
+}
+
+static int write_opcode_table(const char *path) {
+  FILE *out = fopen(path, "w");
+
+  if (!out) {
+    fprintf(stderr, "Cannot open file: %s\n", path);
+    return -1;
+  }
+
+  fprintf(out, "// Generated by tools/gen_opcode_tables.c from "
+               "src/op_codes.txt. Do not edit.\n\n");
+  fprintf(out, "#include \"opcode_table.h\"\n\n");
+  fprintf(out, "const opcode_info_t opcode_table[] = {\n");
+  for (size_t i = 0; i < row_count; i++) {
+    const row_t *row = &rows[i];
+
+    fprintf(out,
+            "  {{0x%02X, 0x%02X, 0x%02X, 0x%02X}, %u, %d, %u, %u, \"%s\"},\n",
+            row->bytes[0], row->bytes[1], row->bytes[2], row->bytes[3],
+            row->length, row->displacement ? 1 : 0, row->tstates,
+            row->tstates_taken, row->label);
+  }
+  fprintf(out, "};\n");
+  fprintf(out, "const size_t opcode_table_size = sizeof(opcode_table) / "
+               "sizeof(opcode_table[0]);\n");
+
+  if (fclose(out) != 0) {
+    fprintf(stderr, "Cannot write file: %s\n", path);
+    return -1;
+  }
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc != 4) {
+    fprintf(stderr,
+            "Usage: %s <op_codes.txt> <instruction_tables.h> "
+            "<opcode_table.c>\n",
+            argv[0]);
+    return 1;
+  }
+
+  if (read_rows(argv[1]) != 0)
+    return 1;
+  if (check_shared(argv[1], SPACE_DD, SPACE_FD) != 0 ||
+      check_shared(argv[1], SPACE_DDCB, SPACE_FDCB) != 0)
+    return 1;
+  if (write_instruction_tables(argv[2]) != 0 ||
+      write_opcode_table(argv[3]) != 0)
+    return 1;
+  return 0;
+}
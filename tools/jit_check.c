@@ -0,0 +1,298 @@
+/*
+ * This file is part of raveloxzemu.
+ *
+ * Copyright (C) 2026 Dave Kelly
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Self-check: native JIT blocks must leave exactly what the interpreter
+// does. Each case is a loop of random unprefixed instructions, long enough
+// to get hot and be translated. It runs one instruction at a time with
+// cpu_step, and with cpu_run under the JIT, with lazy and with eager flags.
+// Exit reason, registers (F included), the alternate set, instruction and
+// T-state counts and all of memory must agree.
+//
+// Branches in the loop only go forward to one of its later instructions, so
+// taken and untaken paths both carry on through the body. Whatever the loop stores may land on
+// its own code; that only changes which blocks get rebuilt.
+//
+// Usage: jit_check [cases]
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "block.h"
+#include "cpu.h"
+#include "flags.h"
+#include "jit.h"
+#include "register.h"
+
+#define CODE_ADDRESS 0x1000
+#define BODY_LENGTH 24 // Instructions per loop
+#define BUDGET 20000
+
+typedef enum { MODE_STEP, MODE_JIT, MODE_COUNT } run_mode_t;
+
+typedef struct {
+  cpu_exit_t reason;
+  z80_register_file_t registers;
+  z80_register_file_t alt_registers;
+  uint64_t instructions;
+  uint64_t cycles;
+  uint32_t memory;
+  uint64_t translated; // Blocks the JIT translated, 0 for cpu_step
+} outcome_t;
+
+static uint32_t next_random(uint32_t *state) {
+  uint32_t x = *state;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return x;
+}
+
+static uint32_t memory_hash(cpu_t *cpu) {
+  uint32_t hash = 2166136261u;
+
+  for (uint32_t address = 0; address < 0x10000; address++)
+    hash = (hash ^ memory_peek(cpu, (uint16_t)address)) * 16777619u;
+  return hash;
+}
+
+// Unprefixed opcodes that cannot leave the loop or stop the run: no HALT,
+// port I/O, returns, restarts or JP (HL).
+static bool opcode_allowed(uint8_t op) {
+  if (op == 0x76 || op == 0xD3 || op == 0xDB || op == 0xCB || op == 0xDD ||
+      op == 0xED || op == 0xFD || op == 0xC9 || op == 0xE9)
+    return false;
+  return (op & 0xC7) != 0xC0 && (op & 0xC7) != 0xC7; // RET cc, RST
+}
+
+static uint8_t opcode_length(uint8_t op) {
+  if ((op & 0xCF) == 0x01 || op == 0x22 || op == 0x2A || op == 0x32 ||
+      op == 0x3A || (op & 0xC7) == 0xC2 || op == 0xC3 ||
+      (op & 0xC7) == 0xC4 || op == 0xCD)
+    return 3;
+  if ((op & 0xC7) == 0x06 || (op & 0xC7) == 0xC6 || op == 0x10 ||
+      (op & 0xE7) == 0x20 || op == 0x18)
+    return 2;
+  return 1;
+}
+
+static bool opcode_branches(uint8_t op) {
+  return op == 0x10 || op == 0x18 || (op & 0xE7) == 0x20 || op == 0xC3 ||
+         op == 0xCD || (op & 0xC7) == 0xC2 || (op & 0xC7) == 0xC4;
+}
+
+// Random memory and registers, then the loop at CODE_ADDRESS.
+static void image_random(uint8_t *image, uint16_t *seed_registers,
+                         uint32_t *state) {
+  uint16_t starts[BODY_LENGTH + 1];
+  uint16_t address = CODE_ADDRESS;
+
+  for (uint32_t at = 0; at < 0x10000; at += 4) {
+    uint32_t r = next_random(state);
+
+    memcpy(image + at, &r, sizeof(r));
+  }
+  for (uint8_t reg = REG_AF; reg <= REG_SP; reg++)
+    seed_registers[reg] = (uint16_t)next_random(state);
+
+  for (int i = 0; i < BODY_LENGTH; i++) {
+    uint32_t r = next_random(state);
+    uint8_t op = (uint8_t)r;
+    uint8_t length = 0;
+
+    while (!opcode_allowed(op))
+      op = (uint8_t)(op + 1);
+    length = opcode_length(op);
+    starts[i] = address;
+    image[address] = op;
+    if (length > 1)
+      image[address + 1] = (uint8_t)(r >> 8);
+    if (length > 2)
+      image[address + 2] = (uint8_t)(r >> 16);
+    address = (uint16_t)(address + length);
+  }
+
+  starts[BODY_LENGTH] = address;
+  image[address] = 0xC3; // JP CODE_ADDRESS
+  image[address + 1] = (uint8_t)CODE_ADDRESS;
+  image[address + 2] = (uint8_t)(CODE_ADDRESS >> 8);
+
+  // Point each branch at a later instruction, the closing JP included.
+  for (int i = 0; i < BODY_LENGTH; i++) {
+    uint8_t op = image[starts[i]];
+    uint16_t next = (uint16_t)(starts[i] + opcode_length(op));
+    uint16_t target = 0;
+
+    if (!opcode_branches(op))
+      continue;
+    target = starts[i + 1 + next_random(state) % (BODY_LENGTH - i)];
+    if (opcode_length(op) == 2) {
+      image[starts[i] + 1] = (uint8_t)(target - next);
+    } else {
+      image[starts[i] + 1] = (uint8_t)target;
+      image[starts[i] + 2] = (uint8_t)(target >> 8);
+    }
+  }
+}
+
+static int run_case(const uint8_t *image, const uint16_t *seed_registers,
+                    run_mode_t mode, bool lazy_flags, outcome_t *outcome) {
+  cpu_t *cpu = (cpu_t *)calloc(1, sizeof(cpu_t));
+  int status = -1;
+
+  if (!cpu || cpu_init(cpu, 0x10000) != 0)
+    goto done;
+  cpu->lazy_flags = lazy_flags;
+  cpu->idle_detect = false;
+  // Load with the cache off so the load does not flush anything.
+  block_cache_destroy(cpu);
+  if (memory_load_at(cpu, image, 0x10000, 0) != 0)
+    goto done;
+  if (mode == MODE_JIT && (block_cache_init(cpu) != 0 || jit_init(cpu) != 0))
+    goto done;
+  for (uint8_t reg = REG_AF; reg <= REG_SP; reg++)
+    register_value_set(cpu, reg, seed_registers[reg]);
+  cpu->alt_registers = cpu->registers;
+  register_value_set(cpu, REG_PC, CODE_ADDRESS);
+
+  if (mode == MODE_STEP) {
+    outcome->reason = CPU_EXIT_BUDGET;
+    while (cpu->instructions < BUDGET) {
+      cpu_exit_t reason = cpu_step(cpu);
+
+      if (reason != CPU_EXIT_NONE) {
+        outcome->reason = reason;
+        break;
+      }
+    }
+  } else {
+    outcome->reason = cpu_run(cpu, BUDGET);
+  }
+
+  flags_materialize(cpu);
+  outcome->registers = cpu->registers;
+  outcome->alt_registers = cpu->alt_registers;
+  outcome->instructions = cpu->instructions;
+  outcome->cycles = cpu->clock.cycles;
+  outcome->memory = memory_hash(cpu);
+  outcome->translated = cpu->jit ? cpu->jit->translated : 0;
+  status = 0;
+
+done:
+  if (cpu)
+    cpu_destroy(cpu);
+  free(cpu);
+  return status;
+}
+
+static bool outcome_matches(const outcome_t *a, const outcome_t *b) {
+  return a->reason == b->reason &&
+         memcmp(&a->registers, &b->registers, sizeof(a->registers)) == 0 &&
+         memcmp(&a->alt_registers, &b->alt_registers,
+                sizeof(a->alt_registers)) == 0 &&
+         a->instructions == b->instructions && a->cycles == b->cycles &&
+         a->memory == b->memory;
+}
+
+static void outcome_print(const char *name, const outcome_t *outcome) {
+  fprintf(stderr,
+          "  %-8s %s PC=%04X AF=%04X BC=%04X DE=%04X HL=%04X SP=%04X"
+          " %" PRIu64 " instructions %" PRIu64 " T-states memory %08X\n",
+          name, cpu_exit_name(outcome->reason), outcome->registers.pc,
+          outcome->registers.af, outcome->registers.bc, outcome->registers.de,
+          outcome->registers.hl, outcome->registers.sp, outcome->instructions,
+          outcome->cycles, outcome->memory);
+}
+
+static void report(const uint8_t *image, uint64_t index, bool lazy_flags,
+                   const outcome_t *step, const outcome_t *jit) {
+  fprintf(stderr, "Case %" PRIu64 " (%s flags): JIT differs from cpu_step\n ",
+          index, lazy_flags ? "lazy" : "eager");
+  for (uint16_t at = CODE_ADDRESS; at < CODE_ADDRESS + 3 * BODY_LENGTH + 3;
+       at++)
+    fprintf(stderr, " %02X", image[at]);
+  fprintf(stderr, "\n");
+  outcome_print("cpu_step", step);
+  outcome_print("JIT", jit);
+}
+
+int main(int argc, char *argv[]) {
+  static uint8_t image[0x10000];
+  uint16_t seed_registers[REG_SP + 1];
+  uint64_t cases = 200;
+  uint32_t state = 0x0BADC0DEu;
+  uint64_t translated = 0;
+  cpu_t probe;
+
+  if (argc > 1) {
+    char *end = NULL;
+
+    cases = strtoull(argv[1], &end, 10);
+    if (*end != '\0' || cases == 0) {
+      fprintf(stderr, "Usage: %s [cases]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  // Nothing to compare where the JIT cannot be switched on.
+  memset(&probe, 0, sizeof(probe));
+  if (cpu_init(&probe, 0x10000) != 0)
+    return 1;
+  if (jit_init(&probe) != 0) {
+    cpu_destroy(&probe);
+    fprintf(stdout, "JIT not available, nothing to check\n");
+    return 0;
+  }
+  cpu_destroy(&probe);
+
+  for (uint64_t i = 0; i < cases; i++) {
+    image_random(image, seed_registers, &state);
+    for (int lazy = 1; lazy >= 0; lazy--) {
+      outcome_t outcomes[MODE_COUNT];
+
+      for (run_mode_t mode = MODE_STEP; mode < MODE_COUNT; mode++) {
+        if (run_case(image, seed_registers, mode, lazy, &outcomes[mode]) !=
+            0) {
+          fprintf(stderr, "Case %" PRIu64 ": cannot run\n", i);
+          return 1;
+        }
+      }
+      if (!outcome_matches(&outcomes[MODE_STEP], &outcomes[MODE_JIT])) {
+        report(image, i, lazy, &outcomes[MODE_STEP], &outcomes[MODE_JIT]);
+        return 1;
+      }
+      translated += outcomes[MODE_JIT].translated;
+    }
+  }
+
+  // Loops that never ran natively would make the comparison pointless.
+  if (translated == 0) {
+    fprintf(stderr, "No block was translated\n");
+    return 1;
+  }
+
+  fprintf(stdout,
+          "%" PRIu64 " cases, %" PRIu64 " blocks translated, the JIT agrees"
+          " with cpu_step\n",
+          cases, translated);
+  return 0;
+}